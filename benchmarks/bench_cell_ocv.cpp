@@ -0,0 +1,107 @@
+// Compares the table-driven cell OCV lookup against the former branchy
+// piecewise-segment evaluation, per cell and for a whole BatterySim pack.
+//
+// Usage: bench_cell_ocv [cells] [iterations]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "simulator/physics/battery_sim.h"
+#include "simulator/physics/cell_ocv_table.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using drone::simulator::physics::CellOcvTable;
+
+struct OcvSegment {
+    double soc_lo_percent;
+    double soc_hi_percent;
+    double voltage_lo_v;
+    double voltage_hi_v;
+};
+
+constexpr OcvSegment kOcvSegments[] = {
+    {0.0, 30.0, 3.2, 3.5},
+    {30.0, 85.0, 3.5, 3.9},
+    {85.0, 100.0, 3.9, 4.2},
+};
+
+double segmentOcvV(double soc_percent) {
+    soc_percent = std::clamp(soc_percent, 0.0, 100.0);
+    for (const auto& segment : kOcvSegments) {
+        if (soc_percent <= segment.soc_hi_percent) {
+            const double slope = (segment.voltage_hi_v - segment.voltage_lo_v) /
+                                 (segment.soc_hi_percent - segment.soc_lo_percent);
+            return segment.voltage_lo_v + (soc_percent - segment.soc_lo_percent) * slope;
+        }
+    }
+    return kOcvSegments[2].voltage_hi_v;
+}
+
+template <typename Fn>
+double nsPerCell(std::size_t cells, int iterations, Fn&& fn) {
+    const auto start = Clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        fn();
+    }
+    const std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+    return elapsed.count() / (static_cast<double>(cells) * iterations);
+}
+
+void report(const std::string& label, double ns_per_cell) {
+    std::cout << label << ": " << ns_per_cell << " ns/cell (" << 1e3 / ns_per_cell << " Mcells/s)\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t cells = argc >= 2 ? std::strtoull(argv[1], nullptr, 10) : 4096;
+    const int iterations = argc >= 3 ? std::atoi(argv[2]) : 2000;
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> soc_dist(0.0, 100.0);
+    std::vector<double> soc(cells);
+    for (auto& value : soc) {
+        value = soc_dist(rng);
+    }
+    std::vector<double> voltage(cells);
+    volatile double sink = 0.0;
+
+    const double branchy = nsPerCell(cells, iterations, [&]() {
+        for (std::size_t i = 0; i < cells; ++i) {
+            voltage[i] = segmentOcvV(soc[i]);
+        }
+        sink = sink + voltage[cells / 2];
+    });
+
+    const CellOcvTable table = CellOcvTable::lipo();
+    const double tabled = nsPerCell(cells, iterations, [&]() {
+        for (std::size_t i = 0; i < cells; ++i) {
+            voltage[i] = table.voltageV(soc[i]);
+        }
+        sink = sink + voltage[cells / 2];
+    });
+
+    // Full pack step: capacity, SOC, OCV, energy and cached aggregates
+    const int series = static_cast<int>(std::max<std::size_t>(1, cells / 4));
+    drone::model::components::BatterySpecs specs(series, drone::model::components::CellSpecs(5000.0, 4.2), 0.0, 4);
+    drone::simulator::physics::BatterySim pack("bench", specs);
+    pack.setCurrentA(1e-3);
+    const double pack_step = nsPerCell(pack.getCellCount(), iterations, [&]() {
+        pack.advance(0.01);
+        sink = sink + pack.getVoltageV();
+    });
+
+    std::cout << "cells=" << cells << " iterations=" << iterations << "\n";
+    report("segment OCV (branchy)", branchy);
+    report("table OCV (branchless)", tabled);
+    report("BatterySim::advance", pack_step);
+    return 0;
+}
@@ -0,0 +1,70 @@
+// Measures completion checks for a fleet on one step: the per-frame predicate test
+// over SensorFrames against the batched pass over CompletionFrameBatch columns.
+//
+// Usage: bench_completion [vehicles] [ticks]
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "drone/mission/completion_predicate.h"
+#include "drone/runtime/real_drone.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using namespace drone::mission;
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t vehicles = argc >= 2 ? std::strtoull(argv[1], nullptr, 10) : 4096;
+    const std::size_t ticks = argc >= 3 ? std::strtoull(argv[2], nullptr, 10) : 2000;
+
+    CompletionCriteria criteria;
+    criteria.condition_type = CompletionConditionType::POSITION_REACHED;
+    criteria.target_position_enu_m = drone::Vector3(100.0, 50.0, 0.0);
+    criteria.position_tolerance_m = 2.0;
+    criteria.target_altitude_m = 30.0;
+    criteria.altitude_tolerance_m = 1.0;
+    const CompletionPredicate predicate = compileCompletionCriteria(criteria);
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> offset(-4.0, 4.0);
+    std::vector<drone::runtime::SensorFrame> frames(vehicles);
+    CompletionFrameBatch batch;
+    batch.resize(vehicles);
+    for (std::size_t i = 0; i < vehicles; ++i) {
+        frames[i].position_enu_x_m = 100.0 + offset(rng);
+        frames[i].position_enu_y_m = 50.0 + offset(rng);
+        frames[i].position_enu_z_m = 30.0 + 0.5 * offset(rng);
+        batch.set(i, frames[i]);
+    }
+
+    std::vector<std::uint8_t> met(vehicles);
+    std::size_t scalar_met = 0;
+    auto start = Clock::now();
+    for (std::size_t tick = 0; tick < ticks; ++tick) {
+        for (std::size_t i = 0; i < vehicles; ++i) {
+            scalar_met += testCompletionPredicate(predicate, frames[i]) ? 1 : 0;
+        }
+    }
+    const double scalar_s = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::size_t batch_met = 0;
+    start = Clock::now();
+    for (std::size_t tick = 0; tick < ticks; ++tick) {
+        testCompletionPredicateBatch(predicate, batch, met.data());
+        batch_met += met[tick % vehicles];
+    }
+    const double batch_s = std::chrono::duration<double>(Clock::now() - start).count();
+
+    const double checks = static_cast<double>(ticks) * vehicles;
+    std::cout << "vehicles=" << vehicles << " ticks=" << ticks << "\n"
+              << "per-frame: " << scalar_s * 1e9 / checks << " ns/vehicle (met " << scalar_met / ticks << ")\n"
+              << "batch:     " << batch_s * 1e9 / checks << " ns/vehicle (sample " << batch_met << ")\n";
+    return 0;
+}
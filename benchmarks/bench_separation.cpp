@@ -0,0 +1,67 @@
+// Measures SeparationMonitor cost per tick for a swarm drifting over a square
+// area, against the O(N^2) pair count it replaces.
+//
+// Usage: bench_separation [vehicles] [ticks] [area_side_m]
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "simulator/runtime/separation_monitor.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using drone::simulator::runtime::SeparationMonitor;
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t vehicles = argc >= 2 ? std::strtoull(argv[1], nullptr, 10) : 4096;
+    const std::size_t ticks = argc >= 3 ? std::strtoull(argv[2], nullptr, 10) : 1000;
+    const double side_m = argc >= 4 ? std::strtod(argv[3], nullptr) : 2000.0;
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> xy(-0.5 * side_m, 0.5 * side_m);
+    std::uniform_real_distribution<double> z(10.0, 120.0);
+    std::uniform_real_distribution<double> heading(0.0, 2.0 * M_PI);
+    std::vector<drone::Vector3> positions(vehicles);
+    std::vector<drone::Vector3> velocities(vehicles);
+    for (std::size_t i = 0; i < vehicles; ++i) {
+        positions[i] = drone::Vector3(xy(rng), xy(rng), z(rng));
+        const double psi = heading(rng);
+        velocities[i] = drone::Vector3(8.0 * std::cos(psi), 8.0 * std::sin(psi), 0.0);
+    }
+
+    SeparationMonitor monitor;
+    for (const auto& position : positions) {
+        monitor.addVehicle(&position);
+    }
+
+    const double dt_s = 0.02;
+    std::size_t events = 0;
+    std::uint64_t pairs_tested = 0;
+    Clock::duration elapsed{};
+    for (std::size_t tick = 0; tick < ticks; ++tick) {
+        for (std::size_t i = 0; i < vehicles; ++i) {
+            positions[i] = positions[i] + velocities[i] * dt_s;
+        }
+        const auto start = Clock::now();
+        events += monitor.update().size();
+        elapsed += Clock::now() - start;
+        pairs_tested += monitor.lastPairsTested();
+    }
+
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    const double brute_force_pairs = 0.5 * static_cast<double>(vehicles) * (vehicles - 1);
+    std::cout << "vehicles=" << vehicles << " ticks=" << ticks << "\n"
+              << "update: " << seconds * 1e6 / ticks << " us/tick ("
+              << seconds * 1e9 / (static_cast<double>(ticks) * vehicles) << " ns/vehicle)\n"
+              << "pairs tested/tick: " << static_cast<double>(pairs_tested) / ticks
+              << " (brute force " << brute_force_pairs << ")\n"
+              << "events: " << events << "\n";
+    return 0;
+}
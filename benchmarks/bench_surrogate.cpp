@@ -0,0 +1,74 @@
+// Measures plant step cost of the full QuaroSimulation against the linearized
+// SurrogateVehicle for the same precomputed actuator sequence (hover with a
+// slow attitude sweep). The controller is not included; see
+// surrogate_linearize for the closed-loop comparison.
+//
+// Usage: bench_surrogate [steps]
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "simulator/quadrosimulator.h"
+#include "simulator/runtime/surrogate_vehicle.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+drone::runtime::ActuatorFrame frameAt(std::size_t step, double hover_rpm) {
+    drone::runtime::ActuatorFrame frame;
+    const double phase = 1e-3 * static_cast<double>(step);
+    frame.desired_motor_rpm = hover_rpm * (1.0 + 0.02 * std::sin(phase));
+    frame.desired_pitch_rad = 0.1 * std::sin(0.7 * phase);
+    frame.desired_roll_rad = 0.1 * std::cos(0.3 * phase);
+    return frame;
+}
+
+double report(const char* label, std::size_t steps, Clock::duration elapsed) {
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    std::cout << label << ": " << seconds * 1e9 / steps << " ns/step\n";
+    return seconds;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t steps = argc >= 2 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    const double dt_s = 0.01;
+
+    auto sim = drone::simulator::QuadroSimulationFactory(0, dt_s);
+    sim->setTelemetryLogFile("");  // an empty name leaves the telemetry CSV closed
+    const auto model = sim->linearizeHover();
+    std::vector<drone::runtime::ActuatorFrame> frames(4096);
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        frames[i] = frameAt(i, model.hover_rpm);
+    }
+    const std::size_t frame_mask = frames.size() - 1;
+    volatile double sink = 0.0;
+
+    sim->start();
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < steps; ++i) {
+        sim->applyActuators(frames[i & frame_mask]);
+        sim->step(dt_s);
+        sink = sink + sim->readSensors().position_enu_z_m;
+    }
+    const double full_s = report("QuaroSimulation", steps, Clock::now() - start);
+    sim->stop();
+
+    drone::simulator::runtime::SurrogateVehicle surrogate(model, dt_s);
+    surrogate.reset(drone::Vector3(0.0, 0.0, 10.0));
+    start = Clock::now();
+    for (std::size_t i = 0; i < steps; ++i) {
+        surrogate.applyActuators(frames[i & frame_mask]);
+        surrogate.step();
+        sink = sink + surrogate.readSensors().position_enu_z_m;
+    }
+    const double surrogate_s = report("SurrogateVehicle", steps, Clock::now() - start);
+
+    std::cout << "  speedup: " << full_s / surrogate_s << "x\n";
+    return 0;
+}
@@ -0,0 +1,99 @@
+// Measures WindFieldSampler throughput on a synthetic 256 x 256 x 32 grid for a
+// swarm of vehicles flying smooth paths (mostly cache hits) and for random
+// positions (every sample a new cell).
+//
+// Usage: bench_wind_field [vehicles] [ticks]
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "simulator/environment/wind_field.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using drone::simulator::environment::WindField;
+using drone::simulator::environment::WindFieldSampler;
+using drone::simulator::environment::WindGridSpec;
+
+void report(const char* label, std::size_t samples, Clock::duration elapsed) {
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    std::cout << label << ": " << samples / seconds / 1e6 << " M samples/s ("
+              << seconds * 1e9 / samples << " ns/sample)\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t vehicles = argc >= 2 ? std::strtoull(argv[1], nullptr, 10) : 64;
+    const std::size_t ticks = argc >= 3 ? std::strtoull(argv[2], nullptr, 10) : 20000;
+
+    WindGridSpec spec;
+    spec.nx = 256;
+    spec.ny = 256;
+    spec.nz = 32;
+    spec.nt = 4;
+    spec.origin_enu_m = drone::Vector3(-1280.0, -1280.0, 0.0);
+    spec.spacing_m = drone::Vector3(10.0, 10.0, 5.0);
+    spec.slice_dt_s = 60.0;
+
+    std::vector<drone::Vector3> nodes(static_cast<std::size_t>(spec.nx) * spec.ny * spec.nz * spec.nt);
+    for (std::size_t n = 0; n < nodes.size(); ++n) {
+        nodes[n] = drone::Vector3(std::sin(n * 1e-3), std::cos(n * 7e-4), 0.1 * std::sin(n * 3e-3));
+    }
+    const std::filesystem::path file = std::filesystem::temp_directory_path() / "virtDrone_bench_wind.bin";
+    if (!WindField::write(file.string(), spec, nodes)) {
+        std::cerr << "failed to write " << file << std::endl;
+        return 1;
+    }
+    const auto field = WindField::open(file.string());
+
+    std::vector<WindFieldSampler> samplers(vehicles, WindFieldSampler(field));
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> xy(-1200.0, 1200.0);
+    std::uniform_real_distribution<double> z(0.0, 150.0);
+    std::vector<drone::Vector3> positions(vehicles);
+    for (auto& position : positions) {
+        position = drone::Vector3(xy(rng), xy(rng), z(rng));
+    }
+
+    const double dt_s = 0.01;
+    volatile double sink = 0.0;
+    auto start = Clock::now();
+    for (std::size_t tick = 0; tick < ticks; ++tick) {
+        for (std::size_t v = 0; v < vehicles; ++v) {
+            positions[v].x += 15.0 * dt_s;  // 15 m/s cruise
+            positions[v].y += 5.0 * dt_s;
+            sink = sink + samplers[v].sample(positions[v], tick * dt_s).x;
+        }
+    }
+    report("swarm paths", vehicles * ticks, Clock::now() - start);
+
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    for (const auto& sampler : samplers) {
+        hits += sampler.cacheHits();
+        misses += sampler.cacheMisses();
+    }
+    std::cout << "  cell cache hit rate: " << 100.0 * hits / (hits + misses) << "%\n";
+
+    WindFieldSampler random_sampler(field);
+    std::vector<drone::Vector3> random_positions(vehicles * ticks / 10);
+    for (auto& position : random_positions) {
+        position = drone::Vector3(xy(rng), xy(rng), z(rng));
+    }
+    const std::size_t random_samples = random_positions.size();
+    start = Clock::now();
+    for (const auto& position : random_positions) {
+        sink = sink + random_sampler.sample(position, 30.0).y;
+    }
+    report("random positions", random_samples, Clock::now() - start);
+
+    std::filesystem::remove(file);
+    return 0;
+}
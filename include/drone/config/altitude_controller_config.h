@@ -23,6 +23,9 @@ public:
     double position_hold_kd_vel = 2.0;
     double position_hold_max_velocity_mps = 20.0;
     double position_hold_max_tilt_rad = 1.3;
+    double position_hold_roll_gain_rad_per_m = 0.08;
+    double position_hold_roll_damping_rad_per_mps = 0.0;
+    double position_hold_roll_velocity_gain_rad_per_mps = 0.15;
 
 protected:
     bool loadFromYaml(const YAML::Node& yaml_config) override {
@@ -47,6 +50,11 @@ protected:
         readIfPresent(altitude_controller, "position_hold_kd_vel", position_hold_kd_vel);
         readIfPresent(altitude_controller, "position_hold_max_velocity_mps", position_hold_max_velocity_mps);
         readIfPresent(altitude_controller, "position_hold_max_tilt_rad", position_hold_max_tilt_rad);
+        readIfPresent(altitude_controller, "position_hold_roll_gain_rad_per_m", position_hold_roll_gain_rad_per_m);
+        readIfPresent(altitude_controller, "position_hold_roll_damping_rad_per_mps",
+                      position_hold_roll_damping_rad_per_mps);
+        readIfPresent(altitude_controller, "position_hold_roll_velocity_gain_rad_per_mps",
+                      position_hold_roll_velocity_gain_rad_per_mps);
         return true;
     }
 };
@@ -0,0 +1,70 @@
+#ifndef DRONE_CONTROL_TRAJECTORY_H
+#define DRONE_CONTROL_TRAJECTORY_H
+
+#include "drone/drone_data_types.h"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace drone::control {
+
+struct TrajectoryLimits {
+    double max_velocity_mps = 5.0;
+    double max_acceleration_mps2 = 2.0;
+};
+
+struct TrajectorySample {
+    Vector3 position_enu_m{0.0, 0.0, 0.0};
+    Vector3 velocity_enu_mps{0.0, 0.0, 0.0};
+    Vector3 acceleration_enu_mps2{0.0, 0.0, 0.0};
+    bool finished = false;  // past the last segment; holds the final waypoint at rest
+};
+
+/**
+ * @brief Piecewise quintic (minimum-jerk) trajectory through horizontal waypoints.
+ *
+ * Planned once: each segment's duration is stretched until its sampled speed and
+ * acceleration stay within the limits. Evaluation is Horner's rule on the precomputed
+ * position, velocity and acceleration coefficients; with a segment cursor and
+ * non-decreasing time it is O(1) per call. z is carried through but not used by RealDrone.
+ */
+class MinimumJerkTrajectory {
+public:
+    /**
+     * @param waypoints positions to pass through; the first is the start
+     * @param start_velocity_enu_mps velocity at the start; the trajectory ends at rest
+     */
+    static MinimumJerkTrajectory plan(const std::vector<Vector3>& waypoints,
+                                      const Vector3& start_velocity_enu_mps,
+                                      const TrajectoryLimits& limits);
+
+    double duration() const { return duration_s_; }
+    std::size_t segmentCount() const { return segments_.size(); }
+    const Vector3& endPosition() const { return end_position_enu_m_; }
+
+    // segment_cursor caches the current segment between calls; start it at 0
+    TrajectorySample sample(double t_s, std::size_t& segment_cursor) const;
+    TrajectorySample sample(double t_s) const;
+
+private:
+    struct Segment {
+        double start_time_s = 0.0;
+        double duration_s = 0.0;
+        // per axis, lowest order first
+        std::array<std::array<double, 6>, 3> position{};
+        std::array<std::array<double, 5>, 3> velocity{};
+        std::array<std::array<double, 4>, 3> acceleration{};
+    };
+
+    static Segment makeSegment(const Vector3& p0, const Vector3& v0, const Vector3& p1, const Vector3& v1,
+                               double duration_s);
+
+    std::vector<Segment> segments_;
+    double duration_s_ = 0.0;
+    Vector3 end_position_enu_m_{0.0, 0.0, 0.0};
+};
+
+}  // namespace drone::control
+
+#endif  // DRONE_CONTROL_TRAJECTORY_H
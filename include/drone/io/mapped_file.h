@@ -0,0 +1,42 @@
+#ifndef DRONE_IO_MAPPED_FILE_H
+#define DRONE_IO_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace drone::io {
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * Processes mapping the same file share its pages through the OS page cache.
+ * On platforms without mmap the file is read into memory instead.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    bool open(const std::string& file_path);
+    void close();
+
+    bool isOpen() const { return data_ != nullptr; }
+    const unsigned char* data() const { return data_; }
+    std::size_t size() const { return size_; }
+
+private:
+    const unsigned char* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool mapped_ = false;
+    std::vector<unsigned char> buffer_;
+};
+
+}  // namespace drone::io
+
+#endif  // DRONE_IO_MAPPED_FILE_H
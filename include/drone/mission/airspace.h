@@ -0,0 +1,165 @@
+#ifndef DRONE_MISSION_AIRSPACE_H
+#define DRONE_MISSION_AIRSPACE_H
+
+#include "drone/drone_data_types.h"
+#include "drone/mission/mission_image.h"
+#include "drone/mission/mission_types.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace drone::mission {
+
+enum class AirspaceVolumeKind {
+    NO_FLY_ZONE,
+    OBSTACLE,
+};
+
+/**
+ * @brief Keep-out prism: a simple polygon footprint (ENU x/y) extruded from floor to ceiling.
+ *
+ * Box obstacles are stored as four-vertex footprints so every volume is tested the same way.
+ */
+struct AirspaceVolume {
+    std::string name;
+    AirspaceVolumeKind kind = AirspaceVolumeKind::NO_FLY_ZONE;
+    std::vector<Vector3> footprint_enu_m;  // z ignored
+    double floor_m = 0.0;
+    double ceiling_m = 0.0;
+};
+
+// At least three footprint vertices and a ceiling not below the floor; nullptr when valid
+const char* airspaceVolumeProblem(const AirspaceVolume& volume);
+
+struct AirspaceHit {
+    std::size_t volume_index = 0;
+    double segment_t = 0.0;  // 0 at the segment start, 1 at its end
+    Vector3 point_enu_m{0.0, 0.0, 0.0};
+};
+
+// Work counters; callers accumulate them across queries
+struct AirspaceQueryStats {
+    std::uint64_t queries = 0;
+    std::uint64_t nodes_visited = 0;
+    std::uint64_t volumes_tested = 0;
+};
+
+/**
+ * @brief Bounding-volume hierarchy over keep-out volumes.
+ *
+ * Built once (median split on the longest centroid axis) into a flat node array; queries
+ * are read-only, so one index can be shared by any number of vehicles. Volumes keep the
+ * index they were given in; invalid ones (see airspaceVolumeProblem) are never hit, and
+ * AirspaceLoader rejects them before they get here.
+ */
+class AirspaceIndex {
+public:
+    explicit AirspaceIndex(std::vector<AirspaceVolume> volumes);
+
+    // First volume containing the point, or nullptr
+    const AirspaceVolume* findContaining(const Vector3& point_enu_m,
+                                         AirspaceQueryStats* stats = nullptr) const;
+    // Earliest entry along start -> end; a start point already inside is a hit at t = 0
+    bool findFirstHit(const Vector3& start_enu_m,
+                      const Vector3& end_enu_m,
+                      AirspaceHit& hit_out,
+                      AirspaceQueryStats* stats = nullptr) const;
+
+    std::size_t volumeCount() const { return volumes_.size(); }
+    std::size_t nodeCount() const { return nodes_.size(); }
+    const AirspaceVolume& volume(std::size_t index) const { return volumes_[index]; }
+
+private:
+    struct Bounds {
+        std::array<double, 3> min{};
+        std::array<double, 3> max{};
+    };
+    struct Node {
+        Bounds bounds;
+        std::uint32_t first = 0;  // first child (interior) or first entry in order_ (leaf)
+        std::uint32_t count = 0;  // 0 for interior nodes
+    };
+
+    std::uint32_t build(std::uint32_t begin, std::uint32_t end);
+
+    std::vector<AirspaceVolume> volumes_;
+    std::vector<Bounds> volume_bounds_;
+    std::vector<std::uint32_t> order_;
+    std::vector<Node> nodes_;
+};
+
+struct AirspaceLegConflict {
+    int step_id = 0;
+    AirspaceHit hit;
+};
+
+/**
+ * @brief Check every enabled GO_TO_POSITION leg of a mission against the index.
+ *
+ * Legs start at the initial conditions and follow the altitude set by preceding hover,
+ * change_altitude and land steps. AGL legs are checked at their nominal altitude because
+ * the terrain is not known on the vehicle side. The legs are shifted by `overrides` the way
+ * MissionExecutor shifts the targets, starting from the initial position plus the XY offset.
+ */
+std::vector<AirspaceLegConflict> checkMissionLegs(const MissionImage& mission,
+                                                  const AirspaceIndex& index,
+                                                  const MissionOverrides& overrides = {},
+                                                  AirspaceQueryStats* stats = nullptr,
+                                                  std::size_t* legs_checked = nullptr);
+
+// Load-time error for the first conflict, e.g. "go_to_position step_id=3 enters obstacle 'Wall' at (...)"
+std::string describeLegConflicts(const AirspaceIndex& index, const std::vector<AirspaceLegConflict>& conflicts);
+
+// Cost of building the index and checking a mission's legs when it is loaded
+struct AirspaceLoadProfile {
+    std::size_t volumes = 0;
+    std::size_t nodes = 0;
+    std::size_t legs_checked = 0;
+    AirspaceQueryStats stats;
+    double build_time_s = 0.0;
+    double check_time_s = 0.0;
+};
+
+struct AirspaceTickResult {
+    bool hit = false;      // the segment swept since the last update touched a volume
+    bool entered = false;  // hit, and the previous update was clear
+    bool cleared = false;  // clear now, and the previous update was not
+    AirspaceHit first_hit;
+};
+
+/**
+ * @brief Per-tick airspace check of one vehicle against a shared index.
+ *
+ * Tests the segment swept since the previous update, so a fast vehicle cannot step
+ * over a thin obstacle between ticks, and keeps timing for the phase profile.
+ */
+class AirspaceMonitor {
+public:
+    explicit AirspaceMonitor(std::shared_ptr<const AirspaceIndex> index);
+
+    AirspaceTickResult update(const Vector3& position_enu_m);
+    void reset() { has_previous_ = false; previously_hit_ = false; }
+
+    const AirspaceQueryStats& stats() const { return stats_; }
+    double totalQueryTimeS() const { return total_query_time_s_; }
+    double maxQueryTimeS() const { return max_query_time_s_; }
+
+private:
+    std::shared_ptr<const AirspaceIndex> index_;
+    Vector3 previous_position_enu_m_{0.0, 0.0, 0.0};
+    bool has_previous_ = false;
+    bool previously_hit_ = false;
+    AirspaceQueryStats stats_;
+    double total_query_time_s_ = 0.0;
+    double max_query_time_s_ = 0.0;
+};
+
+std::string airspaceVolumeKindToString(AirspaceVolumeKind kind);
+
+}  // namespace drone::mission
+
+#endif  // DRONE_MISSION_AIRSPACE_H
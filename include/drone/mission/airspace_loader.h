@@ -0,0 +1,20 @@
+#ifndef DRONE_MISSION_AIRSPACE_LOADER_H
+#define DRONE_MISSION_AIRSPACE_LOADER_H
+
+#include <string>
+#include <vector>
+
+#include "drone/mission/airspace.h"
+
+namespace drone::mission {
+
+class AirspaceLoader {
+public:
+    bool loadFromFile(const std::string& file_path,
+                      std::vector<AirspaceVolume>& volumes_out,
+                      std::string* error_out = nullptr) const;
+};
+
+}  // namespace drone::mission
+
+#endif  // DRONE_MISSION_AIRSPACE_LOADER_H
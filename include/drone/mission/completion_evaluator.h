@@ -1,6 +1,7 @@
 #ifndef DRONE_MISSION_COMPLETION_EVALUATOR_H
 #define DRONE_MISSION_COMPLETION_EVALUATOR_H
 
+#include "drone/mission/completion_predicate.h"
 #include "drone/mission/mission_types.h"
 
 namespace drone::runtime {
@@ -13,9 +14,15 @@ class CompletionEvaluator {
 public:
     CompletionEvaluator();
 
+    // Compiles the criteria on every call; prefer the CompletionPredicate overload per tick
     bool isMet(const CompletionCriteria& criteria,
                const runtime::SensorFrame& sensor_frame,
                double dt_s);
+    bool isMet(const CompletionPredicate& predicate,
+               const runtime::SensorFrame& sensor_frame,
+               double dt_s);
+    // Hold timer step for a condition tested elsewhere, e.g. by testCompletionPredicateBatch
+    bool accumulate(bool condition_satisfied, double hold_duration_s, double dt_s);
 
     double getHoldProgress() const { return hold_duration_s_; }
 
@@ -0,0 +1,86 @@
+#ifndef DRONE_MISSION_COMPLETION_PREDICATE_H
+#define DRONE_MISSION_COMPLETION_PREDICATE_H
+
+#include "drone/mission/mission_types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace drone::runtime {
+struct SensorFrame;
+}
+
+namespace drone::mission {
+
+// SensorFrame field the altitude band of a CompletionPredicate is tested against
+enum class CompletionAltitudeChannel : std::uint32_t {
+    ALTITUDE_M,
+    POSITION_ENU_Z_M,
+    ALTITUDE_AGL_M,
+};
+
+/**
+ * @brief CompletionCriteria compiled to plain threshold tests.
+ *
+ * Every condition type reduces to one conjunction: an altitude band, a squared horizontal
+ * distance, a squared speed and three angle errors. Tests a condition type does not use get
+ * infinite bounds, so evaluation has no per-type dispatch and no square roots.
+ */
+struct CompletionPredicate {
+    std::uint32_t altitude_channel = 0;  // CompletionAltitudeChannel
+    std::uint32_t reserved = 0;
+    double altitude_min_m = -std::numeric_limits<double>::infinity();
+    double altitude_max_m = std::numeric_limits<double>::infinity();
+    double target_x_m = 0.0;
+    double target_y_m = 0.0;
+    double position_tolerance_sq_m2 = std::numeric_limits<double>::infinity();
+    double max_speed_sq_m2ps2 = std::numeric_limits<double>::infinity();
+    double target_yaw_rad = 0.0;
+    double yaw_tolerance_rad = std::numeric_limits<double>::infinity();
+    double target_pitch_rad = 0.0;
+    double pitch_tolerance_rad = std::numeric_limits<double>::infinity();
+    double target_roll_rad = 0.0;
+    double roll_tolerance_rad = std::numeric_limits<double>::infinity();
+    double hold_duration_s = 0.0;
+};
+
+CompletionPredicate compileCompletionCriteria(const CompletionCriteria& criteria);
+
+// Instantaneous check; the hold timer lives in CompletionEvaluator
+bool testCompletionPredicate(const CompletionPredicate& predicate, const runtime::SensorFrame& sensor_frame);
+
+/**
+ * @brief The SensorFrame fields completion predicates read, one column per field and one row per vehicle.
+ */
+struct CompletionFrameBatch {
+    std::vector<double> altitude_m;
+    std::vector<double> position_enu_z_m;
+    std::vector<double> altitude_agl_m;
+    std::vector<double> position_enu_x_m;
+    std::vector<double> position_enu_y_m;
+    std::vector<double> velocity_north_mps;
+    std::vector<double> velocity_east_mps;
+    std::vector<double> velocity_down_mps;
+    std::vector<double> yaw_rad;
+    std::vector<double> pitch_rad;
+    std::vector<double> roll_rad;
+
+    void resize(std::size_t vehicle_count);
+    std::size_t size() const { return altitude_m.size(); }
+    void set(std::size_t vehicle, const runtime::SensorFrame& sensor_frame);
+};
+
+/**
+ * @brief Test one predicate against every row of a batch in a single branch-free loop.
+ *
+ * met_out[i] is 1 when vehicle i satisfies the predicate; it must hold batch.size() entries.
+ */
+void testCompletionPredicateBatch(const CompletionPredicate& predicate,
+                                  const CompletionFrameBatch& batch,
+                                  std::uint8_t* met_out);
+
+}  // namespace drone::mission
+
+#endif  // DRONE_MISSION_COMPLETION_PREDICATE_H
@@ -0,0 +1,66 @@
+#ifndef DRONE_MISSION_FLEET_SCHEDULER_H
+#define DRONE_MISSION_FLEET_SCHEDULER_H
+
+#include "drone/mission/mission_executor.h"
+#include "drone/mission/mission_types.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace drone::runtime {
+class RealDrone;
+struct SensorFrame;
+}
+
+namespace drone::mission {
+
+/**
+ * @brief Runs one immutable mission on many vehicles.
+ *
+ * The mission is compiled once into a MissionImage shared by pointer. Each vehicle gets its own
+ * MissionExecutor, which holds only step state and its MissionOverrides. update()
+ * steps every executor in one loop over contiguous storage. Vehicles bypass
+ * RealDrone::loadMission, so start() checks every vehicle's shifted legs against the
+ * mission's airspace itself and refuses to run when one crosses it.
+ */
+class FleetMissionScheduler {
+public:
+    explicit FleetMissionScheduler(const std::shared_ptr<const Mission>& mission);
+    explicit FleetMissionScheduler(std::shared_ptr<const MissionImage> image);
+
+    // The drone must outlive the scheduler; returns the vehicle index
+    std::size_t addVehicle(runtime::RealDrone& drone, const MissionOverrides& overrides = {});
+    void reserve(std::size_t vehicle_count);
+    // Loads the mission's airspace_file once and rejects the first vehicle whose legs, shifted by
+    // its MissionOverrides, cross it; true without one
+    bool checkAirspace(std::string* error_out = nullptr) const;
+
+    // false, with nothing started, when checkAirspace() fails
+    bool start(std::string* error_out = nullptr);
+    // sensor_frames[i] belongs to vehicle i; vehicles still waiting for start_delay_s are skipped
+    void update(const runtime::SensorFrame* sensor_frames, double dt_s);
+
+    std::size_t vehicleCount() const { return executors_.size(); }
+    const MissionExecutor& executor(std::size_t vehicle) const { return executors_[vehicle]; }
+    std::size_t activeCount() const { return active_count_; }
+    // True once every vehicle has started and finished (completed, aborted or failed)
+    bool isFinished() const;
+    double getElapsedTime() const { return elapsed_time_s_; }
+    const std::shared_ptr<const MissionImage>& getMissionImage() const { return image_; }
+
+private:
+    std::shared_ptr<const MissionImage> image_;
+    std::vector<MissionExecutor> executors_;
+    std::vector<runtime::RealDrone*> drones_;
+    std::vector<double> start_time_s_;
+    std::vector<bool> started_;
+    double elapsed_time_s_ = 0.0;
+    std::size_t active_count_ = 0;
+    bool running_ = false;
+};
+
+}  // namespace drone::mission
+
+#endif  // DRONE_MISSION_FLEET_SCHEDULER_H
@@ -2,9 +2,21 @@
 #define DRONE_MISSION_MISSION_EXECUTOR_H
 
 #include "drone/mission/completion_evaluator.h"
+#include "drone/mission/mission_image.h"
+#include "drone/mission/mission_program.h"
+#include "drone/mission/mission_stream.h"
+#include "drone/mission/mission_triggers.h"
 #include "drone/mission/mission_types.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace drone::control {
+class MinimumJerkTrajectory;
+}
 
 namespace drone::runtime {
 class RealDrone;
@@ -22,9 +34,25 @@ enum class MissionStatus {
     FAILED,
 };
 
+constexpr std::size_t kDefaultMissionStreamWindow = 32;
+
 class MissionExecutor {
 public:
+    // Compiles the mission into a private MissionImage
     void loadMission(const Mission& mission);
+    // Runs a compiled or mapped image in place; one image can back any number of executors.
+    // An image with a program runs its steps as the program's VM selects them.
+    void loadMission(std::shared_ptr<const MissionImage> image);
+    // Streaming mode: at most window_steps upcoming steps are held; the source is single-pass,
+    // so a streamed mission cannot be restarted
+    void loadMission(std::unique_ptr<MissionStepSource> source,
+                     std::size_t window_steps = kDefaultMissionStreamWindow);
+    void setOverrides(const MissionOverrides& overrides);
+    // Upper bound on program instructions executed per update()
+    void setProgramBudget(std::size_t instructions_per_tick);
+    const MissionOverrides& getOverrides() const { return overrides_; }
+    // Step actions are applied once on step entry; this applies the current one again on the next update()
+    void reapplyCurrentStep();
     void start();
     void update(runtime::RealDrone& drone,
                 const runtime::SensorFrame& sensor_frame,
@@ -39,15 +67,70 @@ public:
     std::string getCurrentStepTargetDescription() const;
     double getStepElapsedTime() const { return step_elapsed_time_s_; }
     double getTotalElapsedTime() const { return total_elapsed_time_s_; }
-    bool isMissionLoaded() const { return mission_ != nullptr; }
+    bool isMissionLoaded() const { return image_ != nullptr || stream_ != nullptr; }
+    bool isStreaming() const { return stream_ != nullptr; }
+    bool hasProgram() const { return program_size_ > 0; }
+    const MissionVm& getProgramVm() const { return vm_; }
+    // Mission triggers fired since start(), and the most recent one (-1 / empty before any fires)
+    std::uint64_t getFiredTriggerCount() const { return fired_trigger_count_; }
+    int getLastTriggerIndex() const { return last_trigger_index_; }
+    std::string getLastTriggerName() const;
+    const std::shared_ptr<const MissionImage>& getMissionImage() const { return image_; }
+    // Streaming mode: steps buffered now (current one included) and pulled from the source so far
+    std::size_t getStreamWindowSize() const { return window_size_; }
+    std::size_t getStreamedStepCount() const { return streamed_step_count_; }
+    // Upcoming step `ahead` steps after the current one, nullptr beyond the end or the window
+    const FlatMissionStep* peekStep(std::size_t ahead) const;
+    // SetpointUpdate batches handed to the drone since the mission was loaded or started
+    std::uint64_t getSetpointUpdateCount() const { return setpoint_update_count_; }
 
 private:
     void applyCurrentStepAction(runtime::RealDrone& drone,
                                 const runtime::SensorFrame& sensor_frame);
     void advanceToNextStep();
     void handleStepTimeout();
+    void resetRunState();
+    const FlatMissionStep* currentStep() const;
+    void refillStreamWindow();
+    void runProgram(const runtime::SensorFrame& sensor_frame);
+    const CompletionPredicate* currentPredicate() const;
+    void fireTrigger(int trigger_index);
+    double terrainFollowingAltitude(const FlatMissionAction& action,
+                                    const runtime::SensorFrame& sensor_frame) const;
+    std::shared_ptr<const control::MinimumJerkTrajectory> planLegTrajectory(
+        const FlatMissionAction& action, const runtime::SensorFrame& sensor_frame) const;
+
+    struct StreamedStep {
+        FlatMissionStep step;
+        CompletionPredicate predicate;
+        std::string name;
+    };
 
-    const Mission* mission_ = nullptr;
+    std::shared_ptr<const MissionImage> image_;
+    const FlatMissionStep* steps_ = nullptr;
+    const CompletionPredicate* predicates_ = nullptr;  // parallel to steps_
+    size_t step_count_ = 0;
+    // streaming mode: ring buffer of upcoming steps, front is the current step
+    std::unique_ptr<MissionStepSource> stream_;
+    std::vector<StreamedStep> window_;
+    size_t window_head_ = 0;
+    size_t window_size_ = 0;
+    size_t streamed_step_count_ = 0;
+    bool stream_exhausted_ = false;
+    // program mode: the VM picks current_step_index_; pending while it has not chosen the next step
+    const MissionInstruction* program_ = nullptr;
+    size_t program_size_ = 0;
+    MissionVm vm_;
+    size_t program_budget_ = kDefaultMissionVmBudget;
+    bool program_pending_ = false;
+    bool program_running_ = false;  // cleared when a trigger jumps out of the program
+    // triggers of the image, checked every tick before the step
+    const MissionTriggerTable* triggers_ = nullptr;
+    MissionTriggerMonitor trigger_monitor_;
+    int last_trigger_index_ = -1;
+    std::uint64_t fired_trigger_count_ = 0;
+    MissionOverrides overrides_;
+    bool has_overrides_ = false;
     MissionStatus status_ = MissionStatus::IDLE;
     size_t current_step_index_ = 0;
 
@@ -56,9 +139,10 @@ private:
 
     CompletionEvaluator completion_evaluator_;
     int step_retry_count_ = 0;
-    bool hover_reference_initialized_ = false;
-    double hover_reference_x_m_ = 0.0;
-    double hover_reference_y_m_ = 0.0;
+    // setpoints are sent on step entry; only terrain following updates them within a step
+    bool action_applied_ = false;
+    double last_altitude_setpoint_m_ = 0.0;
+    std::uint64_t setpoint_update_count_ = 0;
 };
 
 }  // namespace drone::mission
@@ -0,0 +1,145 @@
+#ifndef DRONE_MISSION_MISSION_IMAGE_H
+#define DRONE_MISSION_MISSION_IMAGE_H
+
+#include "drone/io/mapped_file.h"
+#include "drone/mission/completion_predicate.h"
+#include "drone/mission/mission_types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace drone::mission {
+
+constexpr std::uint32_t kMissionImageVersion = 3;
+
+// Action parameters; which fields are used depends on the step's action_type
+struct FlatMissionAction {
+    double target_x_m = 0.0;
+    double target_y_m = 0.0;
+    double target_altitude_m = 0.0;
+    double yaw_rad = 0.0;
+    double pitch_rad = 0.0;
+    double roll_rad = 0.0;
+    double max_tilt_rad = 0.0;
+    double max_velocity_mps = 0.0;
+    double rate_mps = 0.0;  // change_altitude rate or land descent rate
+};
+
+/**
+ * @brief Fixed-layout step record, read in place from a mapped image.
+ *
+ * Enums are stored as their integer values and strings as offsets into the image's
+ * string table.
+ */
+struct FlatMissionStep {
+    std::int32_t step_id = 0;
+    std::uint32_t name_offset = 0;
+    std::int32_t action_type = 0;       // ActionType
+    std::int32_t advance_mode = 0;      // AdvanceMode
+    std::int32_t timeout_behavior = 0;  // TimeoutBehavior
+    std::int32_t fallback_step_id = -1;
+    std::int32_t retry_count = 0;
+    std::uint8_t enabled = 1;
+    std::uint8_t altitude_agl = 0;  // go_to_position altitude_mode == "agl"
+    std::uint8_t has_action = 1;
+    std::uint8_t min_jerk_trajectory = 0;  // go_to_position trajectory == "min_jerk"
+    double duration_s = 0.0;
+    double timeout_s = 60.0;
+    FlatMissionAction action;
+    CompletionCriteria completion_criteria;
+
+    ActionType actionType() const { return static_cast<ActionType>(action_type); }
+    AdvanceMode advanceMode() const { return static_cast<AdvanceMode>(advance_mode); }
+    TimeoutBehavior timeoutBehavior() const { return static_cast<TimeoutBehavior>(timeout_behavior); }
+};
+
+struct MissionImageHeader {
+    char magic[8] = {'V', 'D', 'M', 'I', 'S', 'S', 'N', '\0'};
+    std::uint32_t version = kMissionImageVersion;
+    std::uint32_t step_size = sizeof(FlatMissionStep);  // rejects images from builds with another layout
+    std::uint32_t step_count = 0;
+    std::uint32_t string_table_size = 0;
+    std::uint32_t instruction_count = 0;  // mission program; 0 runs the steps in order
+    std::uint32_t trigger_count = 0;
+    std::uint64_t steps_offset = 0;
+    std::uint64_t instructions_offset = 0;
+    std::uint64_t triggers_offset = 0;
+    std::uint64_t strings_offset = 0;
+    std::uint32_t name_offset = 0;
+    std::uint32_t description_offset = 0;
+    std::uint32_t version_string_offset = 0;
+    std::uint32_t airspace_file_offset = 0;  // relative paths are relative to the image file
+    double max_duration_s = 0.0;
+    double initial_altitude_m = 0.0;
+    double initial_x_m = 0.0;
+    double initial_y_m = 0.0;
+    double initial_yaw_rad = 0.0;
+    double initial_battery_soc_percent = 100.0;
+};
+
+static_assert(std::is_trivially_copyable<FlatMissionStep>::value, "mission image steps are mapped in place");
+static_assert(std::is_trivially_copyable<MissionImageHeader>::value, "mission image header is mapped in place");
+
+/**
+ * @brief Compiled mission: header, flat step array, program bytecode, triggers and string table in one buffer.
+ *
+ * Built from a parsed Mission (fromMission) or mapped from a file written by
+ * mission_compile (open). Opening checks the header, bounds and enum ranges once;
+ * after that MissionExecutor reads the steps straight from the mapping.
+ */
+class MissionImage {
+public:
+    static std::shared_ptr<const MissionImage> fromMission(const Mission& mission);
+    static std::shared_ptr<const MissionImage> open(const std::string& file_path, std::string* error_out = nullptr);
+    // Cheap magic check, used to tell compiled images from YAML missions
+    static bool isImageFile(const std::string& file_path);
+
+    bool write(const std::string& file_path, std::string* error_out = nullptr) const;
+
+    const MissionImageHeader& header() const { return *reinterpret_cast<const MissionImageHeader*>(data_); }
+    std::size_t stepCount() const { return header().step_count; }
+    const FlatMissionStep* steps() const { return steps_; }
+    const FlatMissionStep& step(std::size_t index) const { return steps_[index]; }
+    std::size_t instructionCount() const { return header().instruction_count; }
+    const MissionInstruction* instructions() const { return instructions_; }
+    std::size_t triggerCount() const { return header().trigger_count; }
+    const FlatMissionTrigger* triggers() const { return triggers_; }
+    const MissionTriggerTable& triggerTable() const { return trigger_table_; }
+    // Completion criteria of each step, compiled once when the image is built or opened
+    const CompletionPredicate* completionPredicates() const { return predicates_.data(); }
+    // NUL-terminated string from the string table
+    const char* string(std::uint32_t offset) const { return strings_ + offset; }
+
+    std::string name() const { return string(header().name_offset); }
+    const std::string& airspaceFile() const { return airspace_file_; }
+    InitialConditions initialConditions() const;
+
+    std::size_t sizeBytes() const { return size_; }
+
+private:
+    MissionImage() = default;
+    bool attach(const unsigned char* data, std::size_t size, std::string* error_out);
+
+    io::MappedFile file_;
+    std::vector<std::uint64_t> buffer_;  // 8-byte aligned storage for images built in memory
+    const unsigned char* data_ = nullptr;
+    std::size_t size_ = 0;
+    const FlatMissionStep* steps_ = nullptr;
+    const MissionInstruction* instructions_ = nullptr;
+    const FlatMissionTrigger* triggers_ = nullptr;
+    const char* strings_ = nullptr;
+    std::string airspace_file_;
+    std::vector<CompletionPredicate> predicates_;
+    MissionTriggerTable trigger_table_;
+};
+
+// Target text for log lines, matching MissionAction::getDescription
+std::string describeFlatAction(const FlatMissionStep& step);
+
+}  // namespace drone::mission
+
+#endif  // DRONE_MISSION_MISSION_IMAGE_H
@@ -0,0 +1,148 @@
+#ifndef DRONE_MISSION_MISSION_PATTERNS_H
+#define DRONE_MISSION_MISSION_PATTERNS_H
+
+#include "drone/drone_data_types.h"
+#include "drone/mission/mission_stream.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace drone::mission {
+
+// Parameters shared by every go_to_position leg a pattern generates
+struct PatternLegConfig {
+    int first_step_id = 1;
+    double altitude_m = 20.0;
+    double max_velocity_mps = 10.0;
+    double max_tilt_rad = 0.5;
+    double position_tolerance_m = 2.0;
+    double altitude_tolerance_m = 1.0;
+    double hold_duration_s = 0.0;
+    double timeout_s = 60.0;
+    TimeoutBehavior timeout_behavior = TimeoutBehavior::PROCEED;
+};
+
+/**
+ * @brief Base for generators that expand a geometric pattern into go_to_position steps.
+ *
+ * Waypoints are computed from their index when the executor asks for them, so a pattern
+ * of any size costs the same few bytes of state.
+ */
+class WaypointPatternSource : public MissionStepSource {
+public:
+    WaypointPatternSource(std::string pattern_name, const PatternLegConfig& leg);
+
+    bool next(FlatMissionStep& step_out, std::string& name_out) override;
+
+    virtual std::size_t waypointCount() const = 0;
+    // ENU x/y of waypoint index (z unused)
+    virtual Vector3 waypoint(std::size_t index) const = 0;
+
+private:
+    std::string pattern_name_;
+    PatternLegConfig leg_;
+    std::size_t cursor_ = 0;
+};
+
+/**
+ * @brief Boustrophedon coverage of a rectangle.
+ *
+ * Lanes run along the heading from origin_enu_m, spaced lane_spacing_m apart across it,
+ * alternating direction; two waypoints per lane.
+ */
+struct LawnmowerConfig {
+    Vector3 origin_enu_m{0.0, 0.0, 0.0};
+    double length_m = 100.0;  // along heading_rad
+    double width_m = 100.0;   // across, to the left of the heading
+    double lane_spacing_m = 10.0;
+    double heading_rad = 0.0;  // 0 = lanes along +x (east)
+};
+
+class LawnmowerPattern : public WaypointPatternSource {
+public:
+    LawnmowerPattern(const LawnmowerConfig& config, const PatternLegConfig& leg);
+
+    std::size_t waypointCount() const override { return 2 * lane_count_; }
+    Vector3 waypoint(std::size_t index) const override;
+
+private:
+    LawnmowerConfig config_;
+    std::size_t lane_count_ = 0;
+    double cos_heading_ = 1.0;
+    double sin_heading_ = 0.0;
+};
+
+// Archimedean spiral from start_radius_m outwards (or inwards) to end_radius_m
+struct SpiralConfig {
+    Vector3 center_enu_m{0.0, 0.0, 0.0};
+    double start_radius_m = 5.0;
+    double end_radius_m = 50.0;
+    double radius_step_per_turn_m = 10.0;
+    std::size_t points_per_turn = 16;
+    double start_angle_rad = 0.0;
+};
+
+class SpiralPattern : public WaypointPatternSource {
+public:
+    SpiralPattern(const SpiralConfig& config, const PatternLegConfig& leg);
+
+    std::size_t waypointCount() const override { return point_count_; }
+    Vector3 waypoint(std::size_t index) const override;
+
+private:
+    SpiralConfig config_;
+    std::size_t point_count_ = 0;
+    double radius_step_per_point_m_ = 0.0;
+};
+
+// Circle of radius_m around center_enu_m, counter-clockwise unless clockwise is set
+struct OrbitConfig {
+    Vector3 center_enu_m{0.0, 0.0, 0.0};
+    double radius_m = 30.0;
+    double turns = 1.0;
+    std::size_t points_per_turn = 16;
+    double start_angle_rad = 0.0;
+    bool clockwise = false;
+};
+
+class OrbitPattern : public WaypointPatternSource {
+public:
+    OrbitPattern(const OrbitConfig& config, const PatternLegConfig& leg);
+
+    std::size_t waypointCount() const override { return point_count_; }
+    Vector3 waypoint(std::size_t index) const override;
+
+private:
+    OrbitConfig config_;
+    std::size_t point_count_ = 0;
+};
+
+enum class PatternType {
+    LAWNMOWER,
+    SPIRAL,
+    ORBIT
+};
+
+// `pattern:` section of a mission file: generated legs streamed after one of the fixed steps
+struct MissionPatternSpec {
+    PatternType type = PatternType::LAWNMOWER;
+    int after_step_id = 0;        // 0 = after the last fixed step
+    std::size_t window_steps = 0;  // 0 = kDefaultMissionStreamWindow
+    PatternLegConfig leg;
+    LawnmowerConfig lawnmower;
+    SpiralConfig spiral;
+    OrbitConfig orbit;
+};
+
+std::unique_ptr<WaypointPatternSource> makePatternSource(const MissionPatternSpec& spec);
+
+// Fixed steps up to after_step_id, the generated legs, then the remaining fixed steps
+std::unique_ptr<MissionStepSource> makeMissionPatternStream(std::shared_ptr<const MissionImage> image,
+                                                            const MissionPatternSpec& spec);
+
+bool parsePatternType(const std::string& text, PatternType& type_out);
+
+}  // namespace drone::mission
+
+#endif  // DRONE_MISSION_MISSION_PATTERNS_H
@@ -0,0 +1,149 @@
+#ifndef DRONE_MISSION_MISSION_PROGRAM_H
+#define DRONE_MISSION_MISSION_PROGRAM_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace drone::runtime {
+struct SensorFrame;
+}
+
+namespace drone::mission {
+
+constexpr std::size_t kMaxMissionVariables = 16;  // named variables plus one hidden counter per repeat block
+constexpr std::size_t kDefaultMissionVmBudget = 64;  // instructions per tick
+
+enum class MissionOpcode : std::uint8_t {
+    RUN_STEP,  // target = step index; suspends until the step completes
+    SET,       // variables[target] = rhs
+    ADD,       // variables[target] += rhs
+    JUMP,      // pc = target
+    JUMP_IF,   // if (lhs compare rhs) pc = target
+    DONE,
+    ABORT,
+};
+
+enum class MissionOperandKind : std::uint8_t {
+    LITERAL,
+    VARIABLE,
+    SENSOR_FIELD,
+};
+
+enum class MissionCompare : std::uint8_t {
+    LT,
+    LE,
+    GT,
+    GE,
+    EQ,
+    NE,
+};
+
+// SensorFrame fields a program can branch on
+enum class MissionSensorField : std::uint8_t {
+    ALTITUDE_M,
+    ALTITUDE_AGL_M,
+    POSITION_ENU_X_M,
+    POSITION_ENU_Y_M,
+    POSITION_ENU_Z_M,
+    GPS_ALTITUDE_M,
+    GPS_VELOCITY_NORTH_MPS,
+    GPS_VELOCITY_EAST_MPS,
+    GPS_VELOCITY_DOWN_MPS,
+    BATTERY_VOLTAGE_V,
+    BATTERY_SOC_PERCENT,
+    MOTOR_TEMPERATURE_C,
+    MOTOR_RPM,
+    YAW_RAD,
+    PITCH_RAD,
+    ROLL_RAD,
+    AIRSPACE_BREACH,
+};
+
+struct MissionOperand {
+    double value = 0.0;  // LITERAL
+    std::uint8_t kind = 0;   // MissionOperandKind
+    std::uint8_t index = 0;  // variable slot or MissionSensorField
+    std::uint8_t reserved[6] = {};
+};
+
+// Fixed-size instruction, stored as-is in mission images
+struct MissionInstruction {
+    std::uint8_t opcode = 0;   // MissionOpcode
+    std::uint8_t compare = 0;  // MissionCompare, JUMP_IF only
+    std::uint16_t reserved = 0;
+    std::uint32_t target = 0;
+    MissionOperand lhs;
+    MissionOperand rhs;
+};
+
+static_assert(std::is_trivially_copyable<MissionInstruction>::value, "mission programs are mapped in place");
+
+/**
+ * @brief Compile mission program text to bytecode.
+ *
+ * One statement per line, `#` starts a comment:
+ *   run <step_id>                     execute a step from the mission's step table
+ *   set <var> <value> / add <var> <value>
+ *   if <value> <op> <value> goto <label>   op: < <= > >= == !=
+ *   goto <label> / <label>:
+ *   repeat <count> ... end            blocks may nest
+ *   done / abort
+ * A value is a number, a variable or a SensorFrame field name (e.g. battery_soc_percent).
+ *
+ * @param step_ids step_id of each entry in the step table, in order
+ */
+bool compileMissionProgram(const std::string& source,
+                           const std::vector<int>& step_ids,
+                           std::vector<MissionInstruction>& code_out,
+                           std::string* error_out = nullptr);
+
+// Structural check for bytecode read from a file
+bool validateMissionProgram(const MissionInstruction* code, std::size_t size, std::size_t step_count);
+
+double readMissionSensorField(const runtime::SensorFrame& sensor_frame, MissionSensorField field);
+// Field by its SensorFrame member name, e.g. "battery_soc_percent"
+bool parseMissionSensorField(const std::string& name, MissionSensorField& field_out);
+
+enum class MissionVmState {
+    STEP,   // step_index is the next step to execute
+    YIELD,  // budget spent; call run() again next tick
+    DONE,
+    ABORTED,
+};
+
+struct MissionVmResult {
+    MissionVmState state = MissionVmState::YIELD;
+    std::size_t step_index = 0;
+};
+
+/**
+ * @brief Interpreter state for one vehicle: program counter and a fixed variable file.
+ *
+ * The bytecode is shared and read-only. Each run() executes at most `budget` instructions,
+ * so a tight loop without a `run` statement costs a bounded amount per tick.
+ */
+class MissionVm {
+public:
+    void reset();
+    MissionVmResult run(const MissionInstruction* code,
+                        std::size_t size,
+                        const runtime::SensorFrame& sensor_frame,
+                        std::size_t budget);
+
+    std::size_t programCounter() const { return pc_; }
+    double variable(std::size_t slot) const { return variables_[slot]; }
+    std::uint64_t instructionsExecuted() const { return instructions_executed_; }
+
+private:
+    std::size_t pc_ = 0;
+    std::array<double, kMaxMissionVariables> variables_{};
+    std::uint64_t instructions_executed_ = 0;
+};
+
+}  // namespace drone::mission
+
+#endif  // DRONE_MISSION_MISSION_PROGRAM_H
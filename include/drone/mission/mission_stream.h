@@ -0,0 +1,58 @@
+#ifndef DRONE_MISSION_MISSION_STREAM_H
+#define DRONE_MISSION_MISSION_STREAM_H
+
+#include "drone/mission/mission_image.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace drone::mission {
+
+/**
+ * @brief Lazily produces mission steps for MissionExecutor's streaming mode.
+ *
+ * The executor pulls steps into a bounded window as earlier ones complete, so a
+ * source never has to hold the whole mission. Sources are single-pass.
+ */
+class MissionStepSource {
+public:
+    virtual ~MissionStepSource() = default;
+
+    // Fills the next step and its display name; false once the source is exhausted
+    virtual bool next(FlatMissionStep& step_out, std::string& name_out) = 0;
+};
+
+// Cursor over a compiled or mapped image, e.g. the takeoff or landing part of a survey
+class ImageStepSource : public MissionStepSource {
+public:
+    explicit ImageStepSource(std::shared_ptr<const MissionImage> image);
+    // Steps [first_step, end_step) only; end_step is clamped to the image
+    ImageStepSource(std::shared_ptr<const MissionImage> image, std::size_t first_step, std::size_t end_step);
+
+    bool next(FlatMissionStep& step_out, std::string& name_out) override;
+
+private:
+    std::shared_ptr<const MissionImage> image_;
+    std::size_t cursor_ = 0;
+    std::size_t end_ = 0;
+};
+
+// Drains each source in turn
+class SequenceStepSource : public MissionStepSource {
+public:
+    SequenceStepSource() = default;
+    explicit SequenceStepSource(std::vector<std::unique_ptr<MissionStepSource>> sources);
+
+    void append(std::unique_ptr<MissionStepSource> source);
+    bool next(FlatMissionStep& step_out, std::string& name_out) override;
+
+private:
+    std::vector<std::unique_ptr<MissionStepSource>> sources_;
+    std::size_t current_ = 0;
+};
+
+}  // namespace drone::mission
+
+#endif  // DRONE_MISSION_MISSION_STREAM_H
@@ -0,0 +1,122 @@
+#ifndef DRONE_MISSION_MISSION_TRIGGERS_H
+#define DRONE_MISSION_MISSION_TRIGGERS_H
+
+#include "drone/mission/mission_program.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace drone::runtime {
+struct SensorFrame;
+}
+
+namespace drone::mission {
+
+enum class MissionTriggerDirection : std::uint8_t {
+    BELOW,  // fires when the field drops below threshold
+    ABOVE,  // fires when the field rises above threshold
+};
+
+enum class MissionTriggerAction : std::uint8_t {
+    GOTO_STEP,  // jump to a step (e.g. return home or land) and continue from there
+    ABORT,
+};
+
+// Parsed `mission.triggers` entry
+struct MissionTrigger {
+    std::string name;
+    MissionSensorField field = MissionSensorField::BATTERY_SOC_PERCENT;
+    MissionTriggerDirection direction = MissionTriggerDirection::BELOW;
+    double threshold = 0.0;
+    double hysteresis = 0.0;  // the field must recover this far past threshold before the trigger re-arms
+    MissionTriggerAction action = MissionTriggerAction::ABORT;
+    int step_id = -1;  // GOTO_STEP target
+};
+
+// Fixed-size trigger record, stored as-is in mission images
+struct FlatMissionTrigger {
+    std::uint8_t field = 0;      // MissionSensorField
+    std::uint8_t direction = 0;  // MissionTriggerDirection
+    std::uint8_t action = 0;     // MissionTriggerAction
+    std::uint8_t reserved = 0;
+    std::uint32_t name_offset = 0;
+    std::uint32_t step_index = 0;  // GOTO_STEP target in the step table
+    std::uint32_t reserved2 = 0;
+    double threshold = 0.0;
+    double hysteresis = 0.0;
+};
+
+static_assert(std::is_trivially_copyable<FlatMissionTrigger>::value, "mission triggers are mapped in place");
+
+bool validateMissionTriggers(const FlatMissionTrigger* triggers, std::size_t count, std::size_t step_count);
+
+/**
+ * @brief Immutable index over a mission's triggers, shared by every vehicle running the mission.
+ *
+ * Triggers are grouped by the SensorFrame field and direction they watch. Within a group the
+ * fire and re-arm thresholds are kept sorted, so a tick reads each watched field once and
+ * finds the triggers that changed state with two binary searches.
+ */
+class MissionTriggerTable {
+public:
+    MissionTriggerTable() = default;
+    MissionTriggerTable(const FlatMissionTrigger* triggers, std::size_t count);
+
+    std::size_t size() const { return triggers_ == nullptr ? 0 : trigger_count_; }
+    bool empty() const { return size() == 0; }
+    const FlatMissionTrigger& trigger(std::size_t index) const { return triggers_[index]; }
+    std::size_t groupCount() const { return groups_.size(); }
+
+private:
+    friend class MissionTriggerMonitor;
+
+    // Thresholds are stored as sign * value with sign = +1 for BELOW and -1 for ABOVE, so both
+    // directions become "fires below fire_key, re-arms at or above rearm_key"
+    struct Group {
+        MissionSensorField field = MissionSensorField::ALTITUDE_M;
+        double sign = 1.0;
+        std::uint32_t begin = 0;
+        std::uint32_t end = 0;
+    };
+
+    const FlatMissionTrigger* triggers_ = nullptr;
+    std::size_t trigger_count_ = 0;
+    std::vector<Group> groups_;
+    std::vector<double> fire_keys_;  // ascending within each group
+    std::vector<std::uint32_t> fire_triggers_;
+    std::vector<double> rearm_keys_;  // ascending within each group
+    std::vector<std::uint32_t> rearm_triggers_;
+};
+
+// Trigger to act on when several fire in one tick: the first declared abort, otherwise the
+// first declared trigger; -1 if none fired
+int selectMissionTrigger(const MissionTriggerTable& table, const std::vector<std::uint32_t>& fired);
+
+/**
+ * @brief Per-vehicle trigger state: armed flags and a cursor per group.
+ *
+ * A trigger fires once when its condition becomes true and stays disarmed until the field
+ * recovers past threshold +/- hysteresis. Cost per tick grows with the number of watched
+ * fields (plus a log of the triggers per field), not with the number of triggers.
+ */
+class MissionTriggerMonitor {
+public:
+    void reset(const MissionTriggerTable& table);
+    // Every trigger that fired this tick, in declaration order; valid until the next update().
+    // All of them are disarmed, so callers act on selectMissionTrigger() and count the rest.
+    const std::vector<std::uint32_t>& update(const MissionTriggerTable& table,
+                                             const runtime::SensorFrame& sensor_frame);
+
+private:
+    std::vector<std::uint8_t> armed_;
+    std::vector<std::uint32_t> fired_;
+    std::vector<std::uint32_t> fire_cursor_;   // entries [cursor, end) are active
+    std::vector<std::uint32_t> rearm_cursor_;  // entries [begin, cursor) have recovered
+};
+
+}  // namespace drone::mission
+
+#endif  // DRONE_MISSION_MISSION_TRIGGERS_H
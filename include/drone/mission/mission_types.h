@@ -2,6 +2,8 @@
 #define DRONE_MISSION_MISSION_TYPES_H
 
 #include "drone/drone_data_types.h"
+#include "drone/mission/mission_program.h"
+#include "drone/mission/mission_triggers.h"
 
 #include <memory>
 #include <string>
@@ -32,6 +34,7 @@ enum class CompletionConditionType {
     ATTITUDE_REACHED,
     VELOCITY_LOW,
     LANDED,
+    AGL_REACHED,
 };
 
 enum class TimeoutBehavior {
@@ -86,7 +89,8 @@ public:
 
     Vector3 target_position_enu_m{0.0, 0.0, 0.0};
     double target_altitude_m = 0.0;
-    std::string altitude_mode = "absolute";
+    std::string altitude_mode = "absolute";  // "agl": target_altitude_m is height above terrain
+    std::string trajectory = "direct";       // "min_jerk": track a smooth path planned on step entry
     double max_tilt_rad = 0.5;
     double max_velocity_mps = 10.0;
 };
@@ -150,6 +154,20 @@ struct InitialConditions {
     double battery_soc_percent = 100.0;
 };
 
+/**
+ * @brief Per-vehicle adjustments applied on top of a shared mission without copying its steps.
+ *
+ * Position targets are shifted by position_offset_enu_m and absolute altitude targets by
+ * altitude_offset_m. AGL targets, AGL completion checks and land are not shifted.
+ */
+struct MissionOverrides {
+    Vector3 position_offset_enu_m{0.0, 0.0, 0.0};  // z ignored; use altitude_offset_m
+    double altitude_offset_m = 0.0;
+    double start_delay_s = 0.0;  // honoured by FleetMissionScheduler
+};
+
+struct MissionPatternSpec;
+
 struct Mission {
     std::string name = "Untitled Mission";
     std::string description;
@@ -158,9 +176,16 @@ struct Mission {
     std::string author;
     std::string created;
     double max_duration_s = 0.0;
+    std::string airspace_file;  // optional geofence/obstacle file, resolved against the mission file directory
 
     InitialConditions initial_conditions;
     std::vector<MissionStep> steps;
+    // compiled `program:` text; when present it decides which steps run, otherwise steps run in order
+    std::vector<MissionInstruction> program;
+    // checked every tick whatever step is running
+    std::vector<MissionTrigger> triggers;
+    // optional generated survey (mission_patterns.h); the mission then runs in streaming mode
+    std::shared_ptr<const MissionPatternSpec> pattern;
 };
 
 }  // namespace drone::mission
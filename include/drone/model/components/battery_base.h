@@ -13,15 +13,16 @@ struct BatterySpecs {
     double capacity_mah;      ///< Battery capacity in milliamp-hours.
     double nominal_voltage_v; ///< Nominal voltage in volts.
     double max_discharge_rate_c; ///< Maximum discharge rate in C (capacity multiplier).
-    int cells;               ///< Number of cells in the battery.
+    int cells;               ///< Number of cells in series.
+    int parallel_cells;      ///< Number of parallel cells per series group (e.g. 4 for a 12S4P pack).
     CellSpecs cell_specs;  ///< Specifications for individual cells.
     double weight_kg;        ///< Battery weight in kilograms.
 
-    BatterySpecs(int cells = 4, CellSpecs cell_specs = CellSpecs(), double weight_kg = 0.0)
-        : cells(cells), cell_specs(cell_specs), max_discharge_rate_c(1.0), weight_kg(weight_kg) {
+    BatterySpecs(int cells = 4, CellSpecs cell_specs = CellSpecs(), double weight_kg = 0.0, int parallel_cells = 1)
+        : cells(cells), parallel_cells(parallel_cells < 1 ? 1 : parallel_cells), cell_specs(cell_specs), max_discharge_rate_c(1.0), weight_kg(weight_kg) {
         
-            // assumption is that cells are in series
-            capacity_mah = cell_specs.capacity_mah;
+            // series groups of identical parallel cells
+            capacity_mah = cell_specs.capacity_mah * this->parallel_cells;
             nominal_voltage_v = cells * cell_specs.nominal_voltage_v;
         }
 };
@@ -19,12 +19,42 @@ struct ElecMotorSpecs {
     double weight_kg;         ///< Motor weight in kilograms.
     double blade_diameter_m{0.0}; ///< Blade diameter in meters.
     double blade_shape_coeff{1.0}; ///< Blade shape coefficient.
+    double thermal_time_constant_s{10.0}; ///< First-order thermal time constant in seconds.
     double max_ramp_rate_rpm_per_s_; ///< Maximum ramp rate in RPM/s for speed changes.
 
     ElecMotorSpecs(double max_speed = 10000.0, double nom_vol = 12.0, double max_curr = 10.0,
                   double eff = 0.85, double therm_res = 0.5, double weight_kg = 0.0, double max_ramp_rate_rpm_per_s = 30000.0)
         : max_speed_rpm(max_speed), nominal_voltage_v(nom_vol), max_current_a(max_curr), efficiency(eff),
           thermal_resistance(therm_res), weight_kg(weight_kg), max_ramp_rate_rpm_per_s_(max_ramp_rate_rpm_per_s) {}
+
+    bool operator==(const ElecMotorSpecs& other) const;
+    bool operator!=(const ElecMotorSpecs& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Returns a shared immutable copy of the specs.
+ *
+ * Identical specs resolve to the same object, so all motors of an airframe (and
+ * of every vehicle built from it) share one instance.
+ * @param specs The motor specifications.
+ * @return Shared pointer to the interned specs.
+ */
+std::shared_ptr<const ElecMotorSpecs> internElecMotorSpecs(const ElecMotorSpecs& specs);
+
+/**
+ * @brief Per-motor simulation state updated every tick.
+ *
+ * A vehicle keeps the states of all its motors in one contiguous array (see
+ * DroneBase::getMotorStates); an ElecMotor is a view onto one entry.
+ */
+struct ElecMotorState {
+    double speed_rpm{0.0};         ///< Current speed in RPM.
+    double desired_speed_rpm{0.0}; ///< Desired speed in RPM (input).
+    double current_a{0.0};         ///< Current consumption in A.
+    double voltage_v{0.0};         ///< Operating voltage in V.
+    double temperature_c{25.0};    ///< Motor temperature in °C.
+    double losses_w{0.0};          ///< Power losses in W.
+    double ambient_temp_c{25.0};   ///< Ambient temperature in °C (assumed constant).
 };
 
 /**
@@ -42,6 +72,14 @@ public:
      * @param motor_specs The motor specifications.
      */
     ElecMotor(const std::string& name, const drone::model::sensors::AnalogIOSpec& spec, const ElecMotorSpecs& motor_specs = ElecMotorSpecs());
+
+    /**
+     * @brief Constructor sharing already interned motor specifications.
+     * @param name The name of the motor.
+     * @param spec The analog IO specification.
+     * @param motor_specs Shared motor specifications (must not be null).
+     */
+    ElecMotor(const std::string& name, const drone::model::sensors::AnalogIOSpec& spec, std::shared_ptr<const ElecMotorSpecs> motor_specs);
     
     /**
      * @brief Virtual destructor.
@@ -50,8 +88,21 @@ public:
 
     ElecMotor(const ElecMotor&) = delete;
     ElecMotor& operator=(const ElecMotor&) = delete;
-    ElecMotor(ElecMotor&&) noexcept = default;
-    ElecMotor& operator=(ElecMotor&&) noexcept = default;
+    ElecMotor(ElecMotor&& other) noexcept;
+    ElecMotor& operator=(ElecMotor&& other) noexcept;
+
+    /**
+     * @brief Moves the motor state into external storage and views it from there.
+     * @param state Storage owned by the caller (e.g. a vehicle's state array), or nullptr
+     *              to copy the state back into the motor.
+     */
+    void bindState(ElecMotorState* state);
+
+    /**
+     * @brief Gets the motor's hot state.
+     * @return A const reference to the state.
+     */
+    const ElecMotorState& getState() const { return *state_; }
 
     /**
      * @brief Updates the motor state (simulates motor operation).
@@ -65,19 +116,19 @@ public:
      * @brief Gets the current speed in RPM.
      * @return The speed in RPM.
      */
-    double getSpeedRPM() const { return speed_rpm_; }
+    double getSpeedRPM() const { return state_->speed_rpm; }
     
     /**
      * @brief Gets the current consumption in amperes.
      * @return The current in A.
      */
-    double getCurrentA() const { return current_a_; }
+    double getCurrentA() const { return state_->current_a; }
     
     /**
      * @brief Gets the motor temperature in Celsius.
      * @return The temperature in °C.
      */
-    double getTemperatureC() const { return temperature_c_; }
+    double getTemperatureC() const { return state_->temperature_c; }
 
     drone::model::sensors::TemperatureSensorReading getTemperatureReading() const { 
         drone::model::sensors::TemperatureSensorReading temp_reading = {
@@ -92,13 +143,13 @@ public:
      * @brief Gets the motor efficiency.
      * @return The efficiency as a fraction.
      */
-    double getEfficiency() const { return specs_.efficiency; }
+    double getEfficiency() const { return specs_->efficiency; }
 
     /**
      * @brief Gets the motor weight in kilograms.
      * @return The motor weight in kg.
      */
-    double getWeightKg() const { return specs_.weight_kg; }
+    double getWeightKg() const { return specs_->weight_kg; }
     
     /**
      * @brief Calculates battery drain (energy consumed in Joules) over a given time.
@@ -111,29 +162,35 @@ public:
      * @brief Gets the motor specifications.
      * @return A const reference to the ElecMotorSpecs.
      */
-    const ElecMotorSpecs& getSpecs() const { return specs_; }
+    const ElecMotorSpecs& getSpecs() const { return *specs_; }
+
+    /**
+     * @brief Gets the shared motor specifications.
+     * @return The interned specs shared with other motors of the same type.
+     */
+    const std::shared_ptr<const ElecMotorSpecs>& getSharedSpecs() const { return specs_; }
 
     /**
      * @brief Gets the maximum ramp rate in RPM/s for speed changes.
      * @return The maximum ramp rate in RPM/s.
      */
-    const double getMaxRampRateRPMPerS() const { return specs_.max_ramp_rate_rpm_per_s_; }
+    const double getMaxRampRateRPMPerS() const { return specs_->max_ramp_rate_rpm_per_s_; }
 
     // Additional getters for simulation state
-    double getDesiredSpeedRPM() const { return desired_speed_rpm_; }
-    double getVoltageV() const { return voltage_v_; }
-    double getLossesW() const { return losses_w_; }
-    double getAmbientTempC() const { return ambient_temp_c_; }
+    double getDesiredSpeedRPM() const { return state_->desired_speed_rpm; }
+    double getVoltageV() const { return state_->voltage_v; }
+    double getLossesW() const { return state_->losses_w; }
+    double getAmbientTempC() const { return state_->ambient_temp_c; }
     std::chrono::steady_clock::time_point getLastUpdateTime() const { return last_update_time_; }
     drone::model::sensors::TemperatureSensor& getTempSensor() { return temp_sensor_; }
 
     // Setters for simulation state
-    void setSpeedRPM(double speed) { speed_rpm_ = speed; }
-    void setCurrentA(double current) { current_a_ = current; }
-    void setTemperatureC(double temp) { temperature_c_ = temp; }
-    void setLossesW(double losses) { losses_w_ = losses; }
-    void setVoltageV(double voltage) { voltage_v_ = voltage; }
-    void setAmbientTempC(double temp) { ambient_temp_c_ = temp; }
+    void setSpeedRPM(double speed) { state_->speed_rpm = speed; }
+    void setCurrentA(double current) { state_->current_a = current; }
+    void setTemperatureC(double temp) { state_->temperature_c = temp; }
+    void setLossesW(double losses) { state_->losses_w = losses; }
+    void setVoltageV(double voltage) { state_->voltage_v = voltage; }
+    void setAmbientTempC(double temp) { state_->ambient_temp_c = temp; }
     void setLastUpdateTime(std::chrono::steady_clock::time_point time) { last_update_time_ = time; }
 
     // Setters for simulation inputs
@@ -144,14 +201,9 @@ public:
     void setDesiredSpeedRPM(double speed_rpm);
 
 private:
-    ElecMotorSpecs specs_;     ///< Motor specifications.
-    double speed_rpm_;         ///< Current speed in RPM.
-    double desired_speed_rpm_; ///< Desired speed in RPM (input).
-    double current_a_;         ///< Current consumption in A.
-    double voltage_v_;         ///< Operating voltage in V.
-    double temperature_c_;     ///< Motor temperature in °C.
-    double losses_w_;          ///< Power losses in W.
-    double ambient_temp_c_;    ///< Ambient temperature in °C (assumed constant).
+    std::shared_ptr<const ElecMotorSpecs> specs_; ///< Shared motor specifications.
+    ElecMotorState own_state_; ///< State storage while not bound to a vehicle.
+    ElecMotorState* state_;    ///< Active state, either own_state_ or external storage.
     std::chrono::steady_clock::time_point last_update_time_; ///< Time point of the last update.
     drone::model::sensors::TemperatureSensor temp_sensor_; ///< Internal temperature sensor for motor.
 };
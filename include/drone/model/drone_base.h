@@ -34,7 +34,9 @@ public:
               double body_weight_kg)
         : DronePhysical(name, std::move(battery), std::move(temperature_sensor), std::move(gps)),
           motors_(std::move(motors)),
-          body_weight_kg_(body_weight_kg) {}
+          body_weight_kg_(body_weight_kg) {
+        bindMotorStates();
+    }
 
     virtual ~DroneBase() = default;
 
@@ -49,7 +51,17 @@ public:
     // Motor management - simulation-specific
     std::vector<components::ElecMotor>& getMotors() { return motors_; }
     const std::vector<components::ElecMotor>& getMotors() const { return motors_; }
-    void setMotors(std::vector<components::ElecMotor> motors) { motors_ = std::move(motors); }
+    void setMotors(std::vector<components::ElecMotor> motors) {
+        motors_ = std::move(motors);
+        bindMotorStates();
+    }
+
+    /**
+     * @brief Hot state of the motors passed to the constructor or setMotors, in motor order.
+     *
+     * The states are stored contiguously; each ElecMotor reads and writes its entry.
+     */
+    const std::vector<components::ElecMotorState>& getMotorStates() const { return motor_states_; }
 
     // Battery component management - simulation-specific
     void setBattery(std::unique_ptr<components::Battery_base> battery) {
@@ -99,7 +111,19 @@ public:
     }
 
 private:
+    void bindMotorStates() {
+        // pull states back into the motors before the buffer they may view is replaced
+        for (auto& motor : motors_) {
+            motor.bindState(nullptr);
+        }
+        motor_states_.assign(motors_.size(), components::ElecMotorState{});
+        for (std::size_t i = 0; i < motors_.size(); ++i) {
+            motors_[i].bindState(&motor_states_[i]);
+        }
+    }
+
     std::vector<components::ElecMotor> motors_;
+    std::vector<components::ElecMotorState> motor_states_;
     double body_weight_kg_;
 };
 
@@ -0,0 +1,49 @@
+#ifndef DRONE_RUNTIME_CONTROLLER_SETUP_H
+#define DRONE_RUNTIME_CONTROLLER_SETUP_H
+
+#include "drone/config/altitude_controller_config.h"
+#include "drone/config/attitude_controller_config.h"
+#include "drone/model/components/altitude_controler.h"
+#include "drone/runtime/real_drone.h"
+
+namespace drone::runtime {
+
+// AltitudeController with the PID, reference-rate and hover settings of the config
+inline model::components::AltitudeController makeAltitudeController(const config::AltitudeControllerConfig& alt_config) {
+    return model::components::AltitudeController(
+        alt_config.altitude_param_p,
+        alt_config.max_altitude_delta_mps,
+        alt_config.control_param_p,
+        alt_config.control_param_i,
+        alt_config.neutral_rpm,
+        alt_config.control_param_d,
+        alt_config.enable_i_component,
+        alt_config.enable_d_component,
+        alt_config.activation_error_band_m);
+}
+
+// Target altitude, position hold, lateral roll law and attitude gains from the configs
+inline void applyControllerConfig(RealDrone& real_drone,
+                                  const config::AltitudeControllerConfig& alt_config,
+                                  const config::AttitudeControllerConfig& att_config) {
+    real_drone.setTargetAltitude(alt_config.target_altitude_m);
+    real_drone.setPositionControlEnabled(alt_config.position_hold_enabled);
+    real_drone.setPositionGain(alt_config.position_hold_kp_pos);
+    real_drone.setVelocityGains(alt_config.position_hold_kp_vel, alt_config.position_hold_kd_vel);
+    real_drone.setMaxVelocity(alt_config.position_hold_max_velocity_mps);
+    real_drone.setMaxTilt(alt_config.position_hold_max_tilt_rad);
+    real_drone.setLateralGains(alt_config.position_hold_roll_gain_rad_per_m,
+                               alt_config.position_hold_roll_damping_rad_per_mps,
+                               alt_config.position_hold_roll_velocity_gain_rad_per_mps);
+    real_drone.setAttitudeGains(
+        att_config.yaw_p_gain_rpm_per_rad,
+        att_config.yaw_d_gain_rpm_per_rad_s,
+        att_config.pitch_p_gain_rpm_per_rad,
+        att_config.pitch_d_gain_rpm_per_rad_s,
+        att_config.roll_p_gain_rpm_per_rad,
+        att_config.roll_d_gain_rpm_per_rad_s);
+}
+
+}  // namespace drone::runtime
+
+#endif  // DRONE_RUNTIME_CONTROLLER_SETUP_H
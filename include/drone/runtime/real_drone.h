@@ -3,15 +3,22 @@
 
 #include "drone/model/components/altitude_controler.h"
 #include "drone/control/position_controller.h"
+#include "drone/control/trajectory.h"
 #include "drone/drone_data_types.h"
+#include "drone/mission/airspace.h"
+#include "drone/mission/airspace_loader.h"
 #include "drone/mission/mission_executor.h"
 #include "drone/mission/mission_loader.h"
+#include "drone/mission/mission_patterns.h"
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace drone::runtime {
 
@@ -19,6 +26,7 @@ constexpr std::size_t kMotorCount = 4;
 
 struct SensorFrame {
     double altitude_m = 0.0;
+    double altitude_agl_m = 0.0;  // height above the terrain under the vehicle
     double position_enu_x_m = 0.0;
     double position_enu_y_m = 0.0;
     double position_enu_z_m = 0.0;
@@ -37,6 +45,7 @@ struct SensorFrame {
     double yaw_rad = 0.0;
     double pitch_rad = 0.0;
     double roll_rad = 0.0;
+    double airspace_breach = 0.0;  // 1 while the airspace monitor reports a hit, set by the caller
 };
 
 struct ActuatorFrame {
@@ -73,6 +82,51 @@ struct ActuatorFrame {
     double sensed_roll_rad = 0.0;
 };
 
+/**
+ * @brief A batch of controller setpoints applied in one call.
+ *
+ * Only fields whose bit is set in `fields` are written; the setters set the bit.
+ */
+struct SetpointUpdate {
+    enum Field : std::uint32_t {
+        POSITION_CONTROL = 1u << 0,
+        POSITION = 1u << 1,
+        ALTITUDE = 1u << 2,
+        YAW = 1u << 3,
+        PITCH = 1u << 4,
+        ROLL = 1u << 5,
+        MAX_VELOCITY = 1u << 6,
+        MAX_TILT = 1u << 7,
+        TRAJECTORY = 1u << 8,  // replaces POSITION; a POSITION update without it drops the active trajectory
+    };
+
+    std::uint32_t fields = 0;
+    bool position_control_enabled = false;
+    double target_x_m = 0.0;
+    double target_y_m = 0.0;
+    double target_altitude_m = 0.0;
+    double yaw_rad = 0.0;
+    double pitch_rad = 0.0;
+    double roll_rad = 0.0;
+    double max_velocity_mps = 0.0;
+    double max_tilt_rad = 0.0;
+    std::shared_ptr<const control::MinimumJerkTrajectory> trajectory;
+
+    bool has(Field field) const { return (fields & field) != 0; }
+    void setPositionControl(bool enabled) { position_control_enabled = enabled; fields |= POSITION_CONTROL; }
+    void setPosition(double x_m, double y_m) { target_x_m = x_m; target_y_m = y_m; fields |= POSITION; }
+    void setAltitude(double altitude_m) { target_altitude_m = altitude_m; fields |= ALTITUDE; }
+    void setYaw(double value_rad) { yaw_rad = value_rad; fields |= YAW; }
+    void setPitch(double value_rad) { pitch_rad = value_rad; fields |= PITCH; }
+    void setRoll(double value_rad) { roll_rad = value_rad; fields |= ROLL; }
+    void setMaxVelocity(double value_mps) { max_velocity_mps = value_mps; fields |= MAX_VELOCITY; }
+    void setMaxTilt(double value_rad) { max_tilt_rad = value_rad; fields |= MAX_TILT; }
+    void setTrajectory(std::shared_ptr<const control::MinimumJerkTrajectory> value) {
+        trajectory = std::move(value);
+        fields |= TRAJECTORY;
+    }
+};
+
 class SensorSource {
 public:
     virtual ~SensorSource() = default;
@@ -85,6 +139,19 @@ public:
     virtual void applyActuators(const ActuatorFrame& actuator_frame) = 0;
 };
 
+struct ImuSample {
+    double timestamp_s = 0.0;
+    drone::Vector3 specific_force_body_ms2{};
+    drone::Vector3 angular_rate_body_rps{};
+};
+
+// High-rate inertial data handed over in batches (one call per control tick), oldest sample first
+class ImuSource {
+public:
+    virtual ~ImuSource() = default;
+    virtual std::size_t readImuSamples(ImuSample* out, std::size_t capacity) = 0;
+};
+
 class RealDrone {
 public:
     explicit RealDrone(const model::components::AltitudeController& altitude_controller)
@@ -97,6 +164,10 @@ public:
         altitude_controller_.setTargetAltitude(target_altitude_m);
     }
 
+    double getTargetAltitude() const {
+        return altitude_controller_.getTargetAltitude();
+    }
+
     void setTargetYaw(double target_yaw_rad) {
         target_yaw_rad_ = target_yaw_rad;
     }
@@ -126,6 +197,29 @@ public:
     void setTargetPosition(double target_x_m, double target_y_m) {
         position_controller_->setTargetPosition(target_x_m, target_y_m);
         position_target_initialized_ = true;
+        trajectory_.reset();
+    }
+
+    /**
+     * @brief Track a planned XY trajectory, starting now; its end becomes the position target.
+     *
+     * The roll command adds velocity error and acceleration feedforward from the trajectory to
+     * the position error law. Once the trajectory has been flown, the end point is held as an
+     * ordinary position target.
+     */
+    void followTrajectory(std::shared_ptr<const control::MinimumJerkTrajectory> trajectory) {
+        if (!trajectory) {
+            trajectory_.reset();
+            return;
+        }
+        setTargetPosition(trajectory->endPosition().x, trajectory->endPosition().y);
+        trajectory_ = std::move(trajectory);
+        trajectory_time_s_ = 0.0;
+        trajectory_segment_cursor_ = 0;
+    }
+
+    bool isFollowingTrajectory() const {
+        return trajectory_ != nullptr;
     }
 
     /**
@@ -161,19 +255,113 @@ public:
         position_controller_->setMaxTilt(max_tilt_rad);
     }
 
+    /**
+     * @brief Gains of the XY roll law: roll per metre of lateral error, per m/s of lateral
+     * velocity while holding a point, and per m/s of velocity error against a trajectory reference.
+     */
+    void setLateralGains(double roll_gain_rad_per_m,
+                         double roll_damping_rad_per_mps,
+                         double roll_velocity_gain_rad_per_mps) {
+        lateral_roll_gain_rad_per_m_ = roll_gain_rad_per_m;
+        lateral_roll_damping_rad_per_mps_ = roll_damping_rad_per_mps;
+        lateral_roll_velocity_gain_rad_per_mps_ = roll_velocity_gain_rad_per_mps;
+    }
+
+    Vector3 getTargetPosition() const {
+        return position_controller_->getTargetPosition();
+    }
+
+    /**
+     * @brief Apply a batch of setpoints.
+     *
+     * Position control is switched before the position target is written, so enabling it and
+     * setting a target in the same batch keeps the target instead of re-latching the current XY.
+     */
+    void applySetpoints(const SetpointUpdate& update) {
+        if (update.has(SetpointUpdate::POSITION_CONTROL)) {
+            setPositionControlEnabled(update.position_control_enabled);
+        }
+        if (update.has(SetpointUpdate::TRAJECTORY)) {
+            followTrajectory(update.trajectory);
+        } else if (update.has(SetpointUpdate::POSITION)) {
+            setTargetPosition(update.target_x_m, update.target_y_m);
+        }
+        if (update.has(SetpointUpdate::ALTITUDE)) {
+            altitude_controller_.setTargetAltitude(update.target_altitude_m);
+        }
+        if (update.has(SetpointUpdate::YAW)) {
+            target_yaw_rad_ = update.yaw_rad;
+        }
+        if (update.has(SetpointUpdate::PITCH)) {
+            target_pitch_rad_ = update.pitch_rad;
+        }
+        if (update.has(SetpointUpdate::ROLL)) {
+            target_roll_rad_ = update.roll_rad;
+        }
+        if (update.has(SetpointUpdate::MAX_VELOCITY)) {
+            position_controller_->setMaxVelocity(update.max_velocity_mps);
+        }
+        if (update.has(SetpointUpdate::MAX_TILT)) {
+            position_controller_->setMaxTilt(update.max_tilt_rad);
+        }
+    }
+
+    // Accepts a YAML mission or an image written by mission_compile; images are mapped, not parsed.
+    // A YAML mission with a `pattern:` section is streamed (see loadMissionStream).
     bool loadMissionFromFile(const std::string& mission_file, std::string* error_out = nullptr) {
-        mission::Mission parsed_mission;
-        if (!mission_loader_.loadFromFile(mission_file, parsed_mission, error_out)) {
-            mission_loaded_ = false;
+        mission_loaded_ = false;
+        std::shared_ptr<const mission::MissionImage> image;
+        if (mission::MissionImage::isImageFile(mission_file)) {
+            image = mission::MissionImage::open(mission_file, error_out);
+        } else {
+            mission::Mission parsed_mission;
+            if (!mission_loader_.loadFromFile(mission_file, parsed_mission, error_out)) {
+                return false;
+            }
+            image = mission::MissionImage::fromMission(parsed_mission);
+            if (image && parsed_mission.pattern) {
+                const mission::MissionPatternSpec& pattern = *parsed_mission.pattern;
+                loadMissionStream(mission::makeMissionPatternStream(std::move(image), pattern),
+                                  pattern.window_steps > 0 ? pattern.window_steps
+                                                           : mission::kDefaultMissionStreamWindow);
+                return true;
+            }
+        }
+        if (!image) {
             return false;
         }
+        return loadMission(std::move(image), {}, error_out);
+    }
 
-        mission_ = std::move(parsed_mission);
-        mission_executor_.loadMission(mission_);
+    // Runs a compiled mission in place; the steps are not copied, so vehicles sharing a mission
+    // share one MissionImage::fromMission result. Rejected if a leg crosses its airspace_file,
+    // checked at the mission's own coordinates (overrides offsets are not applied).
+    bool loadMission(std::shared_ptr<const mission::MissionImage> image,
+                     const mission::MissionOverrides& overrides = {},
+                     std::string* error_out = nullptr) {
+        mission_loaded_ = false;
+        if (!image || !loadMissionAirspace(*image, overrides, error_out)) {
+            return false;
+        }
         mission_loaded_ = true;
+        mission_executor_.loadMission(std::move(image));
+        mission_executor_.setOverrides(overrides);
         return true;
     }
 
+    // Streams steps from a generator or cursor with a bounded window, e.g. a large survey pattern.
+    // Airspace is neither checked up front nor monitored in flight: the legs are not known in
+    // advance and the step source carries no airspace_file.
+    void loadMissionStream(std::unique_ptr<mission::MissionStepSource> source,
+                           std::size_t window_steps = mission::kDefaultMissionStreamWindow,
+                           const mission::MissionOverrides& overrides = {}) {
+        mission_loaded_ = source != nullptr;
+        airspace_.reset();
+        airspace_load_profile_ = mission::AirspaceLoadProfile{};
+        mission_executor_.loadMission(std::move(source), window_steps);
+        mission_executor_.setOverrides(overrides);
+    }
+
     void startMission() {
         if (!mission_loaded_) {
             return;
@@ -204,10 +392,53 @@ public:
         return mission_executor_.getCurrentStepTargetDescription();
     }
 
+    std::uint64_t getFiredMissionTriggerCount() const {
+        return mission_executor_.getFiredTriggerCount();
+    }
+
+    std::string getLastMissionTriggerName() const {
+        return mission_executor_.getLastTriggerName();
+    }
+
     bool hasMissionLoaded() const {
         return mission_loaded_;
     }
 
+    // nullptr for streamed missions
+    const std::shared_ptr<const mission::MissionImage>& getMissionImage() const {
+        return mission_executor_.getMissionImage();
+    }
+
+    // Geofence/obstacle index of the loaded mission; nullptr when it has no airspace_file
+    std::shared_ptr<const mission::AirspaceIndex> getAirspace() const {
+        return airspace_;
+    }
+
+    const mission::AirspaceLoadProfile& getAirspaceLoadProfile() const {
+        return airspace_load_profile_;
+    }
+
+    /**
+     * @brief Drain all IMU samples produced since the previous call into the reusable batch buffer.
+     * @return Number of samples in the batch
+     */
+    std::size_t drainImu(ImuSource& imu_source) {
+        constexpr std::size_t kImuReadChunk = 256;
+        imu_batch_.clear();
+        std::size_t read_count = 0;
+        do {
+            const std::size_t offset = imu_batch_.size();
+            imu_batch_.resize(offset + kImuReadChunk);
+            read_count = imu_source.readImuSamples(imu_batch_.data() + offset, kImuReadChunk);
+            imu_batch_.resize(offset + read_count);
+        } while (read_count == kImuReadChunk);
+        return imu_batch_.size();
+    }
+
+    const std::vector<ImuSample>& getImuBatch() const {
+        return imu_batch_;
+    }
+
     void update(double dt_s, const SensorSource& sensor_source, ActuatorSink& actuator_sink) {
         const SensorFrame sensors = sensor_source.readSensors();
 
@@ -251,6 +482,15 @@ public:
             const double dx_enu = position_controller_->getTargetPosition().x - sensors.position_enu_x_m;
             const double dy_enu = position_controller_->getTargetPosition().y - sensors.position_enu_y_m;
             const double distance_xy = std::sqrt(dx_enu * dx_enu + dy_enu * dy_enu);
+
+            control::TrajectorySample reference;
+            if (trajectory_) {
+                trajectory_time_s_ += dt_s;
+                reference = trajectory_->sample(trajectory_time_s_, trajectory_segment_cursor_);
+                if (reference.finished) {
+                    trajectory_.reset();  // hold the end point with the position error law
+                }
+            }
             
             // If we have significant position error, control yaw and roll
             if (distance_xy > 0.5) {  // Dead zone to avoid jitter
@@ -265,9 +505,31 @@ public:
                 const double yaw_s = std::sin(effective_yaw_rad);
                 const double error_body_right_m = -yaw_s * dx_enu + yaw_c * dy_enu;
 
-                const double kp_xy = 0.08;
+                const double kp_xy = lateral_roll_gain_rad_per_m_;
                 const double max_roll_for_xy = 0.3;  // Max ~17 degrees tilt
-                const double roll_cmd = -kp_xy * error_body_right_m;
+                const double velocity_body_right_mps =
+                    -yaw_s * sensors.gps_velocity_east_mps + yaw_c * sensors.gps_velocity_north_mps;
+                double roll_cmd =
+                    -kp_xy * error_body_right_m + lateral_roll_damping_rad_per_mps_ * velocity_body_right_mps;
+                if (trajectory_) {
+                    // Track the reference point instead of the end point, with velocity error and
+                    // the tilt that produces the reference acceleration as feedforward.
+                    const double kv_xy = lateral_roll_velocity_gain_rad_per_mps_;
+                    constexpr double kGravity_mps2 = 9.81;
+                    const auto body_right = [yaw_c, yaw_s](double east, double north) {
+                        return -yaw_s * east + yaw_c * north;
+                    };
+                    const double reference_error_right_m =
+                        body_right(reference.position_enu_m.x - sensors.position_enu_x_m,
+                                   reference.position_enu_m.y - sensors.position_enu_y_m);
+                    const double velocity_error_right_mps =
+                        body_right(reference.velocity_enu_mps.x - sensors.gps_velocity_east_mps,
+                                   reference.velocity_enu_mps.y - sensors.gps_velocity_north_mps);
+                    const double acceleration_right_mps2 =
+                        body_right(reference.acceleration_enu_mps2.x, reference.acceleration_enu_mps2.y);
+                    roll_cmd = -kp_xy * reference_error_right_m - kv_xy * velocity_error_right_mps -
+                               std::atan(acceleration_right_mps2 / kGravity_mps2);
+                }
                 effective_roll_rad = std::clamp(roll_cmd, -max_roll_for_xy, max_roll_for_xy);
             } else {
                 // Close to target, minimize roll
@@ -360,6 +622,45 @@ public:
     }
 
 private:
+    // Builds the mission's airspace index and rejects the mission if any GO_TO_POSITION leg crosses it
+    bool loadMissionAirspace(const mission::MissionImage& image, const mission::MissionOverrides& overrides,
+                             std::string* error_out) {
+        airspace_.reset();
+        airspace_load_profile_ = mission::AirspaceLoadProfile{};
+        if (image.airspaceFile().empty()) {
+            return true;
+        }
+
+        std::vector<mission::AirspaceVolume> volumes;
+        mission::AirspaceLoader airspace_loader;
+        if (!airspace_loader.loadFromFile(image.airspaceFile(), volumes, error_out)) {
+            return false;
+        }
+
+        const auto build_start = std::chrono::steady_clock::now();
+        auto airspace = std::make_shared<const mission::AirspaceIndex>(std::move(volumes));
+        const auto check_start = std::chrono::steady_clock::now();
+        const auto conflicts = mission::checkMissionLegs(image, *airspace, overrides,
+                                                &airspace_load_profile_.stats,
+                                                &airspace_load_profile_.legs_checked);
+        const auto check_end = std::chrono::steady_clock::now();
+
+        airspace_load_profile_.volumes = airspace->volumeCount();
+        airspace_load_profile_.nodes = airspace->nodeCount();
+        airspace_load_profile_.build_time_s = std::chrono::duration<double>(check_start - build_start).count();
+        airspace_load_profile_.check_time_s = std::chrono::duration<double>(check_end - check_start).count();
+
+        if (!conflicts.empty()) {
+            if (error_out) {
+                *error_out = mission::describeLegConflicts(*airspace, conflicts);
+            }
+            return false;
+        }
+
+        airspace_ = std::move(airspace);
+        return true;
+    }
+
     model::components::AltitudeController altitude_controller_;
     std::unique_ptr<control::PositionController> position_controller_;
     double target_yaw_rad_ = 0.0;
@@ -371,14 +672,22 @@ private:
     double yaw_d_gain_rpm_per_rad_s_ = 50.0;
     double pitch_d_gain_rpm_per_rad_s_ = 60.0;
     double roll_d_gain_rpm_per_rad_s_ = 60.0;
+    double lateral_roll_gain_rad_per_m_ = 0.08;
+    double lateral_roll_damping_rad_per_mps_ = 0.0;
+    double lateral_roll_velocity_gain_rad_per_mps_ = 0.15;
     double prev_yaw_error_rad_ = 0.0;
     double prev_pitch_error_rad_ = 0.0;
     double prev_roll_error_rad_ = 0.0;
     bool position_target_initialized_ = false;
+    std::shared_ptr<const control::MinimumJerkTrajectory> trajectory_;
+    double trajectory_time_s_ = 0.0;
+    std::size_t trajectory_segment_cursor_ = 0;
     mission::MissionLoader mission_loader_;
-    mission::Mission mission_;
     mission::MissionExecutor mission_executor_;
     bool mission_loaded_ = false;
+    std::shared_ptr<const mission::AirspaceIndex> airspace_;
+    mission::AirspaceLoadProfile airspace_load_profile_;
+    std::vector<ImuSample> imu_batch_;
 };
 
 }  // namespace drone::runtime
@@ -0,0 +1,90 @@
+#ifndef SIMULATOR_CONFIG_BATTERY_CONFIG_H
+#define SIMULATOR_CONFIG_BATTERY_CONFIG_H
+
+#include <string>
+#include <vector>
+
+#include <yaml-cpp/yaml.h>
+
+#include "simulator/physics/cell_ocv_table.h"
+
+namespace drone::simulator::config {
+
+class BatteryConfig {
+public:
+    drone::simulator::physics::CellChemistry chemistry = drone::simulator::physics::CellChemistry::LiPo;
+    // Optional custom curve, CellOcvTable::kSamples voltages from 0% to 100% SOC; overrides chemistry
+    std::vector<double> ocv_table_v;
+    // Pre-flight mission energy check: SOC the mission must not be predicted to fall to
+    double mission_reserve_soc_percent = 0.0;
+    // Refuse to fly a mission the check predicts will not complete; false only warns
+    bool mission_reject_infeasible = true;
+
+    bool loadFromFile(const std::string& config_file) {
+        try {
+            const YAML::Node yaml_config = YAML::LoadFile(config_file);
+            return loadFromYaml(yaml_config);
+        } catch (const YAML::Exception&) {
+            return false;
+        }
+    }
+
+    drone::simulator::physics::CellOcvTable ocvTable() const {
+        using drone::simulator::physics::CellOcvTable;
+        if (ocv_table_v.size() != CellOcvTable::kSamples) {
+            return CellOcvTable::forChemistry(chemistry);
+        }
+        CellOcvTable::Samples samples{};
+        for (std::size_t i = 0; i < samples.size(); ++i) {
+            samples[i] = ocv_table_v[i];
+        }
+        return CellOcvTable(samples);
+    }
+
+    static bool parseChemistry(const std::string& name, drone::simulator::physics::CellChemistry& chemistry) {
+        using drone::simulator::physics::CellChemistry;
+        if (name == "lipo") {
+            chemistry = CellChemistry::LiPo;
+        } else if (name == "liion") {
+            chemistry = CellChemistry::LiIon;
+        } else if (name == "lihv") {
+            chemistry = CellChemistry::LiHV;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+private:
+    bool loadFromYaml(const YAML::Node& yaml_config) {
+        if (!yaml_config["battery"]) {
+            return true;
+        }
+
+        const auto battery = yaml_config["battery"];
+        if (battery["chemistry"] && !parseChemistry(battery["chemistry"].as<std::string>(), chemistry)) {
+            return false;
+        }
+        if (battery["ocv_table_v"]) {
+            const auto table = battery["ocv_table_v"];
+            if (!table.IsSequence() || table.size() != drone::simulator::physics::CellOcvTable::kSamples) {
+                return false;
+            }
+            ocv_table_v = table.as<std::vector<double>>();
+        }
+        if (battery["mission_reserve_soc_percent"]) {
+            mission_reserve_soc_percent = battery["mission_reserve_soc_percent"].as<double>();
+            if (mission_reserve_soc_percent < 0.0 || mission_reserve_soc_percent >= 100.0) {
+                return false;
+            }
+        }
+        if (battery["mission_reject_infeasible"]) {
+            mission_reject_infeasible = battery["mission_reject_infeasible"].as<bool>();
+        }
+        return true;
+    }
+};
+
+}  // namespace drone::simulator::config
+
+#endif  // SIMULATOR_CONFIG_BATTERY_CONFIG_H
@@ -0,0 +1,75 @@
+#ifndef SIMULATOR_CONFIG_IMU_CONFIG_H
+#define SIMULATOR_CONFIG_IMU_CONFIG_H
+
+#include <cstdint>
+#include <string>
+
+#include <yaml-cpp/yaml.h>
+
+#include "drone/drone_data_types.h"
+#include "simulator/physics/imu_sim.h"
+
+namespace drone::simulator::config {
+
+class ImuConfig {
+public:
+    bool enabled = false;
+    drone::simulator::physics::ImuSpecs specs{};
+
+    bool loadFromFile(const std::string& config_file) {
+        try {
+            const YAML::Node yaml_config = YAML::LoadFile(config_file);
+            return loadFromYaml(yaml_config);
+        } catch (const YAML::Exception&) {
+            return false;
+        }
+    }
+
+private:
+    bool loadFromYaml(const YAML::Node& yaml_config) {
+        if (!yaml_config["imu"]) {
+            return true;
+        }
+
+        const auto imu = yaml_config["imu"];
+        readIfPresent(imu, "enabled", enabled);
+        readIfPresent(imu, "sample_rate_hz", specs.sample_rate_hz);
+        readIfPresent(imu, "fifo_capacity", specs.fifo_capacity);
+        readVector3IfPresent(imu, "accel_bias_ms2", specs.accel_bias_ms2);
+        readIfPresent(imu, "accel_noise_std_ms2", specs.accel_noise_std_ms2);
+        readIfPresent(imu, "accel_bias_walk_ms2_per_sqrt_s", specs.accel_bias_walk_ms2_per_sqrt_s);
+        readIfPresent(imu, "accel_lsb_ms2", specs.accel_lsb_ms2);
+        readIfPresent(imu, "accel_range_ms2", specs.accel_range_ms2);
+        readVector3IfPresent(imu, "gyro_bias_rps", specs.gyro_bias_rps);
+        readIfPresent(imu, "gyro_noise_std_rps", specs.gyro_noise_std_rps);
+        readIfPresent(imu, "gyro_bias_walk_rps_per_sqrt_s", specs.gyro_bias_walk_rps_per_sqrt_s);
+        readIfPresent(imu, "gyro_lsb_rps", specs.gyro_lsb_rps);
+        readIfPresent(imu, "gyro_range_rps", specs.gyro_range_rps);
+        readIfPresent(imu, "random_seed", specs.random_seed);
+        return specs.sample_rate_hz > 0.0;
+    }
+
+    template <typename T>
+    static void readIfPresent(const YAML::Node& node, const char* key, T& value) {
+        if (node[key]) {
+            value = node[key].as<T>();
+        }
+    }
+
+    static void readVector3IfPresent(const YAML::Node& node, const char* key, drone::Vector3& value) {
+        if (!node[key]) {
+            return;
+        }
+        const auto vector_node = node[key];
+        if (!vector_node.IsSequence() || vector_node.size() != 3) {
+            return;
+        }
+        value.x = vector_node[0].as<double>();
+        value.y = vector_node[1].as<double>();
+        value.z = vector_node[2].as<double>();
+    }
+};
+
+}  // namespace drone::simulator::config
+
+#endif  // SIMULATOR_CONFIG_IMU_CONFIG_H
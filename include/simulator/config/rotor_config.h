@@ -0,0 +1,49 @@
+#ifndef SIMULATOR_CONFIG_ROTOR_CONFIG_H
+#define SIMULATOR_CONFIG_ROTOR_CONFIG_H
+
+#include <cstddef>
+#include <string>
+
+#include <yaml-cpp/yaml.h>
+
+namespace drone::simulator::config {
+
+class RotorConfig {
+public:
+    // Propeller test-stand CSV (see RotorCurveTable::loadCsv); empty keeps the quadratic thrust law
+    std::string curve_file;
+    // Uniform RPM grid the curve is resampled onto
+    std::size_t curve_rpm_samples = 64;
+
+    bool loadFromFile(const std::string& config_file) {
+        try {
+            const YAML::Node yaml_config = YAML::LoadFile(config_file);
+            return loadFromYaml(yaml_config);
+        } catch (const YAML::Exception&) {
+            return false;
+        }
+    }
+
+private:
+    bool loadFromYaml(const YAML::Node& yaml_config) {
+        if (!yaml_config["rotor"]) {
+            return true;
+        }
+
+        const auto rotor = yaml_config["rotor"];
+        readIfPresent(rotor, "curve_file", curve_file);
+        readIfPresent(rotor, "curve_rpm_samples", curve_rpm_samples);
+        return curve_rpm_samples >= 2;
+    }
+
+    template <typename T>
+    static void readIfPresent(const YAML::Node& node, const char* key, T& value) {
+        if (node[key]) {
+            value = node[key].as<T>();
+        }
+    }
+};
+
+}  // namespace drone::simulator::config
+
+#endif  // SIMULATOR_CONFIG_ROTOR_CONFIG_H
@@ -0,0 +1,67 @@
+#ifndef SIMULATOR_CONFIG_SENSOR_NOISE_CONFIG_H
+#define SIMULATOR_CONFIG_SENSOR_NOISE_CONFIG_H
+
+#include <cstdint>
+#include <string>
+
+#include <yaml-cpp/yaml.h>
+
+namespace drone::simulator::config {
+
+class SensorNoiseConfig {
+public:
+    double altitude_std_m = 0.15;
+    double gps_north_std_m = 1.5;
+    double gps_east_std_m = 1.5;
+    double gps_altitude_std_m = 2.5;
+    double gps_velocity_north_std_mps = 0.3;
+    double gps_velocity_east_std_mps = 0.3;
+    double gps_velocity_down_std_mps = 0.3;
+    double battery_voltage_std_v = 0.03;
+    double motor_temperature_std_c = 0.2;
+    // 0 seeds from std::random_device
+    uint64_t random_seed = 0;
+    // Ticks of noise generated per batch
+    uint32_t block_size = 256;
+
+    bool loadFromFile(const std::string& config_file) {
+        try {
+            const YAML::Node yaml_config = YAML::LoadFile(config_file);
+            return loadFromYaml(yaml_config);
+        } catch (const YAML::Exception&) {
+            return false;
+        }
+    }
+
+private:
+    bool loadFromYaml(const YAML::Node& yaml_config) {
+        if (!yaml_config["sensor_noise"]) {
+            return true;
+        }
+
+        const auto noise = yaml_config["sensor_noise"];
+        readIfPresent(noise, "altitude_std_m", altitude_std_m);
+        readIfPresent(noise, "gps_north_std_m", gps_north_std_m);
+        readIfPresent(noise, "gps_east_std_m", gps_east_std_m);
+        readIfPresent(noise, "gps_altitude_std_m", gps_altitude_std_m);
+        readIfPresent(noise, "gps_velocity_north_std_mps", gps_velocity_north_std_mps);
+        readIfPresent(noise, "gps_velocity_east_std_mps", gps_velocity_east_std_mps);
+        readIfPresent(noise, "gps_velocity_down_std_mps", gps_velocity_down_std_mps);
+        readIfPresent(noise, "battery_voltage_std_v", battery_voltage_std_v);
+        readIfPresent(noise, "motor_temperature_std_c", motor_temperature_std_c);
+        readIfPresent(noise, "random_seed", random_seed);
+        readIfPresent(noise, "block_size", block_size);
+        return true;
+    }
+
+    template <typename T>
+    static void readIfPresent(const YAML::Node& node, const char* key, T& value) {
+        if (node[key]) {
+            value = node[key].as<T>();
+        }
+    }
+};
+
+}  // namespace drone::simulator::config
+
+#endif  // SIMULATOR_CONFIG_SENSOR_NOISE_CONFIG_H
@@ -0,0 +1,104 @@
+#ifndef SIMULATOR_CONFIG_SURROGATE_MODEL_CONFIG_H
+#define SIMULATOR_CONFIG_SURROGATE_MODEL_CONFIG_H
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <yaml-cpp/yaml.h>
+
+#include "simulator/runtime/surrogate_vehicle.h"
+
+namespace drone::simulator::config {
+
+// SurrogateModel as written by the surrogate_linearize tool
+class SurrogateModelConfig {
+public:
+    drone::simulator::runtime::SurrogateModel model;
+
+    bool loadFromFile(const std::string& config_file) {
+        try {
+            const YAML::Node yaml_config = YAML::LoadFile(config_file);
+            return loadFromYaml(yaml_config);
+        } catch (const YAML::Exception&) {
+            return false;
+        }
+    }
+
+    bool saveToFile(const std::string& config_file) const {
+        using drone::simulator::runtime::kSurrogateInputCount;
+        using drone::simulator::runtime::kSurrogateStateCount;
+        YAML::Emitter out;
+        out << YAML::BeginMap << YAML::Key << "surrogate_model" << YAML::Value << YAML::BeginMap;
+        out << YAML::Key << "hover_rpm" << YAML::Value << model.hover_rpm;
+        out << YAML::Key << "hover_thrust_accel_mps2" << YAML::Value << model.hover_thrust_accel_mps2;
+        out << YAML::Key << "motor_time_constant_s" << YAML::Value << model.motor_time_constant_s;
+        out << YAML::Key << "motor_max_speed_rpm" << YAML::Value << model.motor_max_speed_rpm;
+        out << YAML::Key << "battery_voltage_v" << YAML::Value << model.battery_voltage_v;
+        out << YAML::Key << "a" << YAML::Comment("rows: vx vy vz rpm_0..3, columns: same");
+        out << YAML::Value << YAML::BeginSeq;
+        for (std::size_t row = 0; row < kSurrogateStateCount; ++row) {
+            out << YAML::Flow << YAML::BeginSeq;
+            for (std::size_t column = 0; column < kSurrogateStateCount; ++column) {
+                out << model.a[row * kSurrogateStateCount + column];
+            }
+            out << YAML::EndSeq;
+        }
+        out << YAML::EndSeq;
+        out << YAML::Key << "b" << YAML::Comment("rows: vx vy vz rpm_0..3, columns: rpm_ref_0..3 pitch roll");
+        out << YAML::Value << YAML::BeginSeq;
+        for (std::size_t row = 0; row < kSurrogateStateCount; ++row) {
+            out << YAML::Flow << YAML::BeginSeq;
+            for (std::size_t column = 0; column < kSurrogateInputCount; ++column) {
+                out << model.b[row * kSurrogateInputCount + column];
+            }
+            out << YAML::EndSeq;
+        }
+        out << YAML::EndSeq;
+        out << YAML::EndMap << YAML::EndMap;
+
+        std::ofstream file(config_file, std::ios::trunc);
+        file << out.c_str() << "\n";
+        return static_cast<bool>(file);
+    }
+
+private:
+    template <std::size_t Rows, std::size_t Columns, typename Matrix>
+    static bool parseMatrix(const YAML::Node& node, Matrix& matrix) {
+        if (!node || !node.IsSequence() || node.size() != Rows) {
+            return false;
+        }
+        for (std::size_t row = 0; row < Rows; ++row) {
+            const auto values = node[row].as<std::vector<double>>();
+            if (values.size() != Columns) {
+                return false;
+            }
+            for (std::size_t column = 0; column < Columns; ++column) {
+                matrix[row * Columns + column] = values[column];
+            }
+        }
+        return true;
+    }
+
+    bool loadFromYaml(const YAML::Node& yaml_config) {
+        using drone::simulator::runtime::kSurrogateInputCount;
+        using drone::simulator::runtime::kSurrogateStateCount;
+        const YAML::Node surrogate = yaml_config["surrogate_model"];
+        if (!surrogate || !surrogate["hover_rpm"]) {
+            return false;
+        }
+        model.hover_rpm = surrogate["hover_rpm"].as<double>();
+        model.hover_thrust_accel_mps2 =
+            surrogate["hover_thrust_accel_mps2"].as<double>(model.hover_thrust_accel_mps2);
+        model.motor_time_constant_s = surrogate["motor_time_constant_s"].as<double>(model.motor_time_constant_s);
+        model.motor_max_speed_rpm = surrogate["motor_max_speed_rpm"].as<double>(model.motor_max_speed_rpm);
+        model.battery_voltage_v = surrogate["battery_voltage_v"].as<double>(model.battery_voltage_v);
+        return parseMatrix<kSurrogateStateCount, kSurrogateStateCount>(surrogate["a"], model.a) &&
+               parseMatrix<kSurrogateStateCount, kSurrogateInputCount>(surrogate["b"], model.b);
+    }
+};
+
+}  // namespace drone::simulator::config
+
+#endif  // SIMULATOR_CONFIG_SURROGATE_MODEL_CONFIG_H
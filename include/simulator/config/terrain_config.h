@@ -0,0 +1,49 @@
+#ifndef SIMULATOR_CONFIG_TERRAIN_CONFIG_H
+#define SIMULATOR_CONFIG_TERRAIN_CONFIG_H
+
+#include <cstdint>
+#include <string>
+
+#include <yaml-cpp/yaml.h>
+
+namespace drone::simulator::config {
+
+class TerrainConfig {
+public:
+    // Tiled elevation model directory (see TerrainMap); empty means flat ground at z = 0
+    std::string terrain_dir;
+    // Tiles kept mapped at once
+    uint32_t cache_tiles = 16;
+
+    bool loadFromFile(const std::string& config_file) {
+        try {
+            const YAML::Node yaml_config = YAML::LoadFile(config_file);
+            return loadFromYaml(yaml_config);
+        } catch (const YAML::Exception&) {
+            return false;
+        }
+    }
+
+private:
+    bool loadFromYaml(const YAML::Node& yaml_config) {
+        if (!yaml_config["terrain"]) {
+            return true;
+        }
+
+        const auto terrain = yaml_config["terrain"];
+        readIfPresent(terrain, "terrain_dir", terrain_dir);
+        readIfPresent(terrain, "cache_tiles", cache_tiles);
+        return true;
+    }
+
+    template <typename T>
+    static void readIfPresent(const YAML::Node& node, const char* key, T& value) {
+        if (node[key]) {
+            value = node[key].as<T>();
+        }
+    }
+};
+
+}  // namespace drone::simulator::config
+
+#endif  // SIMULATOR_CONFIG_TERRAIN_CONFIG_H
@@ -17,6 +17,15 @@ public:
     double gust_frequency_hz = 0.2;
     drone::Vector3 turbulence_std_enu_ms2{0.0, 0.0, 0.0};
     uint32_t random_seed = 42;
+    // "white": independent samples per step; "dryden": Dryden-shaped, correlated over L / V
+    std::string turbulence_model = "white";
+    drone::Vector3 dryden_length_scale_m{200.0, 200.0, 50.0};
+    double dryden_airspeed_mps = 10.0;
+    uint32_t turbulence_block_size = 256;
+    // Directory for precomputed weather tapes; empty disables tape playback
+    std::string tape_dir;
+    // Binary 3D wind grid (see WindField); empty disables spatial wind
+    std::string wind_field_file;
 
     bool loadFromFile(const std::string& config_file) {
         try {
@@ -40,6 +49,12 @@ private:
         readIfPresent(weather, "gust_frequency_hz", gust_frequency_hz);
         readVector3IfPresent(weather, "turbulence_std_enu_ms2", turbulence_std_enu_ms2);
         readIfPresent(weather, "random_seed", random_seed);
+        readIfPresent(weather, "turbulence_model", turbulence_model);
+        readVector3IfPresent(weather, "dryden_length_scale_m", dryden_length_scale_m);
+        readIfPresent(weather, "dryden_airspeed_mps", dryden_airspeed_mps);
+        readIfPresent(weather, "turbulence_block_size", turbulence_block_size);
+        readIfPresent(weather, "tape_dir", tape_dir);
+        readIfPresent(weather, "wind_field_file", wind_field_file);
         return true;
     }
 
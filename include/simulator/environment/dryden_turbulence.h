@@ -0,0 +1,68 @@
+#ifndef SIMULATOR_ENVIRONMENT_DRYDEN_TURBULENCE_H
+#define SIMULATOR_ENVIRONMENT_DRYDEN_TURBULENCE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "drone/drone_data_types.h"
+#include "simulator/random/gaussian_block.h"
+
+namespace drone::simulator::environment {
+
+/**
+ * @brief Dryden-shaped turbulence, exactly discretized for the step size in use.
+ *
+ * x uses the first-order longitudinal form sigma * sqrt(2L/(pi V)) / (1 + (L/V) s);
+ * y and z use the second-order lateral/vertical form with (1 + sqrt(3) (L/V) s) / (1 + (L/V) s)^2.
+ * The state transition and process-noise covariance are computed for the actual dt,
+ * so the output keeps standard deviation sigma and correlation time L/V for any dt.
+ * Samples are produced in blocks from a vectorizable Gaussian generator.
+ */
+class DrydenTurbulence {
+public:
+    static constexpr std::size_t kDefaultBlockSize = 256;
+
+    void configure(const drone::Vector3& sigma,
+                   const drone::Vector3& length_scale_m,
+                   double airspeed_mps,
+                   std::uint64_t seed,
+                   std::size_t block_size = kDefaultBlockSize);
+
+    // Advance by dt_s and return the turbulence; a changed dt re-discretizes the filters
+    drone::Vector3 next(double dt_s);
+
+private:
+    struct AxisFilter {
+        bool second_order = false;
+        bool white = true;      // no valid time constant: plain white noise
+        double tau_s = 0.0;
+        double output_gain = 0.0;
+        double c1 = 0.0;        // output = c1 * x1 + c2 * x2
+        double c2 = 0.0;
+        double a11 = 0.0, a12 = 0.0, a21 = 0.0, a22 = 0.0;
+        double l11 = 0.0, l21 = 0.0, l22 = 0.0;  // Cholesky factor of the process noise
+        double x1 = 0.0;
+        double x2 = 0.0;
+    };
+
+    void discretize(double dt_s);
+    void refill();
+
+    std::array<AxisFilter, 3> axes_{};
+    drone::simulator::random::GaussianBlockGenerator gaussian_{};
+    std::size_t block_size_ = kDefaultBlockSize;
+    std::vector<double> noise_;                     // [axis][2][block]
+    std::array<std::vector<double>, 3> output_;     // [axis][block]
+    std::array<std::vector<double>, 3> state_x1_;   // filter state after each sample
+    std::array<std::vector<double>, 3> state_x2_;
+    std::size_t cursor_ = 0;
+    std::size_t filled_ = 0;
+    double dt_s_ = 0.0;
+    bool configured_ = false;
+};
+
+}  // namespace drone::simulator::environment
+
+#endif  // SIMULATOR_ENVIRONMENT_DRYDEN_TURBULENCE_H
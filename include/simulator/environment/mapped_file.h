@@ -0,0 +1,13 @@
+#ifndef SIMULATOR_ENVIRONMENT_MAPPED_FILE_H
+#define SIMULATOR_ENVIRONMENT_MAPPED_FILE_H
+
+#include "drone/io/mapped_file.h"
+
+namespace drone::simulator::environment {
+
+// Lives in the drone library so flight-side code (mission images) can map files too
+using MappedFile = drone::io::MappedFile;
+
+}  // namespace drone::simulator::environment
+
+#endif  // SIMULATOR_ENVIRONMENT_MAPPED_FILE_H
@@ -0,0 +1,80 @@
+#ifndef SIMULATOR_ENVIRONMENT_TERRAIN_MAP_H
+#define SIMULATOR_ENVIRONMENT_TERRAIN_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "simulator/environment/mapped_file.h"
+
+namespace drone::simulator::environment {
+
+// Geometry of a tiled elevation grid; heights are ENU z in meters
+struct TerrainGridSpec {
+    std::uint32_t tile_cells = 256;   // cells per tile side; a tile file holds (tile_cells + 1)^2 samples
+    std::uint32_t tiles_x = 1;
+    std::uint32_t tiles_y = 1;
+    double origin_x_m = 0.0;          // ENU position of sample (0, 0)
+    double origin_y_m = 0.0;
+    double spacing_m = 1.0;
+    double default_height_m = 0.0;    // outside the grid and for missing tiles
+};
+
+/**
+ * @brief Digital elevation model stored as a directory of raster tiles.
+ *
+ * `terrain.hdr` holds the grid spec; each `tile_<ix>_<iy>.dem` holds float32 heights,
+ * row-major by y, including the shared edge row/column so a bilinear cell never spans
+ * two tiles. Tiles are memory-mapped on first use and kept in an LRU cache of
+ * cache_tiles entries; missing tile files read as default_height_m.
+ *
+ * Queries mutate the cache, so a TerrainMap belongs to one thread; separate maps of the
+ * same directory share tile pages through the OS page cache.
+ */
+class TerrainMap {
+public:
+    static constexpr std::size_t kDefaultCacheTiles = 16;
+
+    /**
+     * @brief Write a tiled terrain directory from dense heights.
+     * @param heights_m Row-major [y][x] samples, (tiles_y * tile_cells + 1) x (tiles_x * tile_cells + 1).
+     */
+    static bool write(const std::string& terrain_dir, const TerrainGridSpec& spec, const std::vector<float>& heights_m);
+
+    static std::shared_ptr<TerrainMap> open(const std::string& terrain_dir, std::size_t cache_tiles = kDefaultCacheTiles);
+
+    // Bilinear terrain height at an ENU horizontal position
+    double heightAtM(double x_m, double y_m) const;
+
+    const TerrainGridSpec& spec() const { return spec_; }
+    std::size_t residentTiles() const { return slot_of_tile_.size(); }
+    std::uint64_t tileLoads() const { return tile_loads_; }
+
+private:
+    struct TileSlot {
+        std::uint64_t key = 0;
+        std::uint64_t last_use = 0;
+        MappedFile file;
+        const float* heights = nullptr;   // nullptr: tile missing, use default height
+    };
+
+    TerrainMap() = default;
+    TileSlot& tile(std::uint32_t tile_x, std::uint32_t tile_y) const;
+
+    std::string directory_;
+    TerrainGridSpec spec_{};
+    double inv_spacing_ = 1.0;
+    std::size_t samples_per_row_ = 0;
+    mutable std::vector<TileSlot> slots_;
+    mutable std::unordered_map<std::uint64_t, std::size_t> slot_of_tile_;
+    mutable TileSlot* last_slot_ = nullptr;   // fast path for consecutive queries in one tile
+    mutable std::uint64_t use_clock_ = 0;
+    mutable std::uint64_t tile_loads_ = 0;
+};
+
+}  // namespace drone::simulator::environment
+
+#endif  // SIMULATOR_ENVIRONMENT_TERRAIN_MAP_H
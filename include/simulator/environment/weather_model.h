@@ -1,10 +1,14 @@
 #ifndef SIMULATOR_ENVIRONMENT_WEATHER_MODEL_H
 #define SIMULATOR_ENVIRONMENT_WEATHER_MODEL_H
 
+#include <memory>
 #include <random>
 
 #include "drone/drone_data_types.h"
 #include "simulator/config/weather_config.h"
+#include "simulator/environment/dryden_turbulence.h"
+#include "simulator/environment/weather_tape.h"
+#include "simulator/environment/wind_field.h"
 
 namespace drone::simulator::environment {
 
@@ -13,6 +17,7 @@ struct WeatherSample {
     drone::Vector3 gust_accel_enu_ms2{};
     drone::Vector3 turbulence_accel_enu_ms2{};
     drone::Vector3 total_accel_enu_ms2{};
+    drone::Vector3 wind_velocity_enu_mps{};  // air velocity from the wind field, acts through drag
 };
 
 class WeatherModel {
@@ -22,12 +27,31 @@ public:
     void setConfig(const drone::simulator::config::WeatherConfig& weather_config);
     WeatherSample sample(double elapsed_s);
 
+    /**
+     * @brief Play gust and turbulence back from a precomputed tape.
+     *
+     * The tape must have been generated from the same config (see WeatherTape::loadOrGenerate).
+     * sample(t) returns tape entry round(t / dt); past the end of the tape the live model is used.
+     * Pass nullptr to return to live generation.
+     */
+    void setTape(std::shared_ptr<const WeatherTape> tape) { tape_ = std::move(tape); }
+    WeatherSample sampleAt(std::size_t tape_index) const;
+
+    // Spatial wind field queried by the position-aware sample(); nullptr disables it
+    void setWindField(std::shared_ptr<const WindField> wind_field) { wind_sampler_ = WindFieldSampler(std::move(wind_field)); }
+    WeatherSample sample(double elapsed_s, const drone::Vector3& position_enu_m);
+
 private:
     drone::simulator::config::WeatherConfig config_{};
     std::mt19937 rng_;
     std::normal_distribution<double> turbulence_dist_x_{0.0, 0.0};
     std::normal_distribution<double> turbulence_dist_y_{0.0, 0.0};
     std::normal_distribution<double> turbulence_dist_z_{0.0, 0.0};
+    bool dryden_enabled_ = false;
+    DrydenTurbulence dryden_{};
+    double last_elapsed_s_ = 0.0;
+    std::shared_ptr<const WeatherTape> tape_;
+    WindFieldSampler wind_sampler_{};
 };
 
 }  // namespace drone::simulator::environment
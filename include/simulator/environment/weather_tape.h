@@ -0,0 +1,72 @@
+#ifndef SIMULATOR_ENVIRONMENT_WEATHER_TAPE_H
+#define SIMULATOR_ENVIRONMENT_WEATHER_TAPE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "simulator/config/weather_config.h"
+#include "simulator/environment/mapped_file.h"
+
+namespace drone::simulator::environment {
+
+// One tick of precomputed time-varying disturbance (steady part comes from the config)
+struct WeatherTapeSample {
+    double gust_enu_ms2[3];
+    double turbulence_enu_ms2[3];
+};
+
+/**
+ * @brief Precomputed weather disturbance time series backed by a read-only file mapping.
+ *
+ * A tape is identified by (config, seed, dt, duration). Sample i is what a live
+ * WeatherModel sampled once per tick from t = 0 returns at elapsed time i * dt, so
+ * every run playing the same tape sees identical weather with no RNG or trig work.
+ * Every process mapping the same file shares its pages; openShared() additionally
+ * shares one mapping between threads.
+ */
+class WeatherTape {
+public:
+    WeatherTape(const WeatherTape&) = delete;
+    WeatherTape& operator=(const WeatherTape&) = delete;
+
+    // Key of the tape a (config, dt, duration) run needs
+    static std::uint64_t computeKey(const drone::simulator::config::WeatherConfig& config,
+                                    double dt_s,
+                                    double duration_s);
+    static std::string fileNameForKey(std::uint64_t key);
+
+    static bool generate(const drone::simulator::config::WeatherConfig& config,
+                         double dt_s,
+                         double duration_s,
+                         const std::string& tape_file);
+
+    static std::shared_ptr<const WeatherTape> open(const std::string& tape_file);
+    // Reuses an already open mapping of the same file within this process
+    static std::shared_ptr<const WeatherTape> openShared(const std::string& tape_file);
+
+    // Opens the matching tape in tape_dir, generating it first if missing or stale
+    static std::shared_ptr<const WeatherTape> loadOrGenerate(const drone::simulator::config::WeatherConfig& config,
+                                                             double dt_s,
+                                                             double duration_s,
+                                                             const std::string& tape_dir);
+
+    std::uint64_t key() const { return key_; }
+    double dtS() const { return dt_s_; }
+    std::size_t size() const { return sample_count_; }
+    const WeatherTapeSample& operator[](std::size_t index) const { return samples_[index]; }
+
+private:
+    WeatherTape() = default;
+
+    std::uint64_t key_ = 0;
+    double dt_s_ = 0.0;
+    std::size_t sample_count_ = 0;
+    const WeatherTapeSample* samples_ = nullptr;
+    MappedFile file_;
+};
+
+}  // namespace drone::simulator::environment
+
+#endif  // SIMULATOR_ENVIRONMENT_WEATHER_TAPE_H
@@ -0,0 +1,114 @@
+#ifndef SIMULATOR_ENVIRONMENT_WIND_FIELD_H
+#define SIMULATOR_ENVIRONMENT_WIND_FIELD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "drone/drone_data_types.h"
+#include "simulator/environment/mapped_file.h"
+
+namespace drone::simulator::environment {
+
+// Geometry of a wind grid: nx * ny * nz nodes per time slice, nt slices
+struct WindGridSpec {
+    std::uint32_t nx = 1;
+    std::uint32_t ny = 1;
+    std::uint32_t nz = 1;
+    std::uint32_t nt = 1;
+    drone::Vector3 origin_enu_m{};   // position of node (0, 0, 0)
+    drone::Vector3 spacing_m{1.0, 1.0, 1.0};
+    double t0_s = 0.0;               // time of slice 0
+    double slice_dt_s = 1.0;         // time between slices
+};
+
+/**
+ * @brief Time-varying 3D wind velocity field backed by a read-only file mapping.
+ *
+ * Nodes are stored as float triplets in cubic tiles (tile_size^3 nodes, z-y-x order
+ * inside a tile) so the eight corners of a cell usually share one cache-friendly
+ * block. Use WindFieldSampler to query it.
+ */
+class WindField {
+public:
+    static constexpr std::uint32_t kDefaultTileSize = 8;
+
+    /**
+     * @brief Write a field from dense node data.
+     * @param wind_enu_mps Node velocities indexed [t][z][y][x] (nt * nz * ny * nx entries).
+     */
+    static bool write(const std::string& field_file,
+                      const WindGridSpec& spec,
+                      const std::vector<drone::Vector3>& wind_enu_mps,
+                      std::uint32_t tile_size = kDefaultTileSize);
+
+    static std::shared_ptr<const WindField> open(const std::string& field_file);
+
+    const WindGridSpec& spec() const { return spec_; }
+    std::uint32_t tileSize() const { return tile_size_; }
+
+    // Wind velocity at grid node (i, j, k) of slice t
+    drone::Vector3 node(std::uint32_t t, std::uint32_t i, std::uint32_t j, std::uint32_t k) const {
+        const float* value = nodeData(t, i, j, k);
+        return drone::Vector3(value[0], value[1], value[2]);
+    }
+
+    const float* nodeData(std::uint32_t t, std::uint32_t i, std::uint32_t j, std::uint32_t k) const {
+        const std::size_t tile = (static_cast<std::size_t>(k >> tile_shift_) * tiles_y_ + (j >> tile_shift_)) * tiles_x_ +
+                                 (i >> tile_shift_);
+        const std::size_t local = (static_cast<std::size_t>(k & tile_mask_) << (2 * tile_shift_)) +
+                                  ((j & tile_mask_) << tile_shift_) + (i & tile_mask_);
+        return nodes_ + (t * slice_stride_ + tile * tile_stride_ + local) * 3;
+    }
+
+private:
+    WindField() = default;
+
+    WindGridSpec spec_{};
+    std::uint32_t tile_size_ = kDefaultTileSize;
+    std::uint32_t tile_shift_ = 3;
+    std::uint32_t tile_mask_ = kDefaultTileSize - 1;
+    std::size_t tiles_x_ = 1;
+    std::size_t tiles_y_ = 1;
+    std::size_t tile_stride_ = 0;   // nodes per tile
+    std::size_t slice_stride_ = 0;  // nodes per time slice including tile padding
+    const float* nodes_ = nullptr;
+    MappedFile file_;
+};
+
+/**
+ * @brief Per-vehicle cursor for trilinear (space) and linear (time) wind lookups.
+ *
+ * Positions and times outside the grid are clamped to its edge. The 16 corner
+ * values of the last cell/slice pair are cached, so consecutive samples of a
+ * vehicle moving inside one cell only do the interpolation arithmetic.
+ */
+class WindFieldSampler {
+public:
+    WindFieldSampler() = default;
+    explicit WindFieldSampler(std::shared_ptr<const WindField> field);
+
+    bool hasField() const { return field_ != nullptr; }
+    drone::Vector3 sample(const drone::Vector3& position_enu_m, double time_s);
+
+    std::uint64_t cacheHits() const { return cache_hits_; }
+    std::uint64_t cacheMisses() const { return cache_misses_; }
+
+private:
+    void loadCell(std::uint32_t i, std::uint32_t j, std::uint32_t k, std::uint32_t t);
+
+    std::shared_ptr<const WindField> field_;
+    std::int64_t cached_i_ = -1;
+    std::int64_t cached_j_ = -1;
+    std::int64_t cached_k_ = -1;
+    std::int64_t cached_t_ = -1;
+    double corners_[2][8][3] = {};  // [slice][corner zyx bits][axis]
+    std::uint64_t cache_hits_ = 0;
+    std::uint64_t cache_misses_ = 0;
+};
+
+}  // namespace drone::simulator::environment
+
+#endif  // SIMULATOR_ENVIRONMENT_WIND_FIELD_H
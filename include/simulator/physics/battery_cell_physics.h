@@ -13,6 +13,13 @@ public:
     static void setStateOfChargePercent(Battery_Cell& cell, double soc_percent);
     static void update(Battery_Cell& cell, int delta_time_ms = 1000);
 
+    // Open-circuit voltage at a state of charge, and its exact integral over a SOC interval [V * %]
+    static double openCircuitVoltageV(double soc_percent);
+    static double integrateOpenCircuitVoltage(double soc_from_percent, double soc_to_percent);
+
+    // Constant-current discharge over a step of any length; returns energy delivered in Wh
+    static double discharge(Battery_Cell& cell, double delta_time_s);
+
 };
 
 } // namespace drone::simulator::physics
@@ -6,29 +6,68 @@
 
 #include "drone/model/components/battery_base.h"
 #include "drone/model/components/battery_cell.h"
+#include "simulator/physics/cell_ocv_table.h"
 
 namespace drone::simulator::physics {
 
+/**
+ * @brief Simulated series-parallel battery pack.
+ *
+ * Cell state is stored as structure-of-arrays so the whole pack advances in one
+ * tight loop, and pack aggregates are cached after every state change so the
+ * Battery_base getters are O(1) regardless of cell count.
+ */
 class BatterySim final : public drone::model::components::Battery_base {
 public:
     BatterySim(const std::string& name, const drone::model::components::BatterySpecs& specs);
 
     std::string getName() const override;
-    double getVoltageV() const override;
-    double getCurrentA() const override;
-    double getStateOfChargePercent() const override;
-    double getRemainingCapacityMah() const override;
-    double getRemainingEnergyWh() const override;
+    double getVoltageV() const override { return pack_state_.voltage_v; }
+    double getCurrentA() const override { return pack_current_a_; }
+    double getStateOfChargePercent() const override { return pack_state_.state_of_charge_percent; }
+    double getRemainingCapacityMah() const override { return pack_state_.remaining_capacity_mah; }
+    double getRemainingEnergyWh() const override { return pack_state_.remaining_energy_wh; }
     double getWeightKg() const override;
 
     void setCurrentA(double current_a);
     void setStateOfChargePercent(double soc_percent);
     void update(int delta_time_ms = 1000);
 
+    // Constant-current discharge of every cell over a step of any length
+    void advance(double delta_time_s);
+    double getConsumedEnergyWh() const { return consumed_energy_wh_; }
+
+    std::size_t getCellCount() const { return cell_capacity_mah_.size(); }
+    const drone::model::components::BatterySpecs& getSpecs() const { return specs_; }
+    const CellOcvTable& getOcvTable() const { return ocv_table_; }
+
+    // Replace the cell chemistry curve; cell voltages are re-evaluated at the current SOC
+    void setOcvTable(const CellOcvTable& ocv_table);
+
 private:
+    struct PackState {
+        double voltage_v = 0.0;
+        double state_of_charge_percent = 0.0;
+        double remaining_capacity_mah = 0.0;
+        double remaining_energy_wh = 0.0;
+    };
+
+    void refreshPackState();
+
     std::string name_;
     drone::model::components::BatterySpecs specs_;
-    std::vector<drone::model::components::Battery_Cell> cells_;
+
+    // per-cell state, index = series_group * parallel_cells + parallel_index
+    std::vector<double> cell_nominal_capacity_mah_;
+    std::vector<double> cell_capacity_mah_;
+    std::vector<double> cell_soc_percent_;
+    std::vector<double> cell_voltage_v_;
+    std::vector<double> cell_prev_soc_percent_;  // scratch for energy integration
+
+    CellOcvTable ocv_table_ = CellOcvTable::lipo();
+    double pack_current_a_ = 0.0;
+    double consumed_energy_wh_ = 0.0;
+    PackState pack_state_{};
 };
 
 } // namespace drone::simulator::physics
@@ -0,0 +1,110 @@
+#ifndef CELL_OCV_TABLE_H
+#define CELL_OCV_TABLE_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+namespace drone::simulator::physics {
+
+enum class CellChemistry {
+    LiPo,
+    LiIon,
+    LiHV,
+};
+
+/**
+ * @brief Open-circuit voltage of a cell chemistry sampled on a uniform SOC grid.
+ *
+ * Samples are taken every 5% from 0% to 100% SOC. Lookups clamp the SOC and
+ * interpolate linearly without branching, so a pack can evaluate every cell in
+ * one straight loop. The running integral of the curve is precomputed per grid
+ * cell so discharge energy over any SOC interval is two lookups.
+ */
+class CellOcvTable {
+public:
+    static constexpr std::size_t kSamples = 21;
+    static constexpr double kSocStepPercent = 100.0 / (kSamples - 1);
+    using Samples = std::array<double, kSamples>;
+
+    constexpr explicit CellOcvTable(const Samples& voltage_v)
+        : voltage_v_(voltage_v), delta_v_{}, integral_v_percent_{} {
+        for (std::size_t i = 0; i + 1 < kSamples; ++i) {
+            delta_v_[i] = voltage_v_[i + 1] - voltage_v_[i];
+            integral_v_percent_[i + 1] = integral_v_percent_[i] + 0.5 * (voltage_v_[i] + voltage_v_[i + 1]) * kSocStepPercent;
+        }
+    }
+
+    static constexpr CellOcvTable lipo() {
+        // Bottom knee 3.2->3.5 V below 30%, plateau 3.5->3.9 V to 85%, top knee to 4.2 V
+        return CellOcvTable(Samples{
+            3.20, 3.25, 3.30, 3.35, 3.40, 3.45, 3.50,
+            3.5 + 0.4 * 5.0 / 55.0, 3.5 + 0.4 * 10.0 / 55.0, 3.5 + 0.4 * 15.0 / 55.0,
+            3.5 + 0.4 * 20.0 / 55.0, 3.5 + 0.4 * 25.0 / 55.0, 3.5 + 0.4 * 30.0 / 55.0,
+            3.5 + 0.4 * 35.0 / 55.0, 3.5 + 0.4 * 40.0 / 55.0, 3.5 + 0.4 * 45.0 / 55.0,
+            3.5 + 0.4 * 50.0 / 55.0, 3.90, 4.00, 4.10, 4.20});
+    }
+
+    static constexpr CellOcvTable liIon() {
+        return CellOcvTable(Samples{
+            3.00, 3.30, 3.42, 3.48, 3.53, 3.57, 3.60, 3.63, 3.66, 3.69, 3.72,
+            3.75, 3.79, 3.83, 3.87, 3.92, 3.96, 4.01, 4.06, 4.12, 4.20});
+    }
+
+    static constexpr CellOcvTable liHv() {
+        return CellOcvTable(Samples{
+            3.30, 3.50, 3.60, 3.66, 3.70, 3.73, 3.76, 3.78, 3.80, 3.82, 3.84,
+            3.87, 3.90, 3.94, 3.98, 4.03, 4.08, 4.13, 4.19, 4.26, 4.35});
+    }
+
+    static constexpr CellOcvTable forChemistry(CellChemistry chemistry) {
+        switch (chemistry) {
+            case CellChemistry::LiIon:
+                return liIon();
+            case CellChemistry::LiHV:
+                return liHv();
+            case CellChemistry::LiPo:
+            default:
+                return lipo();
+        }
+    }
+
+    // Open-circuit voltage at a state of charge (clamped to 0..100%)
+    constexpr double voltageV(double soc_percent) const {
+        std::size_t index = 0;
+        double fraction = 0.0;
+        locate(soc_percent, index, fraction);
+        return voltage_v_[index] + fraction * delta_v_[index];
+    }
+
+    // Integral of the curve from 0% to soc_percent [V * %]
+    constexpr double integralFromEmpty(double soc_percent) const {
+        std::size_t index = 0;
+        double fraction = 0.0;
+        locate(soc_percent, index, fraction);
+        const double partial = (voltage_v_[index] + 0.5 * fraction * delta_v_[index]) * fraction * kSocStepPercent;
+        return integral_v_percent_[index] + partial;
+    }
+
+    // Integral over a SOC interval [V * %], negative when soc_to < soc_from
+    constexpr double integrate(double soc_from_percent, double soc_to_percent) const {
+        return integralFromEmpty(soc_to_percent) - integralFromEmpty(soc_from_percent);
+    }
+
+    constexpr const Samples& samples() const { return voltage_v_; }
+
+private:
+    static constexpr void locate(double soc_percent, std::size_t& index, double& fraction) {
+        const double position = std::min(std::max(soc_percent, 0.0), 100.0) / kSocStepPercent;
+        index = std::min(static_cast<std::size_t>(position), kSamples - 2);
+        fraction = position - static_cast<double>(index);
+    }
+
+    Samples voltage_v_;
+    Samples delta_v_;             // voltage rise to the next sample
+    Samples integral_v_percent_;  // integral from 0% up to each sample
+};
+
+} // namespace drone::simulator::physics
+
+#endif // CELL_OCV_TABLE_H
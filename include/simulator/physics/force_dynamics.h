@@ -2,11 +2,20 @@
 #define SIMULATOR_PHYSICS_FORCE_DYNAMICS_H
 
 #include "drone/drone_data_types.h"
+#include "simulator/physics/rigid_body.h"
 
 namespace drone::simulator::physics {
 
 drone::Vector3 rotateBodyToEnu(const drone::Vector3& body_vec, const drone::AttitudeYPR& attitude_ypr);
 
+drone::Vector3 rotateEnuToBody(const drone::Vector3& enu_vec, const drone::AttitudeYPR& attitude_ypr);
+
+// Body angular rate (p, q, r) from yaw/pitch/roll rates for the ZYX convention used by rotateBodyToEnu
+drone::Vector3 eulerRatesToBodyRates(const drone::AttitudeYPR& attitude_ypr,
+                                     double yaw_rate_rps,
+                                     double pitch_rate_rps,
+                                     double roll_rate_rps);
+
 drone::Vector3 computeGravityEnu(double mass_kg, double gravity_ms2 = 9.81);
 
 drone::Vector3 computeLinearDampingEnu(const drone::Vector3& velocity_enu_mps, double damping_n_per_mps);
@@ -19,6 +28,15 @@ drone::Vector3 computeNetForceEnu(
     double damping_n_per_mps,
     double gravity_ms2 = 9.81);
 
+// Same as above with a precomputed body-to-ENU matrix (no trig)
+drone::Vector3 computeNetForceEnu(
+    const drone::Vector3& thrust_body_n,
+    const Matrix3& body_to_enu,
+    double mass_kg,
+    const drone::Vector3& velocity_enu_mps,
+    double damping_n_per_mps,
+    double gravity_ms2 = 9.81);
+
 }  // namespace drone::simulator::physics
 
 #endif  // SIMULATOR_PHYSICS_FORCE_DYNAMICS_H
@@ -0,0 +1,81 @@
+#ifndef SIMULATOR_PHYSICS_IMU_SIM_H
+#define SIMULATOR_PHYSICS_IMU_SIM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "drone/drone_data_types.h"
+#include "drone/runtime/real_drone.h"
+#include "simulator/random/noise_block.h"
+
+namespace drone::simulator::physics {
+
+struct ImuSpecs {
+    double sample_rate_hz = 1000.0;
+    std::size_t fifo_capacity = 512;
+
+    drone::Vector3 accel_bias_ms2{};
+    double accel_noise_std_ms2 = 0.02;
+    double accel_bias_walk_ms2_per_sqrt_s = 0.0;
+    double accel_lsb_ms2 = 0.0;          // 0 disables quantization
+    double accel_range_ms2 = 16.0 * 9.81;
+
+    drone::Vector3 gyro_bias_rps{};
+    double gyro_noise_std_rps = 0.002;
+    double gyro_bias_walk_rps_per_sqrt_s = 0.0;
+    double gyro_lsb_rps = 0.0;           // 0 disables quantization
+    double gyro_range_rps = 34.9;        // 2000 deg/s
+
+    uint64_t random_seed = 42;
+};
+
+// True inertial quantities in the body frame at one instant
+struct ImuTruth {
+    drone::Vector3 specific_force_body_ms2{};
+    drone::Vector3 angular_rate_body_rps{};
+};
+
+/**
+ * @brief Accelerometer + gyroscope with bias, bias random walk, white noise, quantization and saturation.
+ *
+ * Samples are generated at sample_rate_hz independently of the simulation step: advance()
+ * emits every sample due in the step, interpolating the truth linearly across it, into a
+ * FIFO that the consumer drains in batches. Like IMU chips in stream mode, a full FIFO
+ * drops its oldest sample.
+ */
+class ImuSim {
+public:
+    explicit ImuSim(const ImuSpecs& specs = {});
+
+    void setSpecs(const ImuSpecs& specs);
+    const ImuSpecs& getSpecs() const { return specs_; }
+
+    void advance(double dt_s, const ImuTruth& step_start, const ImuTruth& step_end);
+
+    // Move up to capacity samples, oldest first, out of the FIFO
+    std::size_t read(drone::runtime::ImuSample* out, std::size_t capacity);
+
+    std::size_t available() const { return fifo_count_; }
+    uint64_t overflowCount() const { return overflow_count_; }
+    const drone::Vector3& getAccelBiasMs2() const { return accel_bias_ms2_; }
+    const drone::Vector3& getGyroBiasRps() const { return gyro_bias_rps_; }
+
+private:
+    void push(const drone::runtime::ImuSample& sample);
+
+    ImuSpecs specs_{};
+    drone::simulator::random::NoiseBlock noise_;
+    drone::Vector3 accel_bias_ms2_{};
+    drone::Vector3 gyro_bias_rps_{};
+    double time_s_ = 0.0;
+    uint64_t next_sample_index_ = 1;
+    std::vector<drone::runtime::ImuSample> fifo_;
+    std::size_t fifo_head_ = 0;
+    std::size_t fifo_count_ = 0;
+    uint64_t overflow_count_ = 0;
+};
+
+}  // namespace drone::simulator::physics
+
+#endif  // SIMULATOR_PHYSICS_IMU_SIM_H
@@ -22,9 +22,16 @@ public:
     // Update temperature dynamics
     static void updateTemperature(drone::model::components::ElecMotor& motor, uint64_t delta_ms);
 
+    // Exact first-order thermal response over a step of arbitrary length (losses held constant)
+    static void advanceTemperature(drone::model::components::ElecMotor& motor, double delta_s);
+
     // Calculate battery drain over time
     static double calculateBatteryDrain(const drone::model::components::ElecMotor& motor, double time_s);
     
+    // Update speed, current and losses only (thermal state left to a separate, possibly slower, update)
+    static void updateElectricalState(drone::model::components::ElecMotor& motor, uint64_t delta_ms, double currentBattVoltageV);
+    static void updateElectricalState(drone::model::components::ElecMotor& motor, uint64_t delta_ms, drone::model::components::Battery_base* battery);
+
     // Update all motor physics
     static void updateMotorPhysics(drone::model::components::ElecMotor& motor, uint64_t delta_ms, double currentBattVoltageV);
     static void updateMotorPhysics(drone::model::components::ElecMotor& motor, uint64_t delta_ms, drone::model::components::Battery_base* battery);
@@ -0,0 +1,97 @@
+#ifndef SIMULATOR_PHYSICS_RIGID_BODY_H
+#define SIMULATOR_PHYSICS_RIGID_BODY_H
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "drone/drone_data_types.h"
+
+namespace drone::simulator::physics {
+
+// Unit quaternion rotating body (forward-left-up) vectors into ENU
+struct Quaternion {
+    double w = 1.0;
+    double x = 0.0;
+    double y = 0.0;
+    double z = 0.0;
+
+    static Quaternion fromAttitude(const drone::AttitudeYPR& attitude_ypr);
+};
+
+// Row-major 3x3 matrix
+struct Matrix3 {
+    std::array<double, 9> m{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+
+    drone::Vector3 operator*(const drone::Vector3& v) const {
+        return drone::Vector3(m[0] * v.x + m[1] * v.y + m[2] * v.z,
+                              m[3] * v.x + m[4] * v.y + m[5] * v.z,
+                              m[6] * v.x + m[7] * v.y + m[8] * v.z);
+    }
+
+    drone::Vector3 transposeTimes(const drone::Vector3& v) const {
+        return drone::Vector3(m[0] * v.x + m[3] * v.y + m[6] * v.z,
+                              m[1] * v.x + m[4] * v.y + m[7] * v.z,
+                              m[2] * v.x + m[5] * v.y + m[8] * v.z);
+    }
+
+    static Matrix3 diagonal(const drone::Vector3& d);
+    static Matrix3 fromQuaternion(const Quaternion& q);
+    static Matrix3 fromAttitude(const drone::AttitudeYPR& attitude_ypr);
+    bool inverse(Matrix3& out) const;
+    drone::AttitudeYPR toAttitude() const;
+};
+
+struct RigidBodyParams {
+    Matrix3 inertia_kgm2 = Matrix3::diagonal(drone::Vector3(0.02, 0.02, 0.04));
+    double arm_length_m = 0.225;  // hub to rotor axis, X frame
+};
+
+/**
+ * @brief 6-DOF rigid body: ENU position/velocity, quaternion attitude and body angular rate.
+ *
+ * The quaternion is advanced with a polynomial (trig-free) rotation increment and renormalized
+ * every step; the body-to-ENU matrix is rebuilt from it once per step and cached, so callers
+ * rotate vectors with plain multiplies.
+ */
+class RigidBody {
+public:
+    explicit RigidBody(const RigidBodyParams& params = {});
+
+    void setParams(const RigidBodyParams& params);
+    const RigidBodyParams& getParams() const { return params_; }
+
+    // force_enu_n includes gravity; torque is about the body axes
+    void step(double dt_s, double mass_kg, const drone::Vector3& force_enu_n, const drone::Vector3& torque_body_nm);
+
+    void setPositionEnuM(const drone::Vector3& position) { position_enu_m_ = position; }
+    void setVelocityEnuMps(const drone::Vector3& velocity) { velocity_enu_mps_ = velocity; }
+    void setAngularRateBodyRps(const drone::Vector3& rate) { angular_rate_body_rps_ = rate; }
+    void setAttitude(const Quaternion& attitude);
+
+    const drone::Vector3& getPositionEnuM() const { return position_enu_m_; }
+    const drone::Vector3& getVelocityEnuMps() const { return velocity_enu_mps_; }
+    const drone::Vector3& getAngularRateBodyRps() const { return angular_rate_body_rps_; }
+    const Quaternion& getAttitude() const { return attitude_; }
+    const Matrix3& getBodyToEnu() const { return body_to_enu_; }
+
+    /**
+     * @brief Body torque of an X-frame quad from per-rotor thrust and reaction torque.
+     *
+     * Rotor order FL, FR, RR, RL (the RealDrone mixer order); FL and RR react with +yaw.
+     */
+    drone::Vector3 quadXTorqueBodyNm(const std::vector<double>& thrust_n, const std::vector<double>& torque_nm) const;
+
+private:
+    RigidBodyParams params_{};
+    Matrix3 inertia_inverse_{};
+    drone::Vector3 position_enu_m_{};
+    drone::Vector3 velocity_enu_mps_{};
+    drone::Vector3 angular_rate_body_rps_{};
+    Quaternion attitude_{};
+    Matrix3 body_to_enu_{};
+};
+
+}  // namespace drone::simulator::physics
+
+#endif  // SIMULATOR_PHYSICS_RIGID_BODY_H
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "drone/model/components/elect_motor.h"
+#include "simulator/physics/thrust_model.h"
+
+namespace drone::simulator::physics {
+
+/**
+ * @brief Measured rotor thrust/torque sampled on a uniform RPM x inflow grid.
+ *
+ * Rows are inflow speeds, columns RPM (row-major). The inflow axis always has at
+ * least two rows so lookups stay branch-free; a single-inflow curve is duplicated.
+ */
+struct RotorCurveTable {
+    double rpm_min = 0.0;
+    double rpm_step = 1.0;
+    std::size_t rpm_count = 0;
+    double inflow_min_mps = 0.0;
+    double inflow_step_mps = 1.0;
+    std::size_t inflow_count = 0;
+    std::vector<double> thrust_n;
+    std::vector<double> torque_nm;
+
+    bool empty() const { return rpm_count < 2 || inflow_count < 2; }
+
+    /**
+     * @brief Import a propeller test-stand CSV.
+     *
+     * Requires a header with `rpm`, `thrust_n` and `torque_nm` columns and an optional
+     * `inflow_mps` column. Each inflow group is resampled onto a uniform RPM grid of
+     * rpm_samples points; inflow groups are resampled onto a uniform inflow grid.
+     */
+    static bool loadCsv(const std::string& csv_file, RotorCurveTable& table, std::size_t rpm_samples = 64);
+};
+
+/**
+ * @brief Thrust and torque model for all rotors of one vehicle.
+ *
+ * Built once per vehicle: the quadratic coefficients of ThrustModel are folded
+ * with each rotor's blade geometry and the RPM -> rad/s conversion, so evaluation
+ * is one multiply per output. When a curve table is set it replaces the
+ * quadratic law and is interpolated bilinearly in RPM and inflow speed.
+ */
+class RotorModel final {
+public:
+    RotorModel() = default;
+    RotorModel(const ThrustModelParams& params, const std::vector<drone::model::components::ElecMotor>& motors);
+
+    void setCurveTable(RotorCurveTable table);
+    bool hasCurveTable() const { return !curve_.empty(); }
+    std::size_t rotorCount() const { return thrust_per_rpm2_.size(); }
+
+    // Evaluate every rotor; all arrays hold rotorCount() entries
+    void evaluate(const double* rpm, const double* inflow_mps, double* thrust_n, double* torque_nm) const;
+
+    double thrustPerRpm2(std::size_t rotor) const { return thrust_per_rpm2_[rotor]; }
+    double torquePerRpm2(std::size_t rotor) const { return torque_per_rpm2_[rotor]; }
+
+private:
+    std::vector<double> thrust_per_rpm2_;
+    std::vector<double> torque_per_rpm2_;
+    RotorCurveTable curve_{};
+    double inv_rpm_step_ = 0.0;
+    double inv_inflow_step_ = 0.0;
+};
+
+}  // namespace drone::simulator::physics
@@ -7,21 +7,30 @@
 #include "drone/drone_data_types.h"
 #include "simulator/physics/motor_physics.h"
 #include "simulator/physics/thrust_model.h"
+#include "simulator/physics/rotor_model.h"
 #include "simulator/physics/battery_sim.h"
 #include "simulator/physics/gps_sim.h"
+#include "simulator/physics/imu_sim.h"
+#include "simulator/physics/rigid_body.h"
 #include "simulator/environment/weather_model.h"
+#include "simulator/environment/terrain_map.h"
 #include "simulator/config/weather_config.h"
+#include "simulator/config/battery_config.h"
+#include "simulator/runtime/mission_energy_estimator.h"
+#include "simulator/runtime/surrogate_vehicle.h"
 #include "drone/model/drone_base.h"
 #include <array>
 #include <fstream>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace drone::simulator {
 
 class QuaroSimulation final : public drone::simulator::SimulationBase,
                               public drone::runtime::SensorSource,
-                              public drone::runtime::ActuatorSink {
+                              public drone::runtime::ActuatorSink,
+                              public drone::runtime::ImuSource {
 public:
     friend std::shared_ptr<QuaroSimulation> QuadroSimulationFactory(
         std::string name,
@@ -40,9 +49,52 @@ public:
 
     drone::runtime::SensorFrame readSensors() const override;
     void applyActuators(const drone::runtime::ActuatorFrame& actuator_frame) override;
+    std::size_t readImuSamples(drone::runtime::ImuSample* out, std::size_t capacity) override;
+    // Enables the IMU stream; samples are generated at specs.sample_rate_hz regardless of the step size
+    void setImuSpecs(const drone::simulator::physics::ImuSpecs& imu_specs);
+
+    /**
+     * @brief Switch attitude from "set to the commanded angles" to 6-DOF rigid-body dynamics.
+     *
+     * Rotor thrust and reaction torque (X frame) drive a quaternion attitude through the
+     * given inertia; commanded angles are then only reached through the attitude controller.
+     */
+    void setRigidBodyParams(const drone::simulator::physics::RigidBodyParams& params);
+    // True ENU position; stable address for per-tick consumers such as SeparationMonitor
+    const drone::Vector3& getPositionEnu() const { return position_enu_m_; }
+    bool isRigidBodyEnabled() const { return rigid_body_enabled_; }
+    const drone::simulator::physics::RigidBody& getRigidBody() const { return rigid_body_; }
     void setWeatherConfig(const drone::simulator::config::WeatherConfig& weather_config);
+    void setWeatherTape(std::shared_ptr<const drone::simulator::environment::WeatherTape> weather_tape);
+    void setWindField(std::shared_ptr<const drone::simulator::environment::WindField> wind_field);
+    void setBatteryConfig(const drone::simulator::config::BatteryConfig& battery_config);
+    // Mass, rotor, motor and pack constants for MissionEnergyEstimator (quadratic rotor law)
+    drone::simulator::runtime::MissionEnergyVehicle getMissionEnergyVehicle() const;
+    /**
+     * @brief Hover linearization for SurrogateVehicle, by numerical Jacobians of this model.
+     *
+     * Central differences of the still-air translational dynamics (rotor model, tilt, drag)
+     * around the hover trim, which is solved for first; the motor ramp is sampled through
+     * MotorPhysics::updateSpeed and fitted with a first-order lag at its 63 % rise time.
+     * Applies to the commanded-attitude mode, not to setRigidBodyParams.
+     */
+    drone::simulator::runtime::SurrogateModel linearizeHover(
+        const drone::simulator::runtime::SurrogateLinearization& options =
+            drone::simulator::runtime::SurrogateLinearization()) const;
+    // Terrain under the vehicle for ground contact and AGL; nullptr means flat ground at z = 0
+    void setTerrainMap(std::shared_ptr<const drone::simulator::environment::TerrainMap> terrain_map);
+    // Measured thrust/torque curves (see RotorCurveTable::loadCsv); an empty table restores the quadratic law
+    void setRotorCurveTable(drone::simulator::physics::RotorCurveTable curve_table);
     bool setTelemetryLogFile(const std::string& telemetry_log_file);
 
+    /**
+     * @brief Run motor thermal and battery discharge at a lower rate than the dynamics.
+     *
+     * Both use closed-form updates over the accumulated interval, so accuracy does not
+     * degrade with longer periods. A period <= 0 updates them every step.
+     */
+    void setSlowSubsystemPeriodS(double period_s) { slow_subsystem_period_s_ = period_s; }
+
 protected:
     void onStart();
     void onStop();
@@ -53,13 +105,24 @@ public:
 
 private:
     QuaroSimulation() = default;
+    void rebuildRotorModel();
+    // Euler angles of body_to_enu_; in rigid-body mode converted from the matrix only when read
+    const drone::AttitudeYPR& attitudeYpr() const;
+    // Still-air translational acceleration for a given velocity, attitude and rotor speeds
+    drone::Vector3 stillAirAccelerationEnuMs2(const drone::Vector3& velocity_enu_mps,
+                                              const drone::AttitudeYPR& attitude_ypr_rad,
+                                              const std::vector<double>& rotor_rpm) const;
+
     std::unique_ptr<drone::model::Quadrocopter> quad_;
     double elapsed_s_;
     drone::Vector3 position_enu_m_{};
     drone::Vector3 velocity_enu_mps_{};
     drone::Vector3 acceleration_enu_ms2_{};
-    drone::AttitudeYPR attitude_ypr_rad_{};
+    mutable drone::AttitudeYPR attitude_ypr_rad_{};
+    mutable bool attitude_ypr_stale_ = false;  // body_to_enu_ moved on since attitude_ypr_rad_ was set
+    drone::simulator::physics::Matrix3 body_to_enu_{};  // cached rotation for attitude_ypr_rad_
     double altitude_m_{0.0};
+    double ground_height_m_{0.0};
     double vertical_speed_mps_{0.0};
     double desired_rpm_{0.0};
     double common_motor_rpm_{0.0};
@@ -84,10 +147,26 @@ private:
     double sensed_gps_velocity_down_mps_{0.0};
     drone::simulator::environment::WeatherModel weather_model_{};
     drone::simulator::environment::WeatherSample weather_sample_{};
+    std::shared_ptr<const drone::simulator::environment::TerrainMap> terrain_map_;
     double sensed_battery_voltage_v_{0.0};
     double sensed_battery_soc_percent_{0.0};
     double sensed_motor_temperature_c_{0.0};
     double sensed_motor_rpm_{0.0};
+    double slow_subsystem_period_s_{0.0};
+    double slow_subsystem_elapsed_s_{0.0};
+    double slow_subsystem_charge_as_{0.0};
+    drone::simulator::physics::RotorModel rotor_model_{};
+    drone::simulator::physics::RotorCurveTable rotor_curve_table_{};
+    std::vector<double> rotor_rpm_;
+    std::vector<double> rotor_inflow_mps_;
+    std::vector<double> rotor_thrust_n_;
+    std::vector<double> rotor_torque_nm_;
+    bool imu_enabled_ = false;
+    drone::simulator::physics::ImuSim imu_{};
+    drone::simulator::physics::ImuTruth imu_truth_{};
+    drone::AttitudeYPR imu_prev_attitude_ypr_rad_{};
+    bool rigid_body_enabled_ = false;
+    drone::simulator::physics::RigidBody rigid_body_{};
     bool is_running_ = false;
     std::string telemetry_log_file_ = "simulation_telemetry.csv";
     std::ofstream telemetry_log_stream_;
@@ -112,5 +191,10 @@ std::shared_ptr<QuaroSimulation> QuadroSimulationFactory(
     uint64_t steps,
     double dt_s);
 
+/**
+ * @brief The vehicle simulator_app flies: 15000 RPM motors, 4S 1500 mAh pack, 1.2 kg body, 0.3 m blades.
+ */
+std::shared_ptr<QuaroSimulation> QuadroSimulationFactory(uint64_t steps, double dt_s);
+
 }  // namespace drone::simulator
 #endif  // QUADROSIMULATOR_H
\ No newline at end of file
@@ -0,0 +1,37 @@
+#ifndef SIMULATOR_RANDOM_GAUSSIAN_BLOCK_H
+#define SIMULATOR_RANDOM_GAUSSIAN_BLOCK_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace drone::simulator::random {
+
+/**
+ * @brief Counter-based standard normal generator that fills whole blocks.
+ *
+ * Each uniform is a splitmix64 hash of (seed, counter), so lanes are independent
+ * and the Box-Muller loop has no loop-carried state; the compiler can vectorize it
+ * and a stream can be reproduced from any counter position.
+ */
+class GaussianBlockGenerator {
+public:
+    explicit GaussianBlockGenerator(std::uint64_t seed = 42) { reseed(seed); }
+
+    void reseed(std::uint64_t seed) {
+        seed_ = seed;
+        counter_ = 0;
+    }
+
+    // Fill out[0, count) with independent N(0, 1) samples
+    void fill(double* out, std::size_t count);
+
+    std::uint64_t counter() const { return counter_; }
+
+private:
+    std::uint64_t seed_ = 42;
+    std::uint64_t counter_ = 0;
+};
+
+}  // namespace drone::simulator::random
+
+#endif  // SIMULATOR_RANDOM_GAUSSIAN_BLOCK_H
@@ -0,0 +1,47 @@
+#ifndef SIMULATOR_RANDOM_NOISE_BLOCK_H
+#define SIMULATOR_RANDOM_NOISE_BLOCK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "simulator/random/gaussian_block.h"
+
+namespace drone::simulator::random {
+
+/**
+ * @brief Zero-mean Gaussian noise for a fixed set of channels, generated a block of ticks at a time.
+ *
+ * Each refill draws block_ticks * channels samples in one GaussianBlockGenerator call and scales
+ * them by the per-channel sigma; next() then hands out one tick's row without further RNG work.
+ */
+class NoiseBlock {
+public:
+    static constexpr std::size_t kDefaultBlockTicks = 256;
+
+    NoiseBlock(std::vector<double> sigmas, std::uint64_t seed, std::size_t block_ticks = kDefaultBlockTicks);
+
+    // Noise for the next tick, channelCount() values in the order of the sigmas
+    const double* next() {
+        if (cursor_ >= block_ticks_) {
+            refill();
+        }
+        return &buffer_[(cursor_++) * sigmas_.size()];
+    }
+
+    std::size_t channelCount() const { return sigmas_.size(); }
+    std::size_t blockTicks() const { return block_ticks_; }
+
+private:
+    void refill();
+
+    std::vector<double> sigmas_;
+    std::size_t block_ticks_;
+    std::vector<double> buffer_;  // [tick][channel]
+    std::size_t cursor_;
+    GaussianBlockGenerator gaussian_;
+};
+
+}  // namespace drone::simulator::random
+
+#endif  // SIMULATOR_RANDOM_NOISE_BLOCK_H
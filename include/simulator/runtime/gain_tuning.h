@@ -0,0 +1,129 @@
+#ifndef SIMULATOR_RUNTIME_GAIN_TUNING_H
+#define SIMULATOR_RUNTIME_GAIN_TUNING_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "drone/config/altitude_controller_config.h"
+#include "drone/config/attitude_controller_config.h"
+#include "drone/mission/mission_image.h"
+#include "simulator/config/battery_config.h"
+#include "simulator/config/weather_config.h"
+#include "simulator/runtime/surrogate_vehicle.h"
+
+namespace drone::simulator::runtime {
+
+// Gain groups for tunableGains
+enum GainGroup : std::uint32_t {
+    kAltitudeGains = 1u << 0,  // reference rate and RPM PID
+    kPositionGains = 1u << 1,  // XY roll law
+    kAttitudeGains = 1u << 2,  // attitude PD; acts through the motor mixer only unless the rigid body is enabled
+};
+
+// One controller parameter the tuner searches, with its YAML location and range
+struct TunableGain {
+    const char* section;  // "altitude_controller" or "attitude_controller"
+    const char* key;
+    double min_value;
+    double max_value;
+    bool log_scale;  // searched on a log axis (positive gains spanning decades)
+    double& (*access)(drone::config::AltitudeControllerConfig&, drone::config::AttitudeControllerConfig&);
+};
+
+std::vector<TunableGain> tunableGains(std::uint32_t groups);
+
+// Gains of the configs as a point in [0, 1]^n, clamped to the ranges
+std::vector<double> normalizeGains(const std::vector<TunableGain>& gains,
+                                   const drone::config::AltitudeControllerConfig& alt_config,
+                                   const drone::config::AttitudeControllerConfig& att_config);
+void applyNormalizedGains(const std::vector<TunableGain>& gains,
+                          const std::vector<double>& unit_point,
+                          drone::config::AltitudeControllerConfig& alt_config,
+                          drone::config::AttitudeControllerConfig& att_config);
+
+struct TuningCostWeights {
+    double ise = 0.01;        // per m^2 s of position error to the active target
+    double overshoot = 5.0;   // per m past a target, largest per setpoint change
+    double settling = 0.5;    // per s until the error stays inside the settle band
+    double energy = 0.05;     // per hover-second of rotor power (sum of (rpm / reference)^3 / rotors)
+    double failure = 1000.0;  // mission failed, aborted, diverged or not finished in time
+};
+
+struct TuningFlightOptions {
+    double dt_s = 0.01;
+    double max_duration_s = 180.0;
+    double settle_band_m = 0.5;
+    double energy_reference_rpm = 10200.0;
+    double divergence_m = 100.0;  // position error that ends the flight as a failure
+};
+
+// Vehicle a candidate is flown on; each flight builds a fresh one
+struct TuningPlant {
+    drone::simulator::config::WeatherConfig weather;  // random_seed is replaced per scenario
+    drone::simulator::config::BatteryConfig battery;
+    // Full QuaroSimulation unless set; the surrogate takes the weather as a disturbance acceleration
+    std::shared_ptr<const SurrogateModel> surrogate;
+};
+
+struct TuningScenario {
+    std::string name;
+    std::shared_ptr<const drone::mission::MissionImage> mission;
+    std::uint32_t weather_seed = 0;
+};
+
+struct TuningCost {
+    double ise_m2s = 0.0;
+    double overshoot_m = 0.0;
+    double settling_s = 0.0;
+    double energy_hover_s = 0.0;
+    std::size_t failures = 0;
+    double flown_s = 0.0;
+    bool aborted = false;  // stopped early; total is a lower bound above the abort limit
+    double total = 0.0;
+};
+
+/**
+ * @brief Fly one scenario with the configs' controllers and score it.
+ *
+ * The flight runs until the mission completes, fails or max_duration_s passes. The ISE,
+ * overshoot and energy terms only grow, so once prior_cost plus their weighted sum exceeds
+ * abort_above the flight stops and comes back aborted. Settling and overshoot are taken per
+ * setpoint change (any change of the altitude or XY target).
+ */
+TuningCost evaluateFlight(const TuningPlant& plant,
+                          const drone::config::AltitudeControllerConfig& alt_config,
+                          const drone::config::AttitudeControllerConfig& att_config,
+                          const TuningScenario& scenario,
+                          const TuningFlightOptions& options,
+                          const TuningCostWeights& weights,
+                          double abort_above,
+                          double prior_cost = 0.0);
+
+// Sum over scenarios in order, carrying the running total into each flight's abort check
+TuningCost evaluateScenarios(const TuningPlant& plant,
+                             const drone::config::AltitudeControllerConfig& alt_config,
+                             const drone::config::AttitudeControllerConfig& att_config,
+                             const std::vector<TuningScenario>& scenarios,
+                             const TuningFlightOptions& options,
+                             const TuningCostWeights& weights,
+                             double abort_above);
+
+/**
+ * @brief Write the gains of one YAML section over a copy of source_file.
+ *
+ * Keys the tuner does not touch keep their source values; comments are not preserved, so
+ * header_comment is written at the top instead.
+ */
+bool writeTunedGains(const std::vector<TunableGain>& gains,
+                     const drone::config::AltitudeControllerConfig& alt_config,
+                     const drone::config::AttitudeControllerConfig& att_config,
+                     const std::string& section,
+                     const std::string& source_file,
+                     const std::string& out_file,
+                     const std::string& header_comment);
+
+}  // namespace drone::simulator::runtime
+
+#endif  // SIMULATOR_RUNTIME_GAIN_TUNING_H
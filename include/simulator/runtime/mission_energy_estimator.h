@@ -0,0 +1,130 @@
+#ifndef SIMULATOR_RUNTIME_MISSION_ENERGY_ESTIMATOR_H
+#define SIMULATOR_RUNTIME_MISSION_ENERGY_ESTIMATOR_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "drone/mission/mission_image.h"
+#include "simulator/physics/cell_ocv_table.h"
+
+namespace drone::simulator::runtime {
+
+// Vehicle constants the estimator needs; QuaroSimulation::getMissionEnergyVehicle fills them from a live vehicle
+struct MissionEnergyVehicle {
+    double mass_kg = 2.1;
+    std::size_t rotor_count = 4;
+    double thrust_per_rpm2_n = 0.0;  // per rotor, T = k * rpm^2 (RotorModel::thrustPerRpm2)
+    double motor_max_speed_rpm = 15000.0;
+    double motor_max_current_a = 20.0;
+    double motor_efficiency = 0.9;
+    double damping_n_per_mps = 1.2;  // linear drag of the point-mass dynamics
+    int series_cells = 4;
+    int parallel_cells = 1;
+    double cell_capacity_mah = 1500.0;
+    drone::simulator::physics::CellOcvTable ocv_table = drone::simulator::physics::CellOcvTable::lipo();
+    double initial_soc_percent = 100.0;
+};
+
+/**
+ * @brief Closed-loop behaviour the estimator assumes for RealDrone's controllers.
+ *
+ * Defaults are fitted to simulator_app runs of the example missions; see
+ * tools/scripts/mission_energy_report.py.
+ */
+struct MissionEnergyTiming {
+    double climb_rate_mps = 5.0;
+    double descent_rate_mps = 4.0;
+    double max_tilt_rad = 0.3;  // roll limit of the XY law
+    // completion-based steps: time to settle inside the tolerances after the transit
+    double settle_time_s = 4.5;
+    double leg_settle_time_s = 8.5;             // go_to_position: turn onto the leg, altitude recovery
+    double trajectory_leg_settle_time_s = 5.0;  // go_to_position with trajectory: "min_jerk"
+    double reserve_soc_percent = 0.0;  // estimate is infeasible when the SOC falls to this
+    std::size_t max_steps = 10000;     // bound for looping programs
+};
+
+struct StepEnergyEstimate {
+    int step_id = -1;
+    double start_time_s = 0.0;
+    double duration_s = 0.0;
+    double energy_wh = 0.0;
+    double end_soc_percent = 0.0;
+    bool timed_out = false;
+};
+
+enum class MissionEnergyOutcome {
+    COMPLETED,
+    ABORTED,         // a step timed out with ABORT/RETRY or a trigger aborted
+    BATTERY_EMPTY,   // SOC reached the reserve before the mission ended
+    STEP_LIMIT,      // program still running after max_steps
+    INVALID_VEHICLE, // vehicle constants unusable, nothing estimated (MissionEnergyEstimator::vehicleProblem)
+};
+
+struct MissionEnergyEstimate {
+    MissionEnergyOutcome outcome = MissionEnergyOutcome::COMPLETED;
+    double duration_s = 0.0;
+    double energy_wh = 0.0;
+    double final_soc_percent = 0.0;
+    double average_current_a = 0.0;
+    double reserve_time_s = -1.0;   // when the SOC reached the reserve, -1 if it did not
+    int reserve_step_index = -1;    // entry of `steps` during which it did
+    bool reserve_while_landing = false;
+    std::vector<StepEnergyEstimate> steps;  // in execution order; a program may repeat steps
+
+    bool feasible() const { return outcome == MissionEnergyOutcome::COMPLETED; }
+};
+
+std::string missionEnergyOutcomeToString(MissionEnergyOutcome outcome);
+
+/**
+ * @brief Analytic pre-flight estimate of mission time, energy and final SOC.
+ *
+ * Walks the step table in execution order (running the mission program and battery/altitude
+ * triggers against the predicted state) and books each step as a few constant-thrust phases:
+ * vertical transit, horizontal cruise at the speed where the roll limit balances drag, and
+ * settle/hold at hover thrust. Thrust maps to motor RPM through the quadratic rotor law and
+ * RPM to current through MotorPhysics::calculateCurrent's linear law; the pack is discharged
+ * at that constant current with the same OCV integral BatterySim uses. Wind, turbulence and
+ * terrain are ignored. Triggers are checked at step boundaries only.
+ *
+ * Costs a few microseconds per step, so it can screen missions at load time or prune
+ * batch sweeps before simulating them.
+ */
+class MissionEnergyEstimator {
+public:
+    // The vehicle is checked here; an unusable one makes estimate() return INVALID_VEHICLE
+    explicit MissionEnergyEstimator(const MissionEnergyVehicle& vehicle,
+                                    const MissionEnergyTiming& timing = MissionEnergyTiming());
+
+    bool valid() const { return vehicle_problem_ == nullptr; }
+    // What is wrong with the vehicle, nullptr when valid
+    const char* vehicleProblem() const { return vehicle_problem_; }
+
+    MissionEnergyEstimate estimate(const drone::mission::MissionImage& image) const;
+
+    // Pack current [A] while the rotors produce total_thrust_n
+    double packCurrentA(double total_thrust_n) const;
+    double hoverCurrentA() const { return packCurrentA(vehicle_.mass_kg * kGravityMs2); }
+    // Horizontal speed where drag balances the thrust tilt
+    double cruiseSpeedMps(double max_tilt_rad) const;
+
+    const MissionEnergyVehicle& vehicle() const { return vehicle_; }
+    const MissionEnergyTiming& timing() const { return timing_; }
+
+private:
+    static constexpr double kGravityMs2 = 9.81;
+
+    struct State;
+    void fly(State& state, double duration_s, double total_thrust_n) const;
+    // returns true when the step would run into its timeout
+    bool flyStep(State& state, const drone::mission::FlatMissionStep& step) const;
+
+    MissionEnergyVehicle vehicle_;
+    MissionEnergyTiming timing_;
+    const char* vehicle_problem_ = nullptr;
+};
+
+}  // namespace drone::simulator::runtime
+
+#endif  // SIMULATOR_RUNTIME_MISSION_ENERGY_ESTIMATOR_H
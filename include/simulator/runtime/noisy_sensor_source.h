@@ -4,32 +4,40 @@
 #include <algorithm>
 #include <cmath>
 #include <random>
+#include <vector>
 
 #include "drone/runtime/real_drone.h"
+#include "simulator/config/sensor_noise_config.h"
+#include "simulator/random/noise_block.h"
 
 namespace drone::simulator::runtime {
 
 class NoisySensorSource final : public drone::runtime::SensorSource {
 public:
-    explicit NoisySensorSource(const drone::runtime::SensorSource& source)
-        : source_(source) {}
+    explicit NoisySensorSource(const drone::runtime::SensorSource& source,
+                               const drone::simulator::config::SensorNoiseConfig& config = {})
+        : source_(source),
+          noise_(sigmasFor(config), seedFor(config), config.block_size) {}
 
     drone::runtime::SensorFrame readSensors() const override {
         drone::runtime::SensorFrame sensor_frame = source_.readSensors();
+        const double* noise = noise_.next();
 
-        sensor_frame.altitude_m += altitude_noise_m_(rng_);
-        sensor_frame.gps_altitude_m += gps_vertical_noise_m_(rng_);
-        sensor_frame.gps_latitude_deg += metersToLatitudeDeg(gps_horizontal_noise_m_(rng_));
+        sensor_frame.altitude_m += noise[kAltitude];
+        sensor_frame.altitude_agl_m += noise[kAltitude];
+        sensor_frame.gps_altitude_m += noise[kGpsAltitude];
+        sensor_frame.gps_latitude_deg += metersToLatitudeDeg(noise[kGpsNorth]);
         sensor_frame.gps_longitude_deg += metersToLongitudeDeg(
-            gps_horizontal_noise_m_(rng_),
+            noise[kGpsEast],
             sensor_frame.gps_latitude_deg);
-        sensor_frame.gps_velocity_north_mps += gps_velocity_noise_mps_(rng_);
-        sensor_frame.gps_velocity_east_mps += gps_velocity_noise_mps_(rng_);
-        sensor_frame.gps_velocity_down_mps += gps_velocity_noise_mps_(rng_);
-        sensor_frame.battery_voltage_v += battery_voltage_noise_v_(rng_);
-        sensor_frame.motor_temperature_c += motor_temp_noise_c_(rng_);
+        sensor_frame.gps_velocity_north_mps += noise[kGpsVelocityNorth];
+        sensor_frame.gps_velocity_east_mps += noise[kGpsVelocityEast];
+        sensor_frame.gps_velocity_down_mps += noise[kGpsVelocityDown];
+        sensor_frame.battery_voltage_v += noise[kBatteryVoltage];
+        sensor_frame.motor_temperature_c += noise[kMotorTemperature];
 
         sensor_frame.altitude_m = std::max(0.0, sensor_frame.altitude_m);
+        sensor_frame.altitude_agl_m = std::max(0.0, sensor_frame.altitude_agl_m);
         sensor_frame.gps_altitude_m = std::max(0.0, sensor_frame.gps_altitude_m);
         sensor_frame.battery_voltage_v = std::max(0.0, sensor_frame.battery_voltage_v);
         sensor_frame.battery_soc_percent = std::clamp(sensor_frame.battery_soc_percent, 0.0, 100.0);
@@ -38,8 +46,43 @@ public:
     }
 
 private:
+    // Noise channel order inside each NoiseBlock row
+    enum Channel : std::size_t {
+        kAltitude = 0,
+        kGpsNorth,
+        kGpsEast,
+        kGpsAltitude,
+        kGpsVelocityNorth,
+        kGpsVelocityEast,
+        kGpsVelocityDown,
+        kBatteryVoltage,
+        kMotorTemperature,
+    };
+
     const drone::runtime::SensorSource& source_;
 
+    static std::vector<double> sigmasFor(const drone::simulator::config::SensorNoiseConfig& config) {
+        return {
+            config.altitude_std_m,
+            config.gps_north_std_m,
+            config.gps_east_std_m,
+            config.gps_altitude_std_m,
+            config.gps_velocity_north_std_mps,
+            config.gps_velocity_east_std_mps,
+            config.gps_velocity_down_std_mps,
+            config.battery_voltage_std_v,
+            config.motor_temperature_std_c,
+        };
+    }
+
+    static uint64_t seedFor(const drone::simulator::config::SensorNoiseConfig& config) {
+        if (config.random_seed != 0) {
+            return config.random_seed;
+        }
+        std::random_device device;
+        return (static_cast<uint64_t>(device()) << 32) | device();
+    }
+
     static double metersToLatitudeDeg(double meters) {
         constexpr double kMetersPerDegLat = 111320.0;
         return meters / kMetersPerDegLat;
@@ -53,13 +96,7 @@ private:
         return meters / (kMetersPerDegEquator * scale);
     }
 
-    mutable std::mt19937 rng_{std::random_device{}()};
-    mutable std::normal_distribution<double> altitude_noise_m_{0.0, 0.15};
-    mutable std::normal_distribution<double> gps_horizontal_noise_m_{0.0, 1.5};
-    mutable std::normal_distribution<double> gps_vertical_noise_m_{0.0, 2.5};
-    mutable std::normal_distribution<double> gps_velocity_noise_mps_{0.0, 0.3};
-    mutable std::normal_distribution<double> battery_voltage_noise_v_{0.0, 0.03};
-    mutable std::normal_distribution<double> motor_temp_noise_c_{0.0, 0.2};
+    mutable drone::simulator::random::NoiseBlock noise_;
 };
 
 }  // namespace drone::simulator::runtime
@@ -0,0 +1,66 @@
+#ifndef SIMULATOR_RUNTIME_SEPARABLE_CMA_ES_H
+#define SIMULATOR_RUNTIME_SEPARABLE_CMA_ES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace drone::simulator::runtime {
+
+/**
+ * @brief Cost of one candidate in the unit box.
+ *
+ * abort_above is a bound the candidate may stop at: once a monotone part of its cost exceeds
+ * it, the function may return that partial cost (anything above the bound) and set *aborted.
+ * Called from several threads at once.
+ */
+using BoundedCostFunction =
+    std::function<double(const std::vector<double>& unit_point, double abort_above, bool* aborted)>;
+
+struct SeparableCmaEsOptions {
+    std::size_t population = 0;  // 0: 4 + 3 ln(n)
+    std::size_t generations = 40;
+    double initial_step = 0.15;  // sigma in unit-box coordinates
+    double min_step = 1e-6;      // stop once sigma * max scale falls below this
+    std::uint32_t seed = 1;
+    std::size_t threads = 0;     // 0: std::thread::hardware_concurrency
+    // candidates are cut off at abort_ratio * best cost so far; <= 0 disables early termination
+    double abort_ratio = 3.0;
+};
+
+struct SeparableCmaEsGeneration {
+    std::size_t generation = 0;
+    double best_cost = 0.0;             // best so far
+    double generation_best_cost = 0.0;
+    std::size_t aborted = 0;            // candidates cut off this generation
+    double step_size = 0.0;
+};
+
+struct SeparableCmaEsResult {
+    std::vector<double> best_point;
+    double best_cost = 0.0;
+    double start_cost = 0.0;
+    std::size_t generations = 0;
+    std::size_t evaluations = 0;
+    std::size_t aborted_evaluations = 0;
+};
+
+/**
+ * @brief Minimize a cost over [0, 1]^n with separable (diagonal covariance) CMA-ES.
+ *
+ * Ros and Hansen's sep-CMA-ES: per-coordinate step sizes instead of a full covariance, so an
+ * update is O(n) and no eigendecomposition is needed, which suits a dozen loosely coupled
+ * gains. Samples outside the box are clamped onto it and the clamped point is used for the
+ * update. Each generation's population is drawn first and then evaluated on a thread pool;
+ * the abort bound is fixed per generation, so the result does not depend on the thread count.
+ */
+SeparableCmaEsResult minimizeSeparableCmaEs(
+    const std::vector<double>& start_point,
+    const BoundedCostFunction& cost,
+    const SeparableCmaEsOptions& options,
+    const std::function<void(const SeparableCmaEsGeneration&)>& on_generation = {});
+
+}  // namespace drone::simulator::runtime
+
+#endif  // SIMULATOR_RUNTIME_SEPARABLE_CMA_ES_H
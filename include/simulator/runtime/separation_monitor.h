@@ -0,0 +1,85 @@
+#ifndef SIMULATOR_RUNTIME_SEPARATION_MONITOR_H
+#define SIMULATOR_RUNTIME_SEPARATION_MONITOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "drone/drone_data_types.h"
+
+namespace drone::simulator::runtime {
+
+struct SeparationConfig {
+    double collision_distance_m = 1.0;
+    double near_miss_distance_m = 5.0;
+};
+
+enum class SeparationEventType {
+    NEAR_MISS,
+    COLLISION,
+};
+
+struct SeparationEvent {
+    SeparationEventType type = SeparationEventType::NEAR_MISS;
+    std::uint32_t vehicle_a = 0;  // vehicle_a < vehicle_b
+    std::uint32_t vehicle_b = 0;
+    double distance_m = 0.0;
+};
+
+/**
+ * @brief Pairwise separation check for many vehicles in one process.
+ *
+ * Each tick the registered positions are binned into a spatial hash grid with cells of
+ * near_miss_distance_m, so only vehicles in neighbouring cells are compared. Events are
+ * edge-triggered: a pair reports once when it first comes within the near-miss or
+ * collision distance, and again only after separating past the near-miss distance.
+ */
+class SeparationMonitor {
+public:
+    explicit SeparationMonitor(const SeparationConfig& config = {});
+
+    // The monitor reads the position through the pointer on every update (e.g. the
+    // QuaroSimulation ENU state), so it must outlive the monitor. Returns the vehicle id.
+    std::uint32_t addVehicle(const drone::Vector3* position_enu_m);
+    std::size_t vehicleCount() const { return positions_.size(); }
+
+    const std::vector<SeparationEvent>& update();
+
+    // Distance comparisons made by the last update (brute force would be N(N-1)/2)
+    std::uint64_t lastPairsTested() const { return last_pairs_tested_; }
+
+private:
+    void rebuildGrid();
+    void testPair(std::uint32_t i, std::uint32_t j);
+
+    SeparationConfig config_;
+    double inverse_cell_size_ = 0.0;
+    double near_miss_sq_ = 0.0;
+    double collision_sq_ = 0.0;
+    std::vector<const drone::Vector3*> positions_;
+
+    // counting-sort grid: vehicles ordered by bucket, bucket b spans [bucket_start_[b], bucket_start_[b + 1])
+    std::vector<drone::Vector3> snapshot_;
+    std::vector<std::int64_t> cell_x_;
+    std::vector<std::int64_t> cell_y_;
+    std::vector<std::int64_t> cell_z_;
+    std::vector<std::uint32_t> bucket_of_;
+    std::vector<std::uint32_t> bucket_start_;
+    std::vector<std::uint32_t> bucket_fill_;
+    std::vector<std::uint32_t> sorted_;
+    std::uint32_t bucket_mask_ = 0;
+
+    // pair key -> 1 (near miss) / 2 (collision), for pairs currently within the near-miss distance
+    std::unordered_map<std::uint64_t, std::uint8_t> active_pairs_;
+    std::unordered_map<std::uint64_t, std::uint8_t> next_active_pairs_;
+    std::vector<SeparationEvent> events_;
+    std::uint64_t last_pairs_tested_ = 0;
+};
+
+std::string separationEventTypeToString(SeparationEventType type);
+
+}  // namespace drone::simulator::runtime
+
+#endif  // SIMULATOR_RUNTIME_SEPARATION_MONITOR_H
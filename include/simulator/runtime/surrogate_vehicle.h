@@ -0,0 +1,101 @@
+#ifndef SIMULATOR_RUNTIME_SURROGATE_VEHICLE_H
+#define SIMULATOR_RUNTIME_SURROGATE_VEHICLE_H
+
+#include <array>
+#include <cstddef>
+
+#include "drone/drone_data_types.h"
+#include "drone/runtime/real_drone.h"
+
+namespace drone::simulator::runtime {
+
+constexpr std::size_t kSurrogateStateCount = 3 + drone::runtime::kMotorCount;  // velocity, rotor RPM
+constexpr std::size_t kSurrogateInputCount = drone::runtime::kMotorCount + 2;  // rotor RPM references, pitch, roll
+
+/**
+ * @brief Hover linearization of QuaroSimulation's point-mass dynamics.
+ *
+ * Continuous time, dx/dt = A (x - x_hover) + B (u - u_hover), with
+ *   x = (vx, vy, vz, rpm_0 .. rpm_3)   velocity in the frame turned by the vehicle's yaw
+ *   u = (rpm_ref_0 .. rpm_ref_3, pitch, roll)
+ * and x_hover / u_hover at rest with every rotor at hover_rpm. The dynamics do not depend on
+ * yaw (isotropic drag, gravity along z), so linearizing at yaw 0 and turning the velocity by
+ * the current yaw holds for any heading. The motor ramp is a first-order lag.
+ *
+ * One second-order term is kept: the vertical hover thrust lost to tilt,
+ * hover_thrust_accel_mps2 * (cos(pitch) cos(roll) - 1). RealDrone divides the collective by
+ * the same factor, and without the term the closed loop climbs on every tilted leg.
+ */
+struct SurrogateModel {
+    std::array<double, kSurrogateStateCount * kSurrogateStateCount> a{};  // row-major
+    std::array<double, kSurrogateStateCount * kSurrogateInputCount> b{};  // row-major
+    double hover_rpm = 0.0;
+    double hover_thrust_accel_mps2 = 0.0;  // total hover thrust over mass
+    double motor_time_constant_s = 0.0;  // first-order fit of the motor ramp
+    double motor_max_speed_rpm = 15000.0;
+    double battery_voltage_v = 0.0;  // reported as is; the surrogate has no battery
+};
+
+// Step sizes for QuaroSimulation::linearizeHover
+struct SurrogateLinearization {
+    double rpm_step = 1.0;  // central differences
+    double velocity_step_mps = 1e-3;
+    double angle_step_rad = 1e-4;
+    double motor_step_rpm = 500.0;  // ramp amplitude the first-order lag is fitted to
+    double dt_s = 0.01;             // step the motor ramp is sampled at
+};
+
+/**
+ * @brief Reduced-order vehicle for controller sweeps: the hover linearization in place of
+ * the full simulation.
+ *
+ * Drop-in SensorSource/ActuatorSink for RealDrone::update. The model is discretized exactly
+ * (zero-order hold) for dt_s once, so a step is two small matrix products. Attitude follows
+ * the commanded angles as in QuaroSimulation's default mode; rotor references are clamped
+ * to [0, motor_max_speed_rpm] and the vehicle is held on the ground at z = 0. Sensors are
+ * perfect; battery and motor temperature are not modelled.
+ */
+class SurrogateVehicle final : public drone::runtime::SensorSource, public drone::runtime::ActuatorSink {
+public:
+    SurrogateVehicle(const SurrogateModel& model, double dt_s);
+
+    drone::runtime::SensorFrame readSensors() const override;
+    void applyActuators(const drone::runtime::ActuatorFrame& actuator_frame) override;
+    void step();
+    // External acceleration (weather) added over the next steps, ENU
+    void setDisturbanceAccelerationEnu(const drone::Vector3& acceleration_enu_ms2) {
+        disturbance_acceleration_enu_ms2_ = acceleration_enu_ms2;
+    }
+    // At rest at position_enu_m; rotors at hover speed when airborne, stopped on the ground
+    void reset(const drone::Vector3& position_enu_m);
+
+    const drone::Vector3& getPositionEnu() const { return position_enu_m_; }
+    const drone::Vector3& getVelocityEnu() const { return velocity_enu_mps_; }
+    double getRotorRpm(std::size_t rotor) const { return rotor_rpm_[rotor]; }
+    const SurrogateModel& model() const { return model_; }
+    double dtS() const { return dt_s_; }
+
+private:
+    // trig of the held attitude, refreshed when it changes rather than every step
+    void updateAttitudeTerms();
+
+    SurrogateModel model_;
+    double dt_s_;
+    // discrete-time matrices for dt_s_
+    std::array<double, kSurrogateStateCount * kSurrogateStateCount> ad_{};
+    std::array<double, kSurrogateStateCount * kSurrogateInputCount> bd_{};
+
+    drone::Vector3 position_enu_m_{};
+    drone::Vector3 velocity_enu_mps_{};
+    drone::AttitudeYPR attitude_ypr_rad_{};
+    double yaw_cos_ = 1.0;
+    double yaw_sin_ = 0.0;
+    double tilt_loss_mps2_ = 0.0;
+    drone::Vector3 disturbance_acceleration_enu_ms2_{};
+    std::array<double, drone::runtime::kMotorCount> rotor_rpm_{};
+    std::array<double, drone::runtime::kMotorCount> rotor_rpm_ref_{};
+};
+
+}  // namespace drone::simulator::runtime
+
+#endif  // SIMULATOR_RUNTIME_SURROGATE_VEHICLE_H
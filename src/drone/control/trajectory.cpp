@@ -0,0 +1,165 @@
+#include "drone/control/trajectory.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace drone::control {
+
+namespace {
+
+constexpr int kLimitCheckSamples = 32;
+constexpr int kMaxStretchIterations = 12;
+constexpr double kMinSegmentDuration_s = 0.1;
+// peak speed and acceleration of a rest-to-rest quintic over distance D and duration T
+constexpr double kRestToRestPeakVelocity = 1.875;         // * D / T
+constexpr double kRestToRestPeakAcceleration = 5.773503;  // * D / T^2
+
+double horizontalNorm(const Vector3& v) {
+    return std::sqrt(v.x * v.x + v.y * v.y);
+}
+
+double component(const Vector3& v, int axis) {
+    return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+}
+
+template <std::size_t N>
+double horner(const std::array<double, N>& coefficients, double t) {
+    double value = coefficients[N - 1];
+    for (std::size_t i = N - 1; i-- > 0;) {
+        value = value * t + coefficients[i];
+    }
+    return value;
+}
+
+}  // namespace
+
+MinimumJerkTrajectory::Segment MinimumJerkTrajectory::makeSegment(const Vector3& p0,
+                                                                  const Vector3& v0,
+                                                                  const Vector3& p1,
+                                                                  const Vector3& v1,
+                                                                  double duration_s) {
+    Segment segment;
+    segment.duration_s = duration_s;
+    const double T = duration_s;
+    for (int axis = 0; axis < 3; ++axis) {
+        // zero boundary acceleration at both ends
+        const double dp = component(p1, axis) - component(p0, axis);
+        const double a = component(v0, axis);
+        const double b = component(v1, axis);
+        auto& c = segment.position[axis];
+        c[0] = component(p0, axis);
+        c[1] = a;
+        c[2] = 0.0;
+        c[3] = (20.0 * dp - (8.0 * b + 12.0 * a) * T) / (2.0 * T * T * T);
+        c[4] = (-30.0 * dp + (14.0 * b + 16.0 * a) * T) / (2.0 * T * T * T * T);
+        c[5] = (12.0 * dp - 6.0 * (b + a) * T) / (2.0 * T * T * T * T * T);
+        for (std::size_t k = 0; k < 5; ++k) {
+            segment.velocity[axis][k] = static_cast<double>(k + 1) * c[k + 1];
+        }
+        for (std::size_t k = 0; k < 4; ++k) {
+            segment.acceleration[axis][k] = static_cast<double>(k + 1) * segment.velocity[axis][k + 1];
+        }
+    }
+    return segment;
+}
+
+MinimumJerkTrajectory MinimumJerkTrajectory::plan(const std::vector<Vector3>& waypoints,
+                                                  const Vector3& start_velocity_enu_mps,
+                                                  const TrajectoryLimits& limits) {
+    MinimumJerkTrajectory trajectory;
+    if (waypoints.empty()) {
+        return trajectory;
+    }
+    trajectory.end_position_enu_m_ = waypoints.back();
+    const double max_velocity = std::max(limits.max_velocity_mps, 0.1);
+    const double max_acceleration = std::max(limits.max_acceleration_mps2, 0.1);
+
+    // initial durations from the rest-to-rest peaks
+    const std::size_t segment_count = waypoints.size() - 1;
+    std::vector<double> durations(segment_count);
+    for (std::size_t i = 0; i < segment_count; ++i) {
+        const double distance = horizontalNorm(waypoints[i + 1] - waypoints[i]);
+        durations[i] = std::max({kRestToRestPeakVelocity * distance / max_velocity,
+                                 std::sqrt(kRestToRestPeakAcceleration * distance / max_acceleration),
+                                 kMinSegmentDuration_s});
+    }
+
+    // pass through interior waypoints at the mean of the adjacent segments' average velocities
+    std::vector<Vector3> velocities(waypoints.size(), Vector3(0.0, 0.0, 0.0));
+    velocities.front() = start_velocity_enu_mps;
+    for (std::size_t i = 1; i + 1 < waypoints.size(); ++i) {
+        const Vector3 in = (waypoints[i] - waypoints[i - 1]) * (1.0 / durations[i - 1]);
+        const Vector3 out = (waypoints[i + 1] - waypoints[i]) * (1.0 / durations[i]);
+        Vector3 through = (in + out) * 0.5;
+        const double speed = horizontalNorm(through);
+        if (speed > max_velocity) {
+            through = through * (max_velocity / speed);
+        }
+        velocities[i] = through;
+    }
+
+    double start_time_s = 0.0;
+    for (std::size_t i = 0; i < segment_count; ++i) {
+        Segment segment = makeSegment(waypoints[i], velocities[i], waypoints[i + 1], velocities[i + 1], durations[i]);
+        for (int iteration = 0; iteration < kMaxStretchIterations; ++iteration) {
+            double peak_velocity = 0.0;
+            double peak_acceleration = 0.0;
+            for (int s = 0; s <= kLimitCheckSamples; ++s) {
+                const double t = segment.duration_s * s / kLimitCheckSamples;
+                const Vector3 v(horner(segment.velocity[0], t), horner(segment.velocity[1], t), 0.0);
+                const Vector3 a(horner(segment.acceleration[0], t), horner(segment.acceleration[1], t), 0.0);
+                peak_velocity = std::max(peak_velocity, horizontalNorm(v));
+                peak_acceleration = std::max(peak_acceleration, horizontalNorm(a));
+            }
+            // boundary velocities at or above the limit cannot be fixed by stretching
+            const double boundary_velocity = std::max(horizontalNorm(velocities[i]), horizontalNorm(velocities[i + 1]));
+            const double velocity_ratio = peak_velocity > std::max(max_velocity, boundary_velocity) * 1.001
+                                              ? peak_velocity / std::max(max_velocity, boundary_velocity)
+                                              : 1.0;
+            const double acceleration_ratio = peak_acceleration / max_acceleration;
+            const double stretch = std::max(velocity_ratio, std::sqrt(std::max(acceleration_ratio, 0.0)));
+            if (stretch <= 1.001) {
+                break;
+            }
+            segment = makeSegment(waypoints[i], velocities[i], waypoints[i + 1], velocities[i + 1],
+                                  segment.duration_s * std::min(stretch, 2.0));
+        }
+        segment.start_time_s = start_time_s;
+        start_time_s += segment.duration_s;
+        trajectory.segments_.push_back(segment);
+    }
+    trajectory.duration_s_ = start_time_s;
+    return trajectory;
+}
+
+TrajectorySample MinimumJerkTrajectory::sample(double t_s, std::size_t& segment_cursor) const {
+    TrajectorySample out;
+    if (segments_.empty() || t_s >= duration_s_) {
+        out.position_enu_m = end_position_enu_m_;
+        out.finished = true;
+        return out;
+    }
+    if (segment_cursor >= segments_.size() || t_s < segments_[segment_cursor].start_time_s) {
+        segment_cursor = 0;  // time went backwards
+    }
+    while (segment_cursor + 1 < segments_.size() && t_s >= segments_[segment_cursor + 1].start_time_s) {
+        ++segment_cursor;
+    }
+
+    const Segment& segment = segments_[segment_cursor];
+    const double t = std::max(0.0, t_s - segment.start_time_s);
+    out.position_enu_m = Vector3(horner(segment.position[0], t), horner(segment.position[1], t),
+                                 horner(segment.position[2], t));
+    out.velocity_enu_mps = Vector3(horner(segment.velocity[0], t), horner(segment.velocity[1], t),
+                                   horner(segment.velocity[2], t));
+    out.acceleration_enu_mps2 = Vector3(horner(segment.acceleration[0], t), horner(segment.acceleration[1], t),
+                                        horner(segment.acceleration[2], t));
+    return out;
+}
+
+TrajectorySample MinimumJerkTrajectory::sample(double t_s) const {
+    std::size_t segment_cursor = 0;
+    return sample(t_s, segment_cursor);
+}
+
+}  // namespace drone::control
@@ -0,0 +1,413 @@
+#include "drone/mission/airspace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace drone::mission {
+namespace {
+
+constexpr std::uint32_t kLeafSize = 4;
+constexpr std::size_t kTraversalStackSize = 64;
+constexpr double kParallelEpsilon = 1e-12;
+
+bool pointInFootprint(const std::vector<Vector3>& footprint, double x, double y) {
+    bool inside = false;
+    const std::size_t count = footprint.size();
+    for (std::size_t i = 0, j = count - 1; i < count; j = i++) {
+        const Vector3& a = footprint[i];
+        const Vector3& b = footprint[j];
+        if ((a.y > y) != (b.y > y)) {
+            const double crossing_x = a.x + (y - a.y) * (b.x - a.x) / (b.y - a.y);
+            if (x < crossing_x) {
+                inside = !inside;
+            }
+        }
+    }
+    return inside;
+}
+
+bool pointInVolume(const AirspaceVolume& volume, const Vector3& point) {
+    return point.z >= volume.floor_m && point.z <= volume.ceiling_m &&
+           pointInFootprint(volume.footprint_enu_m, point.x, point.y);
+}
+
+// Earliest parameter in [0, 1] at which start -> end is inside the prism
+bool segmentEntry(const AirspaceVolume& volume, const Vector3& start, const Vector3& end, double& t_out) {
+    const double dx = end.x - start.x;
+    const double dy = end.y - start.y;
+    const double dz = end.z - start.z;
+
+    double t_min = 0.0;
+    double t_max = 1.0;
+    if (std::abs(dz) < kParallelEpsilon) {
+        if (start.z < volume.floor_m || start.z > volume.ceiling_m) {
+            return false;
+        }
+    } else {
+        double t_floor = (volume.floor_m - start.z) / dz;
+        double t_ceiling = (volume.ceiling_m - start.z) / dz;
+        if (t_floor > t_ceiling) {
+            std::swap(t_floor, t_ceiling);
+        }
+        t_min = std::max(t_min, t_floor);
+        t_max = std::min(t_max, t_ceiling);
+        if (t_min > t_max) {
+            return false;
+        }
+    }
+
+    // inside at the start of the slab interval, otherwise the first footprint edge crossing
+    if (pointInFootprint(volume.footprint_enu_m, start.x + t_min * dx, start.y + t_min * dy)) {
+        t_out = t_min;
+        return true;
+    }
+
+    double best_t = std::numeric_limits<double>::infinity();
+    const auto& footprint = volume.footprint_enu_m;
+    const std::size_t count = footprint.size();
+    for (std::size_t i = 0, j = count - 1; i < count; j = i++) {
+        const double ex = footprint[i].x - footprint[j].x;
+        const double ey = footprint[i].y - footprint[j].y;
+        const double denom = dx * ey - dy * ex;
+        if (std::abs(denom) < kParallelEpsilon) {
+            continue;
+        }
+        const double wx = footprint[j].x - start.x;
+        const double wy = footprint[j].y - start.y;
+        const double t = (wx * ey - wy * ex) / denom;
+        const double s = (wx * dy - wy * dx) / denom;
+        if (s >= 0.0 && s <= 1.0 && t >= t_min && t <= t_max && t < best_t) {
+            best_t = t;
+        }
+    }
+    if (best_t <= t_max) {
+        t_out = best_t;
+        return true;
+    }
+    return false;
+}
+
+Vector3 pointAt(const Vector3& start, const Vector3& end, double t) {
+    return Vector3(start.x + t * (end.x - start.x),
+                   start.y + t * (end.y - start.y),
+                   start.z + t * (end.z - start.z));
+}
+
+}  // namespace
+
+const char* airspaceVolumeProblem(const AirspaceVolume& volume) {
+    if (volume.footprint_enu_m.size() < 3) {
+        return "footprint needs at least 3 vertices";
+    }
+    if (volume.ceiling_m < volume.floor_m) {
+        return "ceiling is below the floor";
+    }
+    return nullptr;
+}
+
+AirspaceIndex::AirspaceIndex(std::vector<AirspaceVolume> volumes) : volumes_(std::move(volumes)) {
+    // invalid volumes stay in volumes_ so hit indices match the caller's vector, but are not indexed
+    volume_bounds_.resize(volumes_.size());
+    order_.reserve(volumes_.size());
+    for (std::size_t i = 0; i < volumes_.size(); ++i) {
+        if (airspaceVolumeProblem(volumes_[i]) != nullptr) {
+            continue;
+        }
+        Bounds& bounds = volume_bounds_[i];
+        bounds.min = {std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(), volumes_[i].floor_m};
+        bounds.max = {-std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), volumes_[i].ceiling_m};
+        for (const auto& vertex : volumes_[i].footprint_enu_m) {
+            bounds.min[0] = std::min(bounds.min[0], vertex.x);
+            bounds.min[1] = std::min(bounds.min[1], vertex.y);
+            bounds.max[0] = std::max(bounds.max[0], vertex.x);
+            bounds.max[1] = std::max(bounds.max[1], vertex.y);
+        }
+        order_.push_back(static_cast<std::uint32_t>(i));
+    }
+
+    if (!order_.empty()) {
+        nodes_.reserve(2 * order_.size());
+        build(0, static_cast<std::uint32_t>(order_.size()));
+    }
+}
+
+std::uint32_t AirspaceIndex::build(std::uint32_t begin, std::uint32_t end) {
+    const auto node_index = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.emplace_back();
+
+    Bounds bounds;
+    Bounds centroid_bounds;
+    bounds.min.fill(std::numeric_limits<double>::infinity());
+    bounds.max.fill(-std::numeric_limits<double>::infinity());
+    centroid_bounds = bounds;
+    for (std::uint32_t i = begin; i < end; ++i) {
+        const Bounds& item = volume_bounds_[order_[i]];
+        for (int axis = 0; axis < 3; ++axis) {
+            const double centroid = 0.5 * (item.min[axis] + item.max[axis]);
+            bounds.min[axis] = std::min(bounds.min[axis], item.min[axis]);
+            bounds.max[axis] = std::max(bounds.max[axis], item.max[axis]);
+            centroid_bounds.min[axis] = std::min(centroid_bounds.min[axis], centroid);
+            centroid_bounds.max[axis] = std::max(centroid_bounds.max[axis], centroid);
+        }
+    }
+    nodes_[node_index].bounds = bounds;
+
+    if (end - begin <= kLeafSize) {
+        nodes_[node_index].first = begin;
+        nodes_[node_index].count = end - begin;
+        return node_index;
+    }
+
+    int split_axis = 0;
+    for (int axis = 1; axis < 3; ++axis) {
+        if (centroid_bounds.max[axis] - centroid_bounds.min[axis] >
+            centroid_bounds.max[split_axis] - centroid_bounds.min[split_axis]) {
+            split_axis = axis;
+        }
+    }
+    const std::uint32_t mid = begin + (end - begin) / 2;
+    std::nth_element(order_.begin() + begin, order_.begin() + mid, order_.begin() + end,
+                     [this, split_axis](std::uint32_t lhs, std::uint32_t rhs) {
+                         const Bounds& a = volume_bounds_[lhs];
+                         const Bounds& b = volume_bounds_[rhs];
+                         return a.min[split_axis] + a.max[split_axis] < b.min[split_axis] + b.max[split_axis];
+                     });
+
+    // left child is always node_index + 1; first holds the right child
+    build(begin, mid);
+    nodes_[node_index].first = build(mid, end);
+    nodes_[node_index].count = 0;
+    return node_index;
+}
+
+const AirspaceVolume* AirspaceIndex::findContaining(const Vector3& point_enu_m, AirspaceQueryStats* stats) const {
+    if (stats) {
+        ++stats->queries;
+    }
+    if (nodes_.empty()) {
+        return nullptr;
+    }
+
+    const double point[3] = {point_enu_m.x, point_enu_m.y, point_enu_m.z};
+    std::uint32_t stack[kTraversalStackSize];
+    std::size_t depth = 0;
+    stack[depth++] = 0;
+    while (depth > 0) {
+        const Node& node = nodes_[stack[--depth]];
+        if (stats) {
+            ++stats->nodes_visited;
+        }
+        bool outside = false;
+        for (int axis = 0; axis < 3 && !outside; ++axis) {
+            outside = point[axis] < node.bounds.min[axis] || point[axis] > node.bounds.max[axis];
+        }
+        if (outside) {
+            continue;
+        }
+        if (node.count > 0) {
+            for (std::uint32_t i = node.first; i < node.first + node.count; ++i) {
+                if (stats) {
+                    ++stats->volumes_tested;
+                }
+                if (pointInVolume(volumes_[order_[i]], point_enu_m)) {
+                    return &volumes_[order_[i]];
+                }
+            }
+            continue;
+        }
+        const auto self = static_cast<std::uint32_t>(&node - nodes_.data());
+        stack[depth++] = node.first;
+        stack[depth++] = self + 1;
+    }
+    return nullptr;
+}
+
+bool AirspaceIndex::findFirstHit(const Vector3& start_enu_m,
+                                 const Vector3& end_enu_m,
+                                 AirspaceHit& hit_out,
+                                 AirspaceQueryStats* stats) const {
+    if (stats) {
+        ++stats->queries;
+    }
+    if (nodes_.empty()) {
+        return false;
+    }
+
+    const double origin[3] = {start_enu_m.x, start_enu_m.y, start_enu_m.z};
+    const double delta[3] = {end_enu_m.x - start_enu_m.x, end_enu_m.y - start_enu_m.y, end_enu_m.z - start_enu_m.z};
+
+    double best_t = std::numeric_limits<double>::infinity();
+    std::uint32_t best_volume = 0;
+
+    std::uint32_t stack[kTraversalStackSize];
+    std::size_t depth = 0;
+    stack[depth++] = 0;
+    while (depth > 0) {
+        const Node& node = nodes_[stack[--depth]];
+        if (stats) {
+            ++stats->nodes_visited;
+        }
+
+        // slab test, clipped to the segment and to the best hit so far
+        double t_enter = 0.0;
+        double t_exit = std::min(1.0, best_t);
+        for (int axis = 0; axis < 3 && t_enter <= t_exit; ++axis) {
+            if (std::abs(delta[axis]) < kParallelEpsilon) {
+                if (origin[axis] < node.bounds.min[axis] || origin[axis] > node.bounds.max[axis]) {
+                    t_enter = 1.0;
+                    t_exit = 0.0;
+                }
+                continue;
+            }
+            double t0 = (node.bounds.min[axis] - origin[axis]) / delta[axis];
+            double t1 = (node.bounds.max[axis] - origin[axis]) / delta[axis];
+            if (t0 > t1) {
+                std::swap(t0, t1);
+            }
+            t_enter = std::max(t_enter, t0);
+            t_exit = std::min(t_exit, t1);
+        }
+        if (t_enter > t_exit) {
+            continue;
+        }
+
+        if (node.count > 0) {
+            for (std::uint32_t i = node.first; i < node.first + node.count; ++i) {
+                if (stats) {
+                    ++stats->volumes_tested;
+                }
+                double t = 0.0;
+                if (segmentEntry(volumes_[order_[i]], start_enu_m, end_enu_m, t) && t < best_t) {
+                    best_t = t;
+                    best_volume = order_[i];
+                }
+            }
+            continue;
+        }
+        const auto self = static_cast<std::uint32_t>(&node - nodes_.data());
+        stack[depth++] = node.first;
+        stack[depth++] = self + 1;
+    }
+
+    if (!std::isfinite(best_t)) {
+        return false;
+    }
+    hit_out.volume_index = best_volume;
+    hit_out.segment_t = best_t;
+    hit_out.point_enu_m = pointAt(start_enu_m, end_enu_m, best_t);
+    return true;
+}
+
+std::vector<AirspaceLegConflict> checkMissionLegs(const MissionImage& mission,
+                                                  const AirspaceIndex& index,
+                                                  const MissionOverrides& overrides,
+                                                  AirspaceQueryStats* stats,
+                                                  std::size_t* legs_checked) {
+    std::vector<AirspaceLegConflict> conflicts;
+    std::size_t legs = 0;
+    const MissionImageHeader& header = mission.header();
+    const double offset_x_m = overrides.position_offset_enu_m.x;
+    const double offset_y_m = overrides.position_offset_enu_m.y;
+    Vector3 position(header.initial_x_m + offset_x_m, header.initial_y_m + offset_y_m, header.initial_altitude_m);
+
+    for (std::size_t i = 0; i < mission.stepCount(); ++i) {
+        const FlatMissionStep& step = mission.step(i);
+        if (!step.enabled || !step.has_action) {
+            continue;
+        }
+        switch (step.actionType()) {
+            case ActionType::HOVER:
+            case ActionType::CHANGE_ALTITUDE:
+                position.z = step.action.target_altitude_m + overrides.altitude_offset_m;
+                break;
+            case ActionType::LAND:
+                position.z = 0.0;
+                break;
+            case ActionType::GO_TO_POSITION: {
+                const Vector3 target(step.action.target_x_m + offset_x_m, step.action.target_y_m + offset_y_m,
+                                     step.action.target_altitude_m +
+                                         (step.altitude_agl ? 0.0 : overrides.altitude_offset_m));
+                AirspaceLegConflict conflict;
+                if (index.findFirstHit(position, target, conflict.hit, stats)) {
+                    conflict.step_id = step.step_id;
+                    conflicts.push_back(conflict);
+                }
+                ++legs;
+                position = target;
+                break;
+            }
+            case ActionType::SET_ATTITUDE:
+            case ActionType::ROTATE_YAW:
+                break;
+        }
+    }
+
+    if (legs_checked) {
+        *legs_checked = legs;
+    }
+    return conflicts;
+}
+
+AirspaceMonitor::AirspaceMonitor(std::shared_ptr<const AirspaceIndex> index) : index_(std::move(index)) {}
+
+AirspaceTickResult AirspaceMonitor::update(const Vector3& position_enu_m) {
+    AirspaceTickResult result;
+    if (!index_) {
+        return result;
+    }
+
+    const auto query_start = std::chrono::steady_clock::now();
+    if (has_previous_) {
+        result.hit = index_->findFirstHit(previous_position_enu_m_, position_enu_m, result.first_hit, &stats_);
+    } else {
+        const AirspaceVolume* volume = index_->findContaining(position_enu_m, &stats_);
+        if (volume) {
+            result.hit = true;
+            result.first_hit.volume_index = static_cast<std::size_t>(volume - &index_->volume(0));
+            result.first_hit.point_enu_m = position_enu_m;
+        }
+    }
+    const double query_time_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - query_start).count();
+    total_query_time_s_ += query_time_s;
+    max_query_time_s_ = std::max(max_query_time_s_, query_time_s);
+
+    result.entered = result.hit && !previously_hit_;
+    result.cleared = !result.hit && previously_hit_;
+    previously_hit_ = result.hit;
+    previous_position_enu_m_ = position_enu_m;
+    has_previous_ = true;
+    return result;
+}
+
+std::string describeLegConflicts(const AirspaceIndex& index, const std::vector<AirspaceLegConflict>& conflicts) {
+    if (conflicts.empty()) {
+        return {};
+    }
+    const AirspaceLegConflict& conflict = conflicts.front();
+    const AirspaceVolume& volume = index.volume(conflict.hit.volume_index);
+    std::string message = "go_to_position step_id=" + std::to_string(conflict.step_id) + " enters " +
+                          airspaceVolumeKindToString(volume.kind) + " '" + volume.name + "' at (" +
+                          std::to_string(conflict.hit.point_enu_m.x) + ", " +
+                          std::to_string(conflict.hit.point_enu_m.y) + ", " +
+                          std::to_string(conflict.hit.point_enu_m.z) + ")";
+    if (conflicts.size() > 1) {
+        message += " (+" + std::to_string(conflicts.size() - 1) + " more legs)";
+    }
+    return message;
+}
+
+std::string airspaceVolumeKindToString(AirspaceVolumeKind kind) {
+    switch (kind) {
+        case AirspaceVolumeKind::NO_FLY_ZONE:
+            return "no_fly_zone";
+        case AirspaceVolumeKind::OBSTACLE:
+            return "obstacle";
+    }
+    return "unknown";
+}
+
+}  // namespace drone::mission
@@ -0,0 +1,140 @@
+#include "drone/mission/airspace_loader.h"
+
+#include <yaml-cpp/yaml.h>
+
+namespace drone::mission {
+namespace {
+
+template <typename T>
+void readIfPresent(const YAML::Node& node, const char* key, T& value) {
+    if (node[key]) {
+        value = node[key].as<T>();
+    }
+}
+
+bool readPoint(const YAML::Node& node, Vector3& point_out) {
+    if (!node || !node.IsMap() || !node["x"] || !node["y"]) {
+        return false;
+    }
+    point_out.x = node["x"].as<double>();
+    point_out.y = node["y"].as<double>();
+    readIfPresent(node, "z", point_out.z);
+    return true;
+}
+
+bool readPolygon(const YAML::Node& node, std::vector<Vector3>& footprint_out) {
+    if (!node || !node.IsSequence()) {
+        return false;
+    }
+    footprint_out.clear();
+    footprint_out.reserve(node.size());
+    for (const auto& vertex_node : node) {
+        Vector3 vertex;
+        if (!readPoint(vertex_node, vertex)) {
+            return false;
+        }
+        footprint_out.push_back(vertex);
+    }
+    return true;
+}
+
+// Polygon prism (polygon + floor_m/ceiling_m) or axis-aligned box (min_enu_m/max_enu_m);
+// returns why the entry is invalid, or nullptr
+const char* parseVolume(const YAML::Node& node, AirspaceVolumeKind kind, AirspaceVolume& volume_out) {
+    volume_out = AirspaceVolume{};
+    volume_out.kind = kind;
+    readIfPresent(node, "name", volume_out.name);
+
+    if (node["polygon"]) {
+        if (!readPolygon(node["polygon"], volume_out.footprint_enu_m)) {
+            return "polygon must be a sequence of {x, y} points";
+        }
+        readIfPresent(node, "floor_m", volume_out.floor_m);
+        readIfPresent(node, "ceiling_m", volume_out.ceiling_m);
+        return airspaceVolumeProblem(volume_out);
+    }
+
+    Vector3 min_corner;
+    Vector3 max_corner;
+    if (!readPoint(node["min_enu_m"], min_corner) || !readPoint(node["max_enu_m"], max_corner)) {
+        return "needs a polygon or min_enu_m/max_enu_m corners";
+    }
+    if (max_corner.x < min_corner.x || max_corner.y < min_corner.y || max_corner.z < min_corner.z) {
+        return "max_enu_m is below min_enu_m";
+    }
+    volume_out.footprint_enu_m = {
+        Vector3(min_corner.x, min_corner.y, 0.0),
+        Vector3(max_corner.x, min_corner.y, 0.0),
+        Vector3(max_corner.x, max_corner.y, 0.0),
+        Vector3(min_corner.x, max_corner.y, 0.0),
+    };
+    volume_out.floor_m = min_corner.z;
+    volume_out.ceiling_m = max_corner.z;
+    return nullptr;
+}
+
+bool parseSection(const YAML::Node& root,
+                  const char* key,
+                  AirspaceVolumeKind kind,
+                  std::vector<AirspaceVolume>& volumes_out,
+                  std::string* error_out) {
+    if (!root[key]) {
+        return true;
+    }
+    if (!root[key].IsSequence()) {
+        if (error_out) {
+            *error_out = std::string("'airspace.") + key + "' must be a sequence";
+        }
+        return false;
+    }
+    std::size_t entry = 0;
+    for (const auto& node : root[key]) {
+        AirspaceVolume volume;
+        if (const char* problem = parseVolume(node, kind, volume)) {
+            if (error_out) {
+                *error_out = std::string("Invalid airspace.") + key + " entry " + std::to_string(entry);
+                if (!volume.name.empty()) {
+                    *error_out += " '" + volume.name + "'";
+                }
+                *error_out += std::string(": ") + problem;
+            }
+            return false;
+        }
+        volumes_out.push_back(std::move(volume));
+        ++entry;
+    }
+    return true;
+}
+
+}  // namespace
+
+bool AirspaceLoader::loadFromFile(const std::string& file_path,
+                                  std::vector<AirspaceVolume>& volumes_out,
+                                  std::string* error_out) const {
+    try {
+        const YAML::Node root = YAML::LoadFile(file_path);
+        if (!root["airspace"]) {
+            if (error_out) {
+                *error_out = "Missing top-level 'airspace' node";
+            }
+            return false;
+        }
+
+        std::vector<AirspaceVolume> volumes;
+        const YAML::Node airspace_node = root["airspace"];
+        if (!parseSection(airspace_node, "no_fly_zones", AirspaceVolumeKind::NO_FLY_ZONE, volumes, error_out) ||
+            !parseSection(airspace_node, "obstacles", AirspaceVolumeKind::OBSTACLE, volumes, error_out)) {
+            return false;
+        }
+
+        volumes_out = std::move(volumes);
+        return true;
+    } catch (const YAML::Exception& ex) {
+        if (error_out) {
+            *error_out = ex.what();
+        }
+        return false;
+    }
+}
+
+}  // namespace drone::mission
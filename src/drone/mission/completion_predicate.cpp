@@ -0,0 +1,175 @@
+#include "drone/mission/completion_predicate.h"
+
+#include "drone/runtime/real_drone.h"
+
+#include <cmath>
+
+namespace drone::mission {
+
+namespace {
+
+void setAltitudeBand(CompletionPredicate& predicate,
+                     CompletionAltitudeChannel channel,
+                     double target_m,
+                     double tolerance_m) {
+    predicate.altitude_channel = static_cast<std::uint32_t>(channel);
+    predicate.altitude_min_m = target_m - tolerance_m;
+    predicate.altitude_max_m = target_m + tolerance_m;
+}
+
+// Shortest-way yaw error, matching the wrap CompletionEvaluator always used
+inline double yawError(double yaw_rad, double target_yaw_rad) {
+    const double error_rad = std::fabs(yaw_rad - target_yaw_rad);
+    return std::fmin(error_rad, 2.0 * M_PI - error_rad);
+}
+
+inline bool testPredicate(const CompletionPredicate& p,
+                          double altitude_m,
+                          double x_m,
+                          double y_m,
+                          double vn_mps,
+                          double ve_mps,
+                          double vd_mps,
+                          double yaw_rad,
+                          double pitch_rad,
+                          double roll_rad) {
+    const double dx = x_m - p.target_x_m;
+    const double dy = y_m - p.target_y_m;
+    const double speed_sq = vn_mps * vn_mps + ve_mps * ve_mps + vd_mps * vd_mps;
+    // bitwise & keeps the conjunction branch-free
+    return (altitude_m >= p.altitude_min_m) & (altitude_m <= p.altitude_max_m) &
+           (dx * dx + dy * dy <= p.position_tolerance_sq_m2) &
+           (speed_sq <= p.max_speed_sq_m2ps2) &
+           (yawError(yaw_rad, p.target_yaw_rad) <= p.yaw_tolerance_rad) &
+           (std::fabs(pitch_rad - p.target_pitch_rad) <= p.pitch_tolerance_rad) &
+           (std::fabs(roll_rad - p.target_roll_rad) <= p.roll_tolerance_rad);
+}
+
+}  // namespace
+
+CompletionPredicate compileCompletionCriteria(const CompletionCriteria& criteria) {
+    CompletionPredicate predicate;
+    predicate.hold_duration_s = criteria.hold_duration_s;
+    const double max_speed_sq = criteria.max_velocity_mps * criteria.max_velocity_mps;
+
+    switch (criteria.condition_type) {
+        case CompletionConditionType::TIME_ELAPSED:
+            break;
+
+        case CompletionConditionType::ALTITUDE_REACHED:
+            setAltitudeBand(predicate, CompletionAltitudeChannel::ALTITUDE_M,
+                            criteria.target_altitude_m, criteria.altitude_tolerance_m);
+            break;
+
+        case CompletionConditionType::ALTITUDE_AND_VELOCITY:
+            setAltitudeBand(predicate, CompletionAltitudeChannel::ALTITUDE_M,
+                            criteria.target_altitude_m, criteria.altitude_tolerance_m);
+            predicate.max_speed_sq_m2ps2 = max_speed_sq;
+            break;
+
+        case CompletionConditionType::POSITION_REACHED:
+            setAltitudeBand(predicate, CompletionAltitudeChannel::POSITION_ENU_Z_M,
+                            criteria.target_altitude_m, criteria.altitude_tolerance_m);
+            predicate.target_x_m = criteria.target_position_enu_m.x;
+            predicate.target_y_m = criteria.target_position_enu_m.y;
+            predicate.position_tolerance_sq_m2 = criteria.position_tolerance_m * criteria.position_tolerance_m;
+            break;
+
+        case CompletionConditionType::YAW_REACHED:
+            predicate.target_yaw_rad = criteria.target_yaw_rad;
+            predicate.yaw_tolerance_rad = criteria.yaw_tolerance_rad;
+            break;
+
+        case CompletionConditionType::ATTITUDE_REACHED:
+            predicate.target_yaw_rad = criteria.target_yaw_rad;
+            predicate.yaw_tolerance_rad = criteria.yaw_tolerance_rad;
+            predicate.target_pitch_rad = criteria.target_pitch_rad;
+            predicate.pitch_tolerance_rad = criteria.pitch_tolerance_rad;
+            predicate.target_roll_rad = criteria.target_roll_rad;
+            predicate.roll_tolerance_rad = criteria.roll_tolerance_rad;
+            break;
+
+        case CompletionConditionType::VELOCITY_LOW:
+            predicate.max_speed_sq_m2ps2 = max_speed_sq;
+            break;
+
+        case CompletionConditionType::LANDED:
+            predicate.altitude_channel = static_cast<std::uint32_t>(CompletionAltitudeChannel::ALTITUDE_AGL_M);
+            predicate.altitude_max_m = criteria.altitude_tolerance_m;
+            break;
+
+        case CompletionConditionType::AGL_REACHED:
+            setAltitudeBand(predicate, CompletionAltitudeChannel::ALTITUDE_AGL_M,
+                            criteria.target_altitude_m, criteria.altitude_tolerance_m);
+            break;
+    }
+    return predicate;
+}
+
+bool testCompletionPredicate(const CompletionPredicate& predicate, const runtime::SensorFrame& sensor_frame) {
+    const double altitude_channels[] = {
+        sensor_frame.altitude_m,
+        sensor_frame.position_enu_z_m,
+        sensor_frame.altitude_agl_m,
+    };
+    return testPredicate(predicate,
+                         altitude_channels[predicate.altitude_channel],
+                         sensor_frame.position_enu_x_m,
+                         sensor_frame.position_enu_y_m,
+                         sensor_frame.gps_velocity_north_mps,
+                         sensor_frame.gps_velocity_east_mps,
+                         sensor_frame.gps_velocity_down_mps,
+                         sensor_frame.yaw_rad,
+                         sensor_frame.pitch_rad,
+                         sensor_frame.roll_rad);
+}
+
+void CompletionFrameBatch::resize(std::size_t vehicle_count) {
+    for (auto* column : {&altitude_m, &position_enu_z_m, &altitude_agl_m, &position_enu_x_m, &position_enu_y_m,
+                         &velocity_north_mps, &velocity_east_mps, &velocity_down_mps, &yaw_rad, &pitch_rad,
+                         &roll_rad}) {
+        column->resize(vehicle_count, 0.0);
+    }
+}
+
+void CompletionFrameBatch::set(std::size_t vehicle, const runtime::SensorFrame& sensor_frame) {
+    altitude_m[vehicle] = sensor_frame.altitude_m;
+    position_enu_z_m[vehicle] = sensor_frame.position_enu_z_m;
+    altitude_agl_m[vehicle] = sensor_frame.altitude_agl_m;
+    position_enu_x_m[vehicle] = sensor_frame.position_enu_x_m;
+    position_enu_y_m[vehicle] = sensor_frame.position_enu_y_m;
+    velocity_north_mps[vehicle] = sensor_frame.gps_velocity_north_mps;
+    velocity_east_mps[vehicle] = sensor_frame.gps_velocity_east_mps;
+    velocity_down_mps[vehicle] = sensor_frame.gps_velocity_down_mps;
+    yaw_rad[vehicle] = sensor_frame.yaw_rad;
+    pitch_rad[vehicle] = sensor_frame.pitch_rad;
+    roll_rad[vehicle] = sensor_frame.roll_rad;
+}
+
+void testCompletionPredicateBatch(const CompletionPredicate& predicate,
+                                  const CompletionFrameBatch& batch,
+                                  std::uint8_t* met_out) {
+    // the altitude channel is fixed per predicate, so pick its column once outside the loop
+    const std::vector<double>* altitude_columns[] = {
+        &batch.altitude_m,
+        &batch.position_enu_z_m,
+        &batch.altitude_agl_m,
+    };
+    const double* altitude = altitude_columns[predicate.altitude_channel]->data();
+    const double* x = batch.position_enu_x_m.data();
+    const double* y = batch.position_enu_y_m.data();
+    const double* vn = batch.velocity_north_mps.data();
+    const double* ve = batch.velocity_east_mps.data();
+    const double* vd = batch.velocity_down_mps.data();
+    const double* yaw = batch.yaw_rad.data();
+    const double* pitch = batch.pitch_rad.data();
+    const double* roll = batch.roll_rad.data();
+
+    const std::size_t count = batch.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        met_out[i] = testPredicate(predicate, altitude[i], x[i], y[i], vn[i], ve[i], vd[i],
+                                   yaw[i], pitch[i], roll[i]) ? 1 : 0;
+    }
+}
+
+}  // namespace drone::mission
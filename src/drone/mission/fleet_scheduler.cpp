@@ -0,0 +1,126 @@
+#include "drone/mission/fleet_scheduler.h"
+
+#include "drone/mission/airspace.h"
+#include "drone/mission/airspace_loader.h"
+#include "drone/runtime/real_drone.h"
+
+#include <string>
+#include <utility>
+
+namespace drone::mission {
+
+namespace {
+
+bool isTerminal(MissionStatus status) {
+    return status == MissionStatus::COMPLETED ||
+           status == MissionStatus::ABORTED ||
+           status == MissionStatus::FAILED;
+}
+
+}  // namespace
+
+FleetMissionScheduler::FleetMissionScheduler(const std::shared_ptr<const Mission>& mission)
+    : image_(mission ? MissionImage::fromMission(*mission) : nullptr) {}
+
+FleetMissionScheduler::FleetMissionScheduler(std::shared_ptr<const MissionImage> image)
+    : image_(std::move(image)) {}
+
+std::size_t FleetMissionScheduler::addVehicle(runtime::RealDrone& drone, const MissionOverrides& overrides) {
+    executors_.emplace_back();
+    MissionExecutor& executor = executors_.back();
+    executor.loadMission(image_);
+    executor.setOverrides(overrides);
+    drones_.push_back(&drone);
+    start_time_s_.push_back(overrides.start_delay_s);
+    started_.push_back(false);
+    return executors_.size() - 1;
+}
+
+void FleetMissionScheduler::reserve(std::size_t vehicle_count) {
+    executors_.reserve(vehicle_count);
+    drones_.reserve(vehicle_count);
+    start_time_s_.reserve(vehicle_count);
+    started_.reserve(vehicle_count);
+}
+
+bool FleetMissionScheduler::checkAirspace(std::string* error_out) const {
+    if (!image_ || image_->airspaceFile().empty()) {
+        return true;
+    }
+    std::vector<AirspaceVolume> volumes;
+    if (!AirspaceLoader().loadFromFile(image_->airspaceFile(), volumes, error_out)) {
+        return false;
+    }
+    const AirspaceIndex index(std::move(volumes));
+    // the nominal legs first, so a mission that crosses the airspace fails even with no vehicles
+    const auto conflicts = checkMissionLegs(*image_, index);
+    if (!conflicts.empty()) {
+        if (error_out) {
+            *error_out = describeLegConflicts(index, conflicts);
+        }
+        return false;
+    }
+    for (std::size_t i = 0; i < executors_.size(); ++i) {
+        const auto vehicle_conflicts = checkMissionLegs(*image_, index, executors_[i].getOverrides());
+        if (!vehicle_conflicts.empty()) {
+            if (error_out) {
+                *error_out = "vehicle " + std::to_string(i) + ": " + describeLegConflicts(index, vehicle_conflicts);
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FleetMissionScheduler::start(std::string* error_out) {
+    running_ = false;
+    active_count_ = 0;
+    if (!checkAirspace(error_out)) {
+        return false;
+    }
+    elapsed_time_s_ = 0.0;
+    running_ = true;
+    for (std::size_t i = 0; i < executors_.size(); ++i) {
+        started_[i] = start_time_s_[i] <= 0.0;
+        if (started_[i]) {
+            executors_[i].start();
+            ++active_count_;
+        }
+    }
+    return true;
+}
+
+void FleetMissionScheduler::update(const runtime::SensorFrame* sensor_frames, double dt_s) {
+    if (!running_) {
+        return;
+    }
+    elapsed_time_s_ += dt_s;
+
+    std::size_t active = 0;
+    for (std::size_t i = 0; i < executors_.size(); ++i) {
+        if (!started_[i]) {
+            if (elapsed_time_s_ < start_time_s_[i]) {
+                continue;
+            }
+            started_[i] = true;
+            executors_[i].start();
+        }
+        MissionExecutor& executor = executors_[i];
+        executor.update(*drones_[i], sensor_frames[i], dt_s);
+        if (!isTerminal(executor.getStatus())) {
+            ++active;
+        }
+    }
+    active_count_ = active;
+}
+
+bool FleetMissionScheduler::isFinished() const {
+    for (std::size_t i = 0; i < executors_.size(); ++i) {
+        if (!started_[i] || !isTerminal(executors_[i].getStatus())) {
+            return false;
+        }
+    }
+    return running_;
+}
+
+}  // namespace drone::mission
@@ -2,32 +2,177 @@
 
 #include "drone/runtime/real_drone.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace drone::mission {
 
 void MissionExecutor::loadMission(const Mission& mission) {
-    mission_ = &mission;
+    loadMission(MissionImage::fromMission(mission));
+}
+
+void MissionExecutor::loadMission(std::shared_ptr<const MissionImage> image) {
+    stream_.reset();
+    window_.clear();
+    window_size_ = 0;
+    image_ = std::move(image);
+    steps_ = image_ ? image_->steps() : nullptr;
+    predicates_ = image_ ? image_->completionPredicates() : nullptr;
+    step_count_ = image_ ? image_->stepCount() : 0;
+    program_ = image_ ? image_->instructions() : nullptr;
+    program_size_ = image_ ? image_->instructionCount() : 0;
+    triggers_ = image_ && !image_->triggerTable().empty() ? &image_->triggerTable() : nullptr;
+    status_ = MissionStatus::IDLE;
+    resetRunState();
+}
+
+void MissionExecutor::loadMission(std::unique_ptr<MissionStepSource> source, std::size_t window_steps) {
+    image_.reset();
+    steps_ = nullptr;
+    predicates_ = nullptr;
+    step_count_ = 0;
+    program_ = nullptr;
+    program_size_ = 0;
+    triggers_ = nullptr;
+    stream_ = std::move(source);
+    window_.assign(stream_ ? std::max<std::size_t>(window_steps, 1) : 0, StreamedStep{});
+    window_head_ = 0;
+    window_size_ = 0;
+    streamed_step_count_ = 0;
+    stream_exhausted_ = stream_ == nullptr;
+    refillStreamWindow();
     status_ = MissionStatus::IDLE;
+    resetRunState();
+}
+
+void MissionExecutor::resetRunState() {
     current_step_index_ = 0;
     step_elapsed_time_s_ = 0.0;
     total_elapsed_time_s_ = 0.0;
     completion_evaluator_.reset();
     step_retry_count_ = 0;
-    hover_reference_initialized_ = false;
+    action_applied_ = false;
+    setpoint_update_count_ = 0;
+    vm_.reset();
+    program_running_ = program_size_ > 0;
+    program_pending_ = program_running_;
+    if (triggers_) {
+        trigger_monitor_.reset(*triggers_);
+    }
+    last_trigger_index_ = -1;
+    fired_trigger_count_ = 0;
 }
 
-void MissionExecutor::start() {
-    if (!mission_ || mission_->steps.empty()) {
-        status_ = MissionStatus::FAILED;
+void MissionExecutor::refillStreamWindow() {
+    while (!stream_exhausted_ && window_size_ < window_.size()) {
+        StreamedStep& slot = window_[(window_head_ + window_size_) % window_.size()];
+        if (!stream_->next(slot.step, slot.name)) {
+            stream_exhausted_ = true;
+            break;
+        }
+        slot.predicate = compileCompletionCriteria(slot.step.completion_criteria);
+        ++window_size_;
+        ++streamed_step_count_;
+    }
+}
+
+const FlatMissionStep* MissionExecutor::currentStep() const {
+    return peekStep(0);
+}
+
+const FlatMissionStep* MissionExecutor::peekStep(std::size_t ahead) const {
+    if (stream_) {
+        return ahead < window_size_ ? &window_[(window_head_ + ahead) % window_.size()].step : nullptr;
+    }
+    if (!image_ || current_step_index_ + ahead >= step_count_) {
+        return nullptr;
+    }
+    if (program_running_) {
+        // the program decides what follows, so there is no lookahead
+        return ahead == 0 && !program_pending_ ? &steps_[current_step_index_] : nullptr;
+    }
+    return &steps_[current_step_index_ + ahead];
+}
+
+const CompletionPredicate* MissionExecutor::currentPredicate() const {
+    if (!currentStep()) {
+        return nullptr;
+    }
+    return stream_ ? &window_[window_head_].predicate : &predicates_[current_step_index_];
+}
+
+void MissionExecutor::runProgram(const runtime::SensorFrame& sensor_frame) {
+    const MissionVmResult result = vm_.run(program_, program_size_, sensor_frame, program_budget_);
+    switch (result.state) {
+        case MissionVmState::STEP:
+            current_step_index_ = result.step_index;
+            program_pending_ = false;
+            action_applied_ = false;
+            break;
+        case MissionVmState::YIELD:
+            break;
+        case MissionVmState::DONE:
+            status_ = MissionStatus::COMPLETED;
+            break;
+        case MissionVmState::ABORTED:
+            status_ = MissionStatus::ABORTED;
+            break;
+    }
+}
+
+void MissionExecutor::fireTrigger(int trigger_index) {
+    const FlatMissionTrigger& trigger = triggers_->trigger(static_cast<std::size_t>(trigger_index));
+    last_trigger_index_ = trigger_index;
+    ++fired_trigger_count_;
+
+    if (static_cast<MissionTriggerAction>(trigger.action) == MissionTriggerAction::ABORT) {
+        status_ = MissionStatus::ABORTED;
         return;
     }
 
-    status_ = MissionStatus::RUNNING;
-    current_step_index_ = 0;
+    // the jump replaces the program: the target step and the ones after it run in order
+    program_running_ = false;
+    program_pending_ = false;
+    current_step_index_ = trigger.step_index;
     step_elapsed_time_s_ = 0.0;
-    total_elapsed_time_s_ = 0.0;
     completion_evaluator_.reset();
     step_retry_count_ = 0;
-    hover_reference_initialized_ = false;
+    action_applied_ = false;
+}
+
+std::string MissionExecutor::getLastTriggerName() const {
+    if (last_trigger_index_ < 0) {
+        return "";
+    }
+    return image_->string(triggers_->trigger(static_cast<std::size_t>(last_trigger_index_)).name_offset);
+}
+
+void MissionExecutor::setOverrides(const MissionOverrides& overrides) {
+    overrides_ = overrides;
+    has_overrides_ = overrides.position_offset_enu_m.x != 0.0 ||
+                     overrides.position_offset_enu_m.y != 0.0 ||
+                     overrides.altitude_offset_m != 0.0;
+    action_applied_ = false;
+}
+
+void MissionExecutor::reapplyCurrentStep() {
+    action_applied_ = false;
+}
+
+void MissionExecutor::setProgramBudget(std::size_t instructions_per_tick) {
+    program_budget_ = std::max<std::size_t>(instructions_per_tick, 1);
+}
+
+void MissionExecutor::start() {
+    // a stream that has already advanced cannot rewind to its first step
+    const bool has_first_step = stream_ ? current_step_index_ == 0 && window_size_ > 0 : step_count_ > 0;
+    if (!has_first_step) {
+        status_ = MissionStatus::FAILED;
+        return;
+    }
+
+    status_ = MissionStatus::RUNNING;
+    resetRunState();
 }
 
 void MissionExecutor::pause() {
@@ -47,34 +192,27 @@ void MissionExecutor::abort() {
 }
 
 int MissionExecutor::getCurrentStepId() const {
-    if (!mission_ || current_step_index_ >= mission_->steps.size()) {
-        return -1;
-    }
-    return mission_->steps[current_step_index_].step_id;
+    const FlatMissionStep* step = currentStep();
+    return step ? step->step_id : -1;
 }
 
 std::string MissionExecutor::getCurrentStepName() const {
-    if (!mission_ || current_step_index_ >= mission_->steps.size()) {
+    const FlatMissionStep* step = currentStep();
+    if (!step) {
         return "No step";
     }
-    return mission_->steps[current_step_index_].name;
+    return stream_ ? window_[window_head_].name : image_->string(step->name_offset);
 }
 
 std::string MissionExecutor::getCurrentStepTargetDescription() const {
-    if (!mission_ || current_step_index_ >= mission_->steps.size()) {
+    if (!currentStep()) {
         return "No target";
     }
 
-    const auto& step = mission_->steps[current_step_index_];
-    std::string target;
-
-    if (step.action) {
-        target = step.action->getDescription();
-    } else {
-        target = "No action";
-    }
+    const FlatMissionStep& step = *currentStep();
+    std::string target = step.has_action ? describeFlatAction(step) : "No action";
 
-    if (step.advance_mode == AdvanceMode::COMPLETION_BASED) {
+    if (step.advanceMode() == AdvanceMode::COMPLETION_BASED) {
         target += " | completion: " + CompletionEvaluator::criteriaToString(step.completion_criteria);
     }
 
@@ -83,112 +221,148 @@ std::string MissionExecutor::getCurrentStepTargetDescription() const {
 
 void MissionExecutor::applyCurrentStepAction(runtime::RealDrone& drone,
                                              const runtime::SensorFrame& sensor_frame) {
-    if (!mission_ || current_step_index_ >= mission_->steps.size()) {
+    if (!currentStep()) {
         return;
     }
 
-    const auto& step = mission_->steps[current_step_index_];
-    if (!step.action || !step.enabled) {
+    const FlatMissionStep& step = *currentStep();
+    if (!step.has_action || !step.enabled) {
         return;
     }
-
-    switch (step.action->getActionType()) {
-        case ActionType::HOVER: {
-            auto* hover = dynamic_cast<HoverAction*>(step.action.get());
-            if (hover) {
-                if (!hover_reference_initialized_) {
-                    hover_reference_x_m_ = sensor_frame.position_enu_x_m;
-                    hover_reference_y_m_ = sensor_frame.position_enu_y_m;
-                    hover_reference_initialized_ = true;
-                }
-                drone.setTargetPosition(hover_reference_x_m_, hover_reference_y_m_);
-                drone.setTargetAltitude(hover->target_altitude_m);
-                drone.setTargetYaw(hover->yaw_rad);
-                drone.setPositionControlEnabled(true);
+    const FlatMissionAction& action = step.action;
+    const bool terrain_following = step.actionType() == ActionType::GO_TO_POSITION && step.altitude_agl;
+
+    if (action_applied_) {
+        if (terrain_following) {
+            // the only setpoint that moves within a step
+            runtime::SetpointUpdate update;
+            update.setAltitude(terrainFollowingAltitude(action, sensor_frame));
+            if (update.target_altitude_m != last_altitude_setpoint_m_) {
+                last_altitude_setpoint_m_ = update.target_altitude_m;
+                drone.applySetpoints(update);
+                ++setpoint_update_count_;
             }
-            break;
         }
+        return;
+    }
 
-        case ActionType::GO_TO_POSITION: {
-            auto* goto_pos = dynamic_cast<GoToPositionAction*>(step.action.get());
-            if (goto_pos) {
-                drone.setTargetPosition(goto_pos->target_position_enu_m.x,
-                                        goto_pos->target_position_enu_m.y);
-                drone.setTargetAltitude(goto_pos->target_altitude_m);
-                drone.setMaxVelocity(goto_pos->max_velocity_mps);
-                drone.setMaxTilt(goto_pos->max_tilt_rad);
-                drone.setPositionControlEnabled(true);
-            }
+    runtime::SetpointUpdate update;
+    switch (step.actionType()) {
+        case ActionType::HOVER:
+            // hold the XY where the step was entered; sensor_frame is already in the mission frame
+            update.setPositionControl(true);
+            update.setPosition(sensor_frame.position_enu_x_m + overrides_.position_offset_enu_m.x,
+                               sensor_frame.position_enu_y_m + overrides_.position_offset_enu_m.y);
+            update.setAltitude(action.target_altitude_m + overrides_.altitude_offset_m);
+            update.setYaw(action.yaw_rad);
             break;
-        }
 
-        case ActionType::LAND: {
-            auto* land = dynamic_cast<LandAction*>(step.action.get());
-            if (land) {
-                drone.setTargetAltitude(0.0);
-                drone.setPositionControlEnabled(false);
+        case ActionType::GO_TO_POSITION:
+            update.setPositionControl(true);
+            update.setPosition(action.target_x_m + overrides_.position_offset_enu_m.x,
+                               action.target_y_m + overrides_.position_offset_enu_m.y);
+            update.setAltitude(terrain_following ? terrainFollowingAltitude(action, sensor_frame)
+                                                 : action.target_altitude_m + overrides_.altitude_offset_m);
+            update.setMaxVelocity(action.max_velocity_mps);
+            update.setMaxTilt(action.max_tilt_rad);
+            if (step.min_jerk_trajectory) {
+                update.setTrajectory(planLegTrajectory(action, sensor_frame));
             }
             break;
-        }
 
-        case ActionType::SET_ATTITUDE: {
-            auto* attitude = dynamic_cast<SetAttitudeAction*>(step.action.get());
-            if (attitude) {
-                drone.setTargetPitch(attitude->target_pitch_rad);
-                drone.setTargetRoll(attitude->target_roll_rad);
-                drone.setTargetYaw(attitude->target_yaw_rad);
-                drone.setPositionControlEnabled(false);
-            }
+        case ActionType::LAND:
+            update.setAltitude(0.0);
+            update.setPositionControl(false);
             break;
-        }
 
-        case ActionType::CHANGE_ALTITUDE: {
-            auto* alt_change = dynamic_cast<ChangeAltitudeAction*>(step.action.get());
-            if (alt_change) {
-                drone.setTargetAltitude(alt_change->target_altitude_m);
-                drone.setPositionControlEnabled(false);
-            }
+        case ActionType::SET_ATTITUDE:
+            update.setPitch(action.pitch_rad);
+            update.setRoll(action.roll_rad);
+            update.setYaw(action.yaw_rad);
+            update.setPositionControl(false);
             break;
-        }
 
-        case ActionType::ROTATE_YAW: {
-            auto* yaw = dynamic_cast<RotateYawAction*>(step.action.get());
-            if (yaw) {
-                drone.setTargetYaw(yaw->target_yaw_rad);
-                drone.setPositionControlEnabled(false);
-            }
+        case ActionType::CHANGE_ALTITUDE:
+            update.setAltitude(action.target_altitude_m + overrides_.altitude_offset_m);
+            update.setPositionControl(false);
+            break;
+
+        case ActionType::ROTATE_YAW:
+            update.setYaw(action.yaw_rad);
+            update.setPositionControl(false);
             break;
-        }
     }
+
+    drone.applySetpoints(update);
+    ++setpoint_update_count_;
+    last_altitude_setpoint_m_ = update.target_altitude_m;
+    action_applied_ = true;
+}
+
+std::shared_ptr<const control::MinimumJerkTrajectory> MissionExecutor::planLegTrajectory(
+    const FlatMissionAction& action, const runtime::SensorFrame& sensor_frame) const {
+    // plan in the drone's own frame, from where and how fast it is flying on entry
+    const Vector3& offset = overrides_.position_offset_enu_m;
+    const std::vector<Vector3> waypoints{
+        Vector3(sensor_frame.position_enu_x_m + offset.x, sensor_frame.position_enu_y_m + offset.y, 0.0),
+        Vector3(action.target_x_m + offset.x, action.target_y_m + offset.y, 0.0)};
+    const Vector3 velocity(sensor_frame.gps_velocity_east_mps, sensor_frame.gps_velocity_north_mps, 0.0);
+
+    // the roll law saturates at 0.3 rad; leave half of the tilt for correcting tracking error
+    constexpr double kGravity_mps2 = 9.81;
+    constexpr double kMaxTrajectoryTilt_rad = 0.3;
+    control::TrajectoryLimits limits;
+    limits.max_velocity_mps = action.max_velocity_mps;
+    limits.max_acceleration_mps2 =
+        0.5 * kGravity_mps2 * std::tan(std::min(action.max_tilt_rad, kMaxTrajectoryTilt_rad));
+    return std::make_shared<const control::MinimumJerkTrajectory>(
+        control::MinimumJerkTrajectory::plan(waypoints, velocity, limits));
+}
+
+double MissionExecutor::terrainFollowingAltitude(const FlatMissionAction& action,
+                                                 const runtime::SensorFrame& sensor_frame) const {
+    // hold the height above the ground currently under the vehicle
+    // (the override shift of altitude_m cancels out here)
+    const double ground_height_m = sensor_frame.altitude_m - sensor_frame.altitude_agl_m;
+    return ground_height_m + overrides_.altitude_offset_m + action.target_altitude_m;
 }
 
 void MissionExecutor::advanceToNextStep() {
-    if (!mission_) {
+    if (!image_ && !stream_) {
         status_ = MissionStatus::COMPLETED;
         return;
     }
 
-    current_step_index_++;
+    if (program_running_) {
+        program_pending_ = true;
+    } else {
+        current_step_index_++;
+        if (stream_ && window_size_ > 0) {
+            window_head_ = (window_head_ + 1) % window_.size();
+            --window_size_;
+            refillStreamWindow();
+        }
 
-    if (current_step_index_ >= mission_->steps.size()) {
-        status_ = MissionStatus::COMPLETED;
-        return;
+        if (!currentStep()) {
+            status_ = MissionStatus::COMPLETED;
+            return;
+        }
     }
 
     step_elapsed_time_s_ = 0.0;
     completion_evaluator_.reset();
     step_retry_count_ = 0;
-    hover_reference_initialized_ = false;
+    action_applied_ = false;
 }
 
 void MissionExecutor::handleStepTimeout() {
-    if (!mission_ || current_step_index_ >= mission_->steps.size()) {
+    if (!currentStep()) {
         return;
     }
 
-    const auto& step = mission_->steps[current_step_index_];
+    const FlatMissionStep& step = *currentStep();
 
-    switch (step.timeout_behavior) {
+    switch (step.timeoutBehavior()) {
         case TimeoutBehavior::ABORT:
             status_ = MissionStatus::ABORTED;
             break;
@@ -202,7 +376,7 @@ void MissionExecutor::handleStepTimeout() {
                 step_retry_count_++;
                 step_elapsed_time_s_ = 0.0;
                 completion_evaluator_.reset();
-                hover_reference_initialized_ = false;
+                action_applied_ = false;
             } else {
                 status_ = MissionStatus::ABORTED;
             }
@@ -213,41 +387,75 @@ void MissionExecutor::handleStepTimeout() {
 void MissionExecutor::update(runtime::RealDrone& drone,
                              const runtime::SensorFrame& sensor_frame,
                              double dt_s) {
-    if (status_ != MissionStatus::RUNNING || !mission_ || mission_->steps.empty()) {
+    if (status_ != MissionStatus::RUNNING || !isMissionLoaded()) {
         return;
     }
 
     total_elapsed_time_s_ += dt_s;
     step_elapsed_time_s_ += dt_s;
 
-    if (current_step_index_ >= mission_->steps.size()) {
+    // with overrides, evaluate the shared mission in its own frame by shifting the sensors instead of the steps
+    runtime::SensorFrame shifted_frame;
+    const runtime::SensorFrame& frame = has_overrides_ ? shifted_frame : sensor_frame;
+    if (has_overrides_) {
+        shifted_frame = sensor_frame;
+        shifted_frame.position_enu_x_m -= overrides_.position_offset_enu_m.x;
+        shifted_frame.position_enu_y_m -= overrides_.position_offset_enu_m.y;
+        shifted_frame.position_enu_z_m -= overrides_.altitude_offset_m;
+        shifted_frame.altitude_m -= overrides_.altitude_offset_m;
+        shifted_frame.gps_altitude_m -= overrides_.altitude_offset_m;
+    }
+
+    if (triggers_) {
+        const auto& fired = trigger_monitor_.update(*triggers_, frame);
+        if (!fired.empty()) {
+            // triggers that fire together all count, but only the highest priority one is acted on
+            fired_trigger_count_ += fired.size() - 1;
+            fireTrigger(selectMissionTrigger(*triggers_, fired));
+            if (status_ != MissionStatus::RUNNING) {
+                return;
+            }
+        }
+    }
+
+    if (program_pending_) {
+        // keeps the previous step's setpoints while the program spends its budget
+        runProgram(frame);
+        if (program_pending_ || status_ != MissionStatus::RUNNING) {
+            return;
+        }
+    }
+
+    if (!currentStep()) {
         status_ = MissionStatus::COMPLETED;
         return;
     }
 
-    const auto& step = mission_->steps[current_step_index_];
+    const FlatMissionStep& step = *currentStep();
     if (!step.enabled) {
         advanceToNextStep();
         return;
     }
 
-    applyCurrentStepAction(drone, sensor_frame);
+    applyCurrentStepAction(drone, frame);
 
     bool step_complete = false;
 
-    if (step.advance_mode == AdvanceMode::TIME_BASED) {
+    if (step.advanceMode() == AdvanceMode::TIME_BASED) {
         step_complete = step_elapsed_time_s_ >= step.duration_s;
-    } else if (step.advance_mode == AdvanceMode::COMPLETION_BASED) {
-        step_complete = completion_evaluator_.isMet(step.completion_criteria, sensor_frame, dt_s);
+    } else if (step.advanceMode() == AdvanceMode::COMPLETION_BASED) {
+        step_complete = completion_evaluator_.isMet(*currentPredicate(), frame, dt_s);
     }
 
     if (step_elapsed_time_s_ > step.timeout_s) {
         handleStepTimeout();
-        return;
+    } else if (step_complete) {
+        advanceToNextStep();
     }
 
-    if (step_complete) {
-        advanceToNextStep();
+    // pick the program's next step on the same tick so the step id has no gap
+    if (program_pending_ && status_ == MissionStatus::RUNNING) {
+        runProgram(frame);
     }
 }
 
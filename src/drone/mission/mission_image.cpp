@@ -0,0 +1,351 @@
+#include "drone/mission/mission_image.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+
+namespace drone::mission {
+
+namespace {
+
+constexpr char kMagic[8] = {'V', 'D', 'M', 'I', 'S', 'S', 'N', '\0'};
+
+std::size_t alignUp(std::size_t value, std::size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// `count` entries of `entry_size` bytes starting at `offset` end at or before `end`; written
+// without sums so crafted header values cannot wrap around
+bool tableFits(std::uint64_t offset, std::uint64_t count, std::uint64_t entry_size, std::uint64_t end) {
+    return offset <= end && count <= (end - offset) / entry_size;
+}
+
+class StringTable {
+public:
+    StringTable() { add(""); }
+
+    std::uint32_t add(const std::string& text) {
+        const auto existing = offsets_.find(text);
+        if (existing != offsets_.end()) {
+            return existing->second;
+        }
+        const auto offset = static_cast<std::uint32_t>(bytes_.size());
+        bytes_.insert(bytes_.end(), text.begin(), text.end());
+        bytes_.push_back('\0');
+        offsets_.emplace(text, offset);
+        return offset;
+    }
+
+    const std::vector<char>& bytes() const { return bytes_; }
+
+private:
+    std::vector<char> bytes_;
+    std::unordered_map<std::string, std::uint32_t> offsets_;
+};
+
+FlatMissionStep flattenStep(const MissionStep& step, StringTable& strings) {
+    FlatMissionStep flat;
+    flat.step_id = step.step_id;
+    flat.name_offset = strings.add(step.name);
+    flat.advance_mode = static_cast<std::int32_t>(step.advance_mode);
+    flat.timeout_behavior = static_cast<std::int32_t>(step.timeout_behavior);
+    flat.fallback_step_id = step.fallback_step_id;
+    flat.retry_count = step.retry_count;
+    flat.enabled = step.enabled ? 1 : 0;
+    flat.duration_s = step.duration_s;
+    flat.timeout_s = step.timeout_s;
+    flat.completion_criteria = step.completion_criteria;
+
+    if (!step.action) {
+        flat.has_action = 0;
+        return flat;
+    }
+    flat.action_type = static_cast<std::int32_t>(step.action->getActionType());
+    FlatMissionAction& action = flat.action;
+    switch (step.action->getActionType()) {
+        case ActionType::HOVER: {
+            const auto& hover = static_cast<const HoverAction&>(*step.action);
+            action.target_altitude_m = hover.target_altitude_m;
+            action.yaw_rad = hover.yaw_rad;
+            break;
+        }
+        case ActionType::GO_TO_POSITION: {
+            const auto& go_to = static_cast<const GoToPositionAction&>(*step.action);
+            action.target_x_m = go_to.target_position_enu_m.x;
+            action.target_y_m = go_to.target_position_enu_m.y;
+            action.target_altitude_m = go_to.target_altitude_m;
+            action.max_tilt_rad = go_to.max_tilt_rad;
+            action.max_velocity_mps = go_to.max_velocity_mps;
+            flat.altitude_agl = go_to.altitude_mode == "agl" ? 1 : 0;
+            flat.min_jerk_trajectory = go_to.trajectory == "min_jerk" ? 1 : 0;
+            break;
+        }
+        case ActionType::LAND: {
+            action.rate_mps = static_cast<const LandAction&>(*step.action).descent_rate_mps;
+            break;
+        }
+        case ActionType::SET_ATTITUDE: {
+            const auto& attitude = static_cast<const SetAttitudeAction&>(*step.action);
+            action.pitch_rad = attitude.target_pitch_rad;
+            action.roll_rad = attitude.target_roll_rad;
+            action.yaw_rad = attitude.target_yaw_rad;
+            break;
+        }
+        case ActionType::CHANGE_ALTITUDE: {
+            const auto& change = static_cast<const ChangeAltitudeAction&>(*step.action);
+            action.target_altitude_m = change.target_altitude_m;
+            action.rate_mps = change.rate_mps;
+            break;
+        }
+        case ActionType::ROTATE_YAW: {
+            action.yaw_rad = static_cast<const RotateYawAction&>(*step.action).target_yaw_rad;
+            break;
+        }
+    }
+    return flat;
+}
+
+void setError(std::string* error_out, const std::string& message) {
+    if (error_out) {
+        *error_out = message;
+    }
+}
+
+}  // namespace
+
+std::shared_ptr<const MissionImage> MissionImage::fromMission(const Mission& mission) {
+    StringTable strings;
+    MissionImageHeader header;
+    header.name_offset = strings.add(mission.name);
+    header.description_offset = strings.add(mission.description);
+    header.version_string_offset = strings.add(mission.version);
+    header.airspace_file_offset = strings.add(mission.airspace_file);
+    header.max_duration_s = mission.max_duration_s;
+    header.initial_altitude_m = mission.initial_conditions.altitude_m;
+    header.initial_x_m = mission.initial_conditions.position_enu_m.x;
+    header.initial_y_m = mission.initial_conditions.position_enu_m.y;
+    header.initial_yaw_rad = mission.initial_conditions.yaw_rad;
+    header.initial_battery_soc_percent = mission.initial_conditions.battery_soc_percent;
+
+    std::vector<FlatMissionStep> steps;
+    steps.reserve(mission.steps.size());
+    for (const auto& step : mission.steps) {
+        steps.push_back(flattenStep(step, strings));
+    }
+
+    std::unordered_map<int, std::uint32_t> step_indices;
+    for (std::size_t i = 0; i < mission.steps.size(); ++i) {
+        step_indices.emplace(mission.steps[i].step_id, static_cast<std::uint32_t>(i));
+    }
+    std::vector<FlatMissionTrigger> triggers;
+    triggers.reserve(mission.triggers.size());
+    for (const auto& trigger : mission.triggers) {
+        FlatMissionTrigger flat;
+        flat.field = static_cast<std::uint8_t>(trigger.field);
+        flat.direction = static_cast<std::uint8_t>(trigger.direction);
+        flat.action = static_cast<std::uint8_t>(trigger.action);
+        flat.name_offset = strings.add(trigger.name);
+        const auto step_index = step_indices.find(trigger.step_id);
+        // an unknown target fails validation in attach()
+        flat.step_index = step_index != step_indices.end() ? step_index->second
+                                                           : static_cast<std::uint32_t>(mission.steps.size());
+        flat.threshold = trigger.threshold;
+        flat.hysteresis = trigger.hysteresis;
+        triggers.push_back(flat);
+    }
+
+    header.step_count = static_cast<std::uint32_t>(steps.size());
+    header.instruction_count = static_cast<std::uint32_t>(mission.program.size());
+    header.trigger_count = static_cast<std::uint32_t>(triggers.size());
+    header.string_table_size = static_cast<std::uint32_t>(strings.bytes().size());
+    header.steps_offset = alignUp(sizeof(MissionImageHeader), alignof(FlatMissionStep));
+    header.instructions_offset = alignUp(header.steps_offset + steps.size() * sizeof(FlatMissionStep),
+                                         alignof(MissionInstruction));
+    header.triggers_offset = alignUp(header.instructions_offset + mission.program.size() * sizeof(MissionInstruction),
+                                     alignof(FlatMissionTrigger));
+    header.strings_offset = header.triggers_offset + triggers.size() * sizeof(FlatMissionTrigger);
+    const std::size_t size = header.strings_offset + strings.bytes().size();
+
+    std::shared_ptr<MissionImage> image(new MissionImage());
+    image->buffer_.assign(alignUp(size, sizeof(std::uint64_t)) / sizeof(std::uint64_t), 0);
+    auto* bytes = reinterpret_cast<unsigned char*>(image->buffer_.data());
+    std::memcpy(bytes, &header, sizeof(header));
+    if (!steps.empty()) {
+        std::memcpy(bytes + header.steps_offset, steps.data(), steps.size() * sizeof(FlatMissionStep));
+    }
+    if (!mission.program.empty()) {
+        std::memcpy(bytes + header.instructions_offset, mission.program.data(),
+                    mission.program.size() * sizeof(MissionInstruction));
+    }
+    if (!triggers.empty()) {
+        std::memcpy(bytes + header.triggers_offset, triggers.data(), triggers.size() * sizeof(FlatMissionTrigger));
+    }
+    std::memcpy(bytes + header.strings_offset, strings.bytes().data(), strings.bytes().size());
+    if (!image->attach(bytes, size, nullptr)) {
+        return nullptr;
+    }
+    return image;
+}
+
+std::shared_ptr<const MissionImage> MissionImage::open(const std::string& file_path, std::string* error_out) {
+    std::shared_ptr<MissionImage> image(new MissionImage());
+    if (!image->file_.open(file_path)) {
+        setError(error_out, "Cannot open mission image: " + file_path);
+        return nullptr;
+    }
+    if (!image->attach(image->file_.data(), image->file_.size(), error_out)) {
+        return nullptr;
+    }
+    // relative airspace paths were written relative to the image file
+    if (!image->airspace_file_.empty() && std::filesystem::path(image->airspace_file_).is_relative()) {
+        image->airspace_file_ =
+            (std::filesystem::path(file_path).parent_path() / image->airspace_file_).lexically_normal().string();
+    }
+    return image;
+}
+
+bool MissionImage::isImageFile(const std::string& file_path) {
+    std::ifstream in(file_path, std::ios::binary);
+    char magic[sizeof(kMagic)] = {};
+    return in.read(magic, sizeof(magic)) && std::memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+}
+
+bool MissionImage::attach(const unsigned char* data, std::size_t size, std::string* error_out) {
+    if (size < sizeof(MissionImageHeader)) {
+        setError(error_out, "Mission image too small");
+        return false;
+    }
+    MissionImageHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        setError(error_out, "Not a mission image");
+        return false;
+    }
+    if (header.version != kMissionImageVersion || header.step_size != sizeof(FlatMissionStep)) {
+        setError(error_out, "Unsupported mission image version " + std::to_string(header.version) +
+                                " (expected " + std::to_string(kMissionImageVersion) + "); recompile the mission");
+        return false;
+    }
+    // sections in file order, each bounded by the next one and the strings by the image size
+    if (header.steps_offset % alignof(FlatMissionStep) != 0 ||
+        header.instructions_offset % alignof(MissionInstruction) != 0 ||
+        header.triggers_offset % alignof(FlatMissionTrigger) != 0 ||
+        header.string_table_size == 0 ||
+        !tableFits(header.strings_offset, header.string_table_size, 1, size) ||
+        !tableFits(header.triggers_offset, header.trigger_count, sizeof(FlatMissionTrigger), header.strings_offset) ||
+        !tableFits(header.instructions_offset, header.instruction_count, sizeof(MissionInstruction),
+                   header.triggers_offset) ||
+        !tableFits(header.steps_offset, header.step_count, sizeof(FlatMissionStep), header.instructions_offset)) {
+        setError(error_out, "Corrupt mission image layout");
+        return false;
+    }
+
+    const char* strings = reinterpret_cast<const char*>(data + header.strings_offset);
+    if (strings[header.string_table_size - 1] != '\0') {
+        setError(error_out, "Corrupt mission image string table");
+        return false;
+    }
+    const auto validString = [&](std::uint32_t offset) { return offset < header.string_table_size; };
+    if (!validString(header.name_offset) || !validString(header.description_offset) ||
+        !validString(header.version_string_offset) || !validString(header.airspace_file_offset)) {
+        setError(error_out, "Corrupt mission image string offsets");
+        return false;
+    }
+
+    const auto* steps = reinterpret_cast<const FlatMissionStep*>(data + header.steps_offset);
+    for (std::uint32_t i = 0; i < header.step_count; ++i) {
+        const FlatMissionStep& step = steps[i];
+        const bool enums_valid =
+            step.action_type >= static_cast<std::int32_t>(ActionType::HOVER) &&
+            step.action_type <= static_cast<std::int32_t>(ActionType::ROTATE_YAW) &&
+            step.advance_mode >= static_cast<std::int32_t>(AdvanceMode::TIME_BASED) &&
+            step.advance_mode <= static_cast<std::int32_t>(AdvanceMode::COMPLETION_BASED) &&
+            step.timeout_behavior >= static_cast<std::int32_t>(TimeoutBehavior::ABORT) &&
+            step.timeout_behavior <= static_cast<std::int32_t>(TimeoutBehavior::RETRY) &&
+            step.completion_criteria.condition_type >= CompletionConditionType::TIME_ELAPSED &&
+            step.completion_criteria.condition_type <= CompletionConditionType::AGL_REACHED;
+        if (!enums_valid || !validString(step.name_offset)) {
+            setError(error_out, "Corrupt mission image step " + std::to_string(i));
+            return false;
+        }
+    }
+
+    const auto* instructions = reinterpret_cast<const MissionInstruction*>(data + header.instructions_offset);
+    if (!validateMissionProgram(instructions, header.instruction_count, header.step_count)) {
+        setError(error_out, "Corrupt mission image program");
+        return false;
+    }
+
+    const auto* triggers = reinterpret_cast<const FlatMissionTrigger*>(data + header.triggers_offset);
+    bool trigger_names_valid = true;
+    for (std::uint32_t i = 0; i < header.trigger_count; ++i) {
+        trigger_names_valid = trigger_names_valid && validString(triggers[i].name_offset);
+    }
+    if (!trigger_names_valid || !validateMissionTriggers(triggers, header.trigger_count, header.step_count)) {
+        setError(error_out, "Corrupt mission image triggers");
+        return false;
+    }
+
+    data_ = data;
+    size_ = size;
+    steps_ = steps;
+    instructions_ = instructions;
+    triggers_ = triggers;
+    trigger_table_ = MissionTriggerTable(triggers, header.trigger_count);
+    strings_ = strings;
+    airspace_file_ = strings + header.airspace_file_offset;
+    predicates_.clear();
+    predicates_.reserve(header.step_count);
+    for (std::uint32_t i = 0; i < header.step_count; ++i) {
+        predicates_.push_back(compileCompletionCriteria(steps[i].completion_criteria));
+    }
+    return true;
+}
+
+bool MissionImage::write(const std::string& file_path, std::string* error_out) const {
+    std::ofstream out(file_path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        setError(error_out, "Cannot write mission image: " + file_path);
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(data_), static_cast<std::streamsize>(size_));
+    if (!out) {
+        setError(error_out, "Failed writing mission image: " + file_path);
+        return false;
+    }
+    return true;
+}
+
+InitialConditions MissionImage::initialConditions() const {
+    const MissionImageHeader& h = header();
+    InitialConditions initial;
+    initial.altitude_m = h.initial_altitude_m;
+    initial.position_enu_m = Vector3(h.initial_x_m, h.initial_y_m, 0.0);
+    initial.yaw_rad = h.initial_yaw_rad;
+    initial.battery_soc_percent = h.initial_battery_soc_percent;
+    return initial;
+}
+
+std::string describeFlatAction(const FlatMissionStep& step) {
+    const FlatMissionAction& action = step.action;
+    switch (step.actionType()) {
+        case ActionType::HOVER:
+            return "Hover at " + std::to_string(action.target_altitude_m) + "m";
+        case ActionType::GO_TO_POSITION:
+            return "Fly to (" + std::to_string(action.target_x_m) + ", " +
+                   std::to_string(action.target_y_m) + ") at " +
+                   std::to_string(action.target_altitude_m) + "m";
+        case ActionType::LAND:
+            return "Land";
+        case ActionType::SET_ATTITUDE:
+            return "Set attitude";
+        case ActionType::CHANGE_ALTITUDE:
+            return "Change altitude to " + std::to_string(action.target_altitude_m) + "m";
+        case ActionType::ROTATE_YAW:
+            return "Rotate yaw";
+    }
+    return "No action";
+}
+
+}  // namespace drone::mission
@@ -1,5 +1,9 @@
 #include "drone/mission/mission_loader.h"
 
+#include "drone/mission/mission_patterns.h"
+
+#include <algorithm>
+#include <filesystem>
 #include <memory>
 
 #include <yaml-cpp/yaml.h>
@@ -65,9 +69,23 @@ CompletionConditionType parseCompletionCondition(const std::string& condition_ty
     if (condition_type == "landed") {
         return CompletionConditionType::LANDED;
     }
+    if (condition_type == "agl_reached") {
+        return CompletionConditionType::AGL_REACHED;
+    }
     return CompletionConditionType::TIME_ELAPSED;
 }
 
+// Rejects go_to_position mode strings the image compiler would silently treat as the default
+std::string goToPositionProblem(const GoToPositionAction& go_to) {
+    if (go_to.altitude_mode != "absolute" && go_to.altitude_mode != "agl") {
+        return "unknown altitude_mode '" + go_to.altitude_mode + "' (expected absolute or agl)";
+    }
+    if (go_to.trajectory != "direct" && go_to.trajectory != "min_jerk") {
+        return "unknown trajectory '" + go_to.trajectory + "' (expected direct or min_jerk)";
+    }
+    return {};
+}
+
 std::unique_ptr<MissionAction> parseAction(const YAML::Node& step_node) {
     if (!step_node["action"]) {
         return nullptr;
@@ -85,6 +103,7 @@ std::unique_ptr<MissionAction> parseAction(const YAML::Node& step_node) {
         readVector2EnuIfPresent(step_node, "target_position_enu_m", go_to->target_position_enu_m);
         readIfPresent(step_node, "target_altitude_m", go_to->target_altitude_m);
         readIfPresent(step_node, "altitude_mode", go_to->altitude_mode);
+        readIfPresent(step_node, "trajectory", go_to->trajectory);
         readIfPresent(step_node, "max_tilt_rad", go_to->max_tilt_rad);
         readIfPresent(step_node, "max_velocity_mps", go_to->max_velocity_mps);
         return go_to;
@@ -147,6 +166,154 @@ void parseCompletionCriteria(const YAML::Node& step_node, CompletionCriteria& cr
     readIfPresent(criteria_node, "timeout_s", criteria_out.timeout_s);
 }
 
+bool parseTriggers(const YAML::Node& triggers_node,
+                   const std::vector<MissionStep>& steps,
+                   std::vector<MissionTrigger>& triggers_out,
+                   std::string* error_out) {
+    const auto fail = [&](const std::string& message) {
+        if (error_out) {
+            *error_out = message;
+        }
+        return false;
+    };
+    if (!triggers_node.IsSequence()) {
+        return fail("'mission.triggers' must be a sequence");
+    }
+
+    for (const auto& trigger_node : triggers_node) {
+        MissionTrigger trigger;
+        trigger.name = "trigger " + std::to_string(triggers_out.size() + 1);
+        readIfPresent(trigger_node, "name", trigger.name);
+        const std::string where = "trigger '" + trigger.name + "'";
+
+        std::string field;
+        readIfPresent(trigger_node, "field", field);
+        if (!parseMissionSensorField(field, trigger.field)) {
+            return fail(where + " has unknown field '" + field + "'");
+        }
+
+        if (trigger_node["below"].IsDefined() == trigger_node["above"].IsDefined()) {
+            return fail(where + " needs exactly one of 'below' or 'above'");
+        }
+        trigger.direction = trigger_node["below"] ? MissionTriggerDirection::BELOW : MissionTriggerDirection::ABOVE;
+        trigger.threshold = trigger_node[trigger_node["below"] ? "below" : "above"].as<double>();
+        readIfPresent(trigger_node, "hysteresis", trigger.hysteresis);
+        if (trigger.hysteresis < 0.0) {
+            return fail(where + " has negative hysteresis");
+        }
+
+        std::string action;
+        readIfPresent(trigger_node, "action", action);
+        if (action == "abort") {
+            trigger.action = MissionTriggerAction::ABORT;
+        } else if (action == "goto_step") {
+            trigger.action = MissionTriggerAction::GOTO_STEP;
+            readIfPresent(trigger_node, "step_id", trigger.step_id);
+            const bool known_step = std::any_of(steps.begin(), steps.end(), [&](const MissionStep& step) {
+                return step.step_id == trigger.step_id;
+            });
+            if (!known_step) {
+                return fail(where + " references unknown step_id=" + std::to_string(trigger.step_id));
+            }
+        } else {
+            return fail(where + " has unknown action '" + action + "'");
+        }
+
+        triggers_out.push_back(std::move(trigger));
+    }
+    return true;
+}
+
+bool parsePattern(const YAML::Node& pattern_node,
+                  const Mission& mission,
+                  MissionPatternSpec& pattern_out,
+                  std::string* error_out) {
+    const auto fail = [&](const std::string& message) {
+        if (error_out) {
+            *error_out = message;
+        }
+        return false;
+    };
+    if (!pattern_node.IsMap()) {
+        return fail("'mission.pattern' must be a map");
+    }
+    // streamed steps have no image to index programs, triggers or airspace legs against
+    if (!mission.program.empty() || !mission.triggers.empty() || !mission.airspace_file.empty()) {
+        return fail("'mission.pattern' cannot be combined with program, triggers or airspace_file");
+    }
+
+    std::string type;
+    readIfPresent(pattern_node, "type", type);
+    if (!parsePatternType(type, pattern_out.type)) {
+        return fail("pattern has unknown type '" + type + "'");
+    }
+
+    readIfPresent(pattern_node, "after_step_id", pattern_out.after_step_id);
+    const auto has_step = [&](int step_id) {
+        return std::any_of(mission.steps.begin(), mission.steps.end(),
+                           [&](const MissionStep& step) { return step.step_id == step_id; });
+    };
+    if (pattern_out.after_step_id != 0 && !has_step(pattern_out.after_step_id)) {
+        return fail("pattern references unknown after_step_id=" + std::to_string(pattern_out.after_step_id));
+    }
+    readIfPresent(pattern_node, "window_steps", pattern_out.window_steps);
+
+    PatternLegConfig& leg = pattern_out.leg;
+    for (const auto& step : mission.steps) {
+        leg.first_step_id = std::max(leg.first_step_id, step.step_id + 1);
+    }
+    readIfPresent(pattern_node, "first_step_id", leg.first_step_id);
+    readIfPresent(pattern_node, "altitude_m", leg.altitude_m);
+    readIfPresent(pattern_node, "max_velocity_mps", leg.max_velocity_mps);
+    readIfPresent(pattern_node, "max_tilt_rad", leg.max_tilt_rad);
+    readIfPresent(pattern_node, "position_tolerance_m", leg.position_tolerance_m);
+    readIfPresent(pattern_node, "altitude_tolerance_m", leg.altitude_tolerance_m);
+    readIfPresent(pattern_node, "hold_duration_s", leg.hold_duration_s);
+    readIfPresent(pattern_node, "timeout_s", leg.timeout_s);
+    std::string timeout_behavior = "proceed";
+    readIfPresent(pattern_node, "on_timeout", timeout_behavior);
+    leg.timeout_behavior = parseTimeoutBehavior(timeout_behavior);
+
+    switch (pattern_out.type) {
+        case PatternType::LAWNMOWER: {
+            LawnmowerConfig& lawnmower = pattern_out.lawnmower;
+            readVector2EnuIfPresent(pattern_node, "origin_enu_m", lawnmower.origin_enu_m);
+            readIfPresent(pattern_node, "length_m", lawnmower.length_m);
+            readIfPresent(pattern_node, "width_m", lawnmower.width_m);
+            readIfPresent(pattern_node, "lane_spacing_m", lawnmower.lane_spacing_m);
+            readIfPresent(pattern_node, "heading_rad", lawnmower.heading_rad);
+            if (!(lawnmower.lane_spacing_m > 0.0)) {
+                return fail("lawnmower pattern needs a positive lane_spacing_m");
+            }
+            break;
+        }
+        case PatternType::SPIRAL: {
+            SpiralConfig& spiral = pattern_out.spiral;
+            readVector2EnuIfPresent(pattern_node, "center_enu_m", spiral.center_enu_m);
+            readIfPresent(pattern_node, "start_radius_m", spiral.start_radius_m);
+            readIfPresent(pattern_node, "end_radius_m", spiral.end_radius_m);
+            readIfPresent(pattern_node, "radius_step_per_turn_m", spiral.radius_step_per_turn_m);
+            readIfPresent(pattern_node, "points_per_turn", spiral.points_per_turn);
+            readIfPresent(pattern_node, "start_angle_rad", spiral.start_angle_rad);
+            if (!(spiral.radius_step_per_turn_m > 0.0)) {
+                return fail("spiral pattern needs a positive radius_step_per_turn_m");
+            }
+            break;
+        }
+        case PatternType::ORBIT: {
+            OrbitConfig& orbit = pattern_out.orbit;
+            readVector2EnuIfPresent(pattern_node, "center_enu_m", orbit.center_enu_m);
+            readIfPresent(pattern_node, "radius_m", orbit.radius_m);
+            readIfPresent(pattern_node, "turns", orbit.turns);
+            readIfPresent(pattern_node, "points_per_turn", orbit.points_per_turn);
+            readIfPresent(pattern_node, "start_angle_rad", orbit.start_angle_rad);
+            readIfPresent(pattern_node, "clockwise", orbit.clockwise);
+            break;
+        }
+    }
+    return true;
+}
+
 }  // namespace
 
 bool MissionLoader::loadFromFile(const std::string& file_path, Mission& mission_out, std::string* error_out) const {
@@ -164,6 +331,11 @@ bool MissionLoader::loadFromFile(const std::string& file_path, Mission& mission_
         readIfPresent(mission_node, "name", mission.name);
         readIfPresent(mission_node, "description", mission.description);
         readIfPresent(mission_node, "version", mission.version);
+        readIfPresent(mission_node, "airspace_file", mission.airspace_file);
+        if (!mission.airspace_file.empty() && std::filesystem::path(mission.airspace_file).is_relative()) {
+            mission.airspace_file =
+                (std::filesystem::path(file_path).parent_path() / mission.airspace_file).string();
+        }
 
         if (mission_node["metadata"]) {
             const auto metadata = mission_node["metadata"];
@@ -201,6 +373,15 @@ bool MissionLoader::loadFromFile(const std::string& file_path, Mission& mission_
                 }
                 return false;
             }
+            if (step.action->getActionType() == ActionType::GO_TO_POSITION) {
+                const std::string problem = goToPositionProblem(static_cast<const GoToPositionAction&>(*step.action));
+                if (!problem.empty()) {
+                    if (error_out) {
+                        *error_out = "step_id=" + std::to_string(step.step_id) + " has " + problem;
+                    }
+                    return false;
+                }
+            }
 
             std::string advance_mode = "time_based";
             readIfPresent(step_node, "advance_mode", advance_mode);
@@ -226,6 +407,32 @@ bool MissionLoader::loadFromFile(const std::string& file_path, Mission& mission_
             return false;
         }
 
+        std::string program_source;
+        readIfPresent(mission_node, "program", program_source);
+        if (!program_source.empty()) {
+            std::vector<int> step_ids;
+            step_ids.reserve(mission.steps.size());
+            for (const auto& step : mission.steps) {
+                step_ids.push_back(step.step_id);
+            }
+            if (!compileMissionProgram(program_source, step_ids, mission.program, error_out)) {
+                return false;
+            }
+        }
+
+        if (mission_node["triggers"] &&
+            !parseTriggers(mission_node["triggers"], mission.steps, mission.triggers, error_out)) {
+            return false;
+        }
+
+        if (mission_node["pattern"]) {
+            auto pattern = std::make_shared<MissionPatternSpec>();
+            if (!parsePattern(mission_node["pattern"], mission, *pattern, error_out)) {
+                return false;
+            }
+            mission.pattern = std::move(pattern);
+        }
+
         mission_out = std::move(mission);
         return true;
     } catch (const YAML::Exception& ex) {
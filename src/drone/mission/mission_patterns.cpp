@@ -0,0 +1,150 @@
+#include "drone/mission/mission_patterns.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace drone::mission {
+
+WaypointPatternSource::WaypointPatternSource(std::string pattern_name, const PatternLegConfig& leg)
+    : pattern_name_(std::move(pattern_name)), leg_(leg) {}
+
+bool WaypointPatternSource::next(FlatMissionStep& step_out, std::string& name_out) {
+    if (cursor_ >= waypointCount()) {
+        return false;
+    }
+    const Vector3 target = waypoint(cursor_);
+
+    step_out = FlatMissionStep{};
+    step_out.step_id = leg_.first_step_id + static_cast<int>(cursor_);
+    step_out.action_type = static_cast<std::int32_t>(ActionType::GO_TO_POSITION);
+    step_out.advance_mode = static_cast<std::int32_t>(AdvanceMode::COMPLETION_BASED);
+    step_out.timeout_behavior = static_cast<std::int32_t>(leg_.timeout_behavior);
+    step_out.timeout_s = leg_.timeout_s;
+    step_out.action.target_x_m = target.x;
+    step_out.action.target_y_m = target.y;
+    step_out.action.target_altitude_m = leg_.altitude_m;
+    step_out.action.max_velocity_mps = leg_.max_velocity_mps;
+    step_out.action.max_tilt_rad = leg_.max_tilt_rad;
+
+    CompletionCriteria& criteria = step_out.completion_criteria;
+    criteria.condition_type = CompletionConditionType::POSITION_REACHED;
+    criteria.target_position_enu_m = Vector3(target.x, target.y, 0.0);
+    criteria.position_tolerance_m = leg_.position_tolerance_m;
+    criteria.target_altitude_m = leg_.altitude_m;
+    criteria.altitude_tolerance_m = leg_.altitude_tolerance_m;
+    criteria.hold_duration_s = leg_.hold_duration_s;
+    criteria.timeout_s = leg_.timeout_s;
+
+    name_out = pattern_name_;
+    name_out += " #";
+    name_out += std::to_string(cursor_);
+    ++cursor_;
+    return true;
+}
+
+LawnmowerPattern::LawnmowerPattern(const LawnmowerConfig& config, const PatternLegConfig& leg)
+    : WaypointPatternSource("lawnmower", leg),
+      config_(config),
+      cos_heading_(std::cos(config.heading_rad)),
+      sin_heading_(std::sin(config.heading_rad)) {
+    if (config_.lane_spacing_m > 0.0 && config_.width_m >= 0.0) {
+        lane_count_ = static_cast<std::size_t>(std::floor(config_.width_m / config_.lane_spacing_m + 1e-9)) + 1;
+    }
+}
+
+Vector3 LawnmowerPattern::waypoint(std::size_t index) const {
+    const std::size_t lane = index / 2;
+    // even lanes run forward, odd lanes back
+    const bool far_end = ((index % 2) == 1) != ((lane % 2) == 1);
+    const double along_m = far_end ? config_.length_m : 0.0;
+    const double across_m = static_cast<double>(lane) * config_.lane_spacing_m;
+    return Vector3(config_.origin_enu_m.x + along_m * cos_heading_ - across_m * sin_heading_,
+                   config_.origin_enu_m.y + along_m * sin_heading_ + across_m * cos_heading_,
+                   0.0);
+}
+
+SpiralPattern::SpiralPattern(const SpiralConfig& config, const PatternLegConfig& leg)
+    : WaypointPatternSource("spiral", leg), config_(config) {
+    config_.points_per_turn = std::max<std::size_t>(config_.points_per_turn, 3);
+    const double radial_span_m = config_.end_radius_m - config_.start_radius_m;
+    const double turns = config_.radius_step_per_turn_m > 0.0
+                             ? std::abs(radial_span_m) / config_.radius_step_per_turn_m
+                             : 0.0;
+    point_count_ = static_cast<std::size_t>(std::ceil(turns * config_.points_per_turn)) + 1;
+    radius_step_per_point_m_ = point_count_ > 1 ? radial_span_m / static_cast<double>(point_count_ - 1) : 0.0;
+}
+
+Vector3 SpiralPattern::waypoint(std::size_t index) const {
+    const double angle_rad = config_.start_angle_rad +
+                             2.0 * M_PI * static_cast<double>(index) / static_cast<double>(config_.points_per_turn);
+    const double radius_m = config_.start_radius_m + radius_step_per_point_m_ * static_cast<double>(index);
+    return Vector3(config_.center_enu_m.x + radius_m * std::cos(angle_rad),
+                   config_.center_enu_m.y + radius_m * std::sin(angle_rad),
+                   0.0);
+}
+
+OrbitPattern::OrbitPattern(const OrbitConfig& config, const PatternLegConfig& leg)
+    : WaypointPatternSource("orbit", leg), config_(config) {
+    config_.points_per_turn = std::max<std::size_t>(config_.points_per_turn, 3);
+    // +1 closes the last turn back on its start point
+    point_count_ = static_cast<std::size_t>(std::ceil(std::max(0.0, config_.turns) * config_.points_per_turn)) + 1;
+}
+
+Vector3 OrbitPattern::waypoint(std::size_t index) const {
+    const double direction = config_.clockwise ? -1.0 : 1.0;
+    const double angle_rad = config_.start_angle_rad + direction * 2.0 * M_PI * static_cast<double>(index) /
+                                                           static_cast<double>(config_.points_per_turn);
+    return Vector3(config_.center_enu_m.x + config_.radius_m * std::cos(angle_rad),
+                   config_.center_enu_m.y + config_.radius_m * std::sin(angle_rad),
+                   0.0);
+}
+
+std::unique_ptr<WaypointPatternSource> makePatternSource(const MissionPatternSpec& spec) {
+    switch (spec.type) {
+        case PatternType::LAWNMOWER:
+            return std::make_unique<LawnmowerPattern>(spec.lawnmower, spec.leg);
+        case PatternType::SPIRAL:
+            return std::make_unique<SpiralPattern>(spec.spiral, spec.leg);
+        case PatternType::ORBIT:
+            return std::make_unique<OrbitPattern>(spec.orbit, spec.leg);
+    }
+    return nullptr;
+}
+
+std::unique_ptr<MissionStepSource> makeMissionPatternStream(std::shared_ptr<const MissionImage> image,
+                                                            const MissionPatternSpec& spec) {
+    const std::size_t step_count = image ? image->stepCount() : 0;
+    std::size_t split = step_count;
+    if (spec.after_step_id != 0) {
+        for (std::size_t i = 0; i < step_count; ++i) {
+            if (image->step(i).step_id == spec.after_step_id) {
+                split = i + 1;
+                break;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<MissionStepSource>> sources;
+    sources.reserve(3);
+    sources.push_back(std::make_unique<ImageStepSource>(image, 0, split));
+    sources.push_back(makePatternSource(spec));
+    sources.push_back(std::make_unique<ImageStepSource>(std::move(image), split, step_count));
+    return std::make_unique<SequenceStepSource>(std::move(sources));
+}
+
+bool parsePatternType(const std::string& text, PatternType& type_out) {
+    if (text == "lawnmower") {
+        type_out = PatternType::LAWNMOWER;
+    } else if (text == "spiral") {
+        type_out = PatternType::SPIRAL;
+    } else if (text == "orbit") {
+        type_out = PatternType::ORBIT;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace drone::mission
@@ -0,0 +1,485 @@
+#include "drone/mission/mission_program.h"
+
+#include "drone/runtime/real_drone.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <sstream>
+#include <unordered_map>
+
+namespace drone::mission {
+
+namespace {
+
+const std::unordered_map<std::string, MissionSensorField>& sensorFieldNames() {
+    static const std::unordered_map<std::string, MissionSensorField> names{
+        {"altitude_m", MissionSensorField::ALTITUDE_M},
+        {"altitude_agl_m", MissionSensorField::ALTITUDE_AGL_M},
+        {"position_enu_x_m", MissionSensorField::POSITION_ENU_X_M},
+        {"position_enu_y_m", MissionSensorField::POSITION_ENU_Y_M},
+        {"position_enu_z_m", MissionSensorField::POSITION_ENU_Z_M},
+        {"gps_altitude_m", MissionSensorField::GPS_ALTITUDE_M},
+        {"gps_velocity_north_mps", MissionSensorField::GPS_VELOCITY_NORTH_MPS},
+        {"gps_velocity_east_mps", MissionSensorField::GPS_VELOCITY_EAST_MPS},
+        {"gps_velocity_down_mps", MissionSensorField::GPS_VELOCITY_DOWN_MPS},
+        {"battery_voltage_v", MissionSensorField::BATTERY_VOLTAGE_V},
+        {"battery_soc_percent", MissionSensorField::BATTERY_SOC_PERCENT},
+        {"motor_temperature_c", MissionSensorField::MOTOR_TEMPERATURE_C},
+        {"motor_rpm", MissionSensorField::MOTOR_RPM},
+        {"yaw_rad", MissionSensorField::YAW_RAD},
+        {"pitch_rad", MissionSensorField::PITCH_RAD},
+        {"roll_rad", MissionSensorField::ROLL_RAD},
+        {"airspace_breach", MissionSensorField::AIRSPACE_BREACH},
+    };
+    return names;
+}
+
+const std::unordered_map<std::string, MissionCompare>& compareNames() {
+    static const std::unordered_map<std::string, MissionCompare> names{
+        {"<", MissionCompare::LT},
+        {"<=", MissionCompare::LE},
+        {">", MissionCompare::GT},
+        {">=", MissionCompare::GE},
+        {"==", MissionCompare::EQ},
+        {"!=", MissionCompare::NE},
+    };
+    return names;
+}
+
+MissionInstruction makeInstruction(MissionOpcode opcode, std::uint32_t target = 0) {
+    MissionInstruction instruction;
+    instruction.opcode = static_cast<std::uint8_t>(opcode);
+    instruction.target = target;
+    return instruction;
+}
+
+MissionOperand literal(double value) {
+    MissionOperand operand;
+    operand.kind = static_cast<std::uint8_t>(MissionOperandKind::LITERAL);
+    operand.value = value;
+    return operand;
+}
+
+MissionOperand variableOperand(std::size_t slot) {
+    MissionOperand operand;
+    operand.kind = static_cast<std::uint8_t>(MissionOperandKind::VARIABLE);
+    operand.index = static_cast<std::uint8_t>(slot);
+    return operand;
+}
+
+class ProgramCompiler {
+public:
+    ProgramCompiler(const std::vector<int>& step_ids, std::vector<MissionInstruction>& code)
+        : step_ids_(step_ids), code_(code) {}
+
+    bool compile(const std::string& source, std::string& error) {
+        std::istringstream lines(source);
+        std::string line;
+        while (std::getline(lines, line)) {
+            ++line_number_;
+            const auto comment = line.find('#');
+            if (comment != std::string::npos) {
+                line.erase(comment);
+            }
+            std::istringstream words(line);
+            std::vector<std::string> tokens;
+            for (std::string token; words >> token;) {
+                tokens.push_back(token);
+            }
+            if (!tokens.empty() && !compileStatement(tokens)) {
+                error = "program line " + std::to_string(line_number_) + ": " + error_;
+                return false;
+            }
+        }
+        if (!repeat_stack_.empty()) {
+            error = "program: 'repeat' opened on line " + std::to_string(repeat_stack_.back().line) +
+                    " has no 'end'";
+            return false;
+        }
+        for (const auto& fixup : label_fixups_) {
+            const auto label = labels_.find(fixup.label);
+            if (label == labels_.end()) {
+                error = "program line " + std::to_string(fixup.line) + ": unknown label '" + fixup.label + "'";
+                return false;
+            }
+            code_[fixup.instruction].target = label->second;
+        }
+        return true;
+    }
+
+private:
+    struct RepeatBlock {
+        std::size_t counter_slot;
+        std::size_t test_pc;
+        std::size_t line;
+    };
+
+    struct LabelFixup {
+        std::size_t instruction;
+        std::string label;
+        std::size_t line;
+    };
+
+    bool fail(const std::string& message) {
+        error_ = message;
+        return false;
+    }
+
+    std::uint32_t pc() const { return static_cast<std::uint32_t>(code_.size()); }
+
+    bool compileStatement(const std::vector<std::string>& tokens) {
+        const std::string& keyword = tokens[0];
+        if (tokens.size() == 1 && keyword.size() > 1 && keyword.back() == ':') {
+            const std::string label = keyword.substr(0, keyword.size() - 1);
+            if (!labels_.emplace(label, pc()).second) {
+                return fail("duplicate label '" + label + "'");
+            }
+            return true;
+        }
+        if (keyword == "run" && tokens.size() == 2) {
+            return compileRun(tokens[1]);
+        }
+        if ((keyword == "set" || keyword == "add") && tokens.size() == 3) {
+            return compileAssign(keyword == "set" ? MissionOpcode::SET : MissionOpcode::ADD, tokens[1], tokens[2]);
+        }
+        if (keyword == "goto" && tokens.size() == 2) {
+            code_.push_back(makeInstruction(MissionOpcode::JUMP));
+            label_fixups_.push_back({code_.size() - 1, tokens[1], line_number_});
+            return true;
+        }
+        if (keyword == "if" && tokens.size() == 6 && tokens[4] == "goto") {
+            return compileIf(tokens[1], tokens[2], tokens[3], tokens[5]);
+        }
+        if (keyword == "repeat" && tokens.size() == 2) {
+            return compileRepeat(tokens[1]);
+        }
+        if (keyword == "end" && tokens.size() == 1) {
+            return compileEnd();
+        }
+        if (keyword == "done" && tokens.size() == 1) {
+            code_.push_back(makeInstruction(MissionOpcode::DONE));
+            return true;
+        }
+        if (keyword == "abort" && tokens.size() == 1) {
+            code_.push_back(makeInstruction(MissionOpcode::ABORT));
+            return true;
+        }
+        return fail("cannot parse '" + keyword + "' statement");
+    }
+
+    bool compileRun(const std::string& step_id_text) {
+        char* end = nullptr;
+        const long step_id = std::strtol(step_id_text.c_str(), &end, 10);
+        if (end == step_id_text.c_str() || *end != '\0') {
+            return fail("run expects a step_id, got '" + step_id_text + "'");
+        }
+        for (std::size_t i = 0; i < step_ids_.size(); ++i) {
+            if (step_ids_[i] == step_id) {
+                code_.push_back(makeInstruction(MissionOpcode::RUN_STEP, static_cast<std::uint32_t>(i)));
+                return true;
+            }
+        }
+        return fail("run references unknown step_id=" + step_id_text);
+    }
+
+    bool compileAssign(MissionOpcode opcode, const std::string& name, const std::string& value_text) {
+        MissionOperand value;
+        if (!parseOperand(value_text, value)) {
+            return false;
+        }
+        if (!(std::isalpha(static_cast<unsigned char>(name[0])) || name[0] == '_') ||
+            sensorFieldNames().count(name) != 0) {
+            return fail("'" + name + "' is not a valid variable name");
+        }
+        auto variable = variables_.find(name);
+        if (variable == variables_.end()) {
+            if (opcode == MissionOpcode::ADD) {
+                return fail("variable '" + name + "' is used before 'set'");
+            }
+            std::size_t slot = 0;
+            if (!allocateSlot(slot)) {
+                return false;
+            }
+            variable = variables_.emplace(name, slot).first;
+        }
+        MissionInstruction instruction = makeInstruction(opcode, static_cast<std::uint32_t>(variable->second));
+        instruction.rhs = value;
+        code_.push_back(instruction);
+        return true;
+    }
+
+    bool compileIf(const std::string& lhs_text, const std::string& compare_text,
+                   const std::string& rhs_text, const std::string& label) {
+        const auto compare = compareNames().find(compare_text);
+        if (compare == compareNames().end()) {
+            return fail("unknown comparison '" + compare_text + "'");
+        }
+        MissionInstruction instruction = makeInstruction(MissionOpcode::JUMP_IF);
+        instruction.compare = static_cast<std::uint8_t>(compare->second);
+        if (!parseOperand(lhs_text, instruction.lhs) || !parseOperand(rhs_text, instruction.rhs)) {
+            return false;
+        }
+        code_.push_back(instruction);
+        label_fixups_.push_back({code_.size() - 1, label, line_number_});
+        return true;
+    }
+
+    bool compileRepeat(const std::string& count_text) {
+        MissionOperand count;
+        if (!parseOperand(count_text, count)) {
+            return false;
+        }
+        // one hidden counter per nesting depth, shared by sibling blocks
+        const std::size_t depth = repeat_stack_.size();
+        if (depth == repeat_slots_.size()) {
+            std::size_t slot = 0;
+            if (!allocateSlot(slot)) {
+                return false;
+            }
+            repeat_slots_.push_back(slot);
+        }
+        const std::size_t slot = repeat_slots_[depth];
+
+        MissionInstruction reset = makeInstruction(MissionOpcode::SET, static_cast<std::uint32_t>(slot));
+        reset.rhs = literal(0.0);
+        code_.push_back(reset);
+
+        MissionInstruction test = makeInstruction(MissionOpcode::JUMP_IF);
+        test.compare = static_cast<std::uint8_t>(MissionCompare::GE);
+        test.lhs = variableOperand(slot);
+        test.rhs = count;
+        repeat_stack_.push_back({slot, code_.size(), line_number_});
+        code_.push_back(test);  // target patched by 'end'
+        return true;
+    }
+
+    bool compileEnd() {
+        if (repeat_stack_.empty()) {
+            return fail("'end' without 'repeat'");
+        }
+        const RepeatBlock block = repeat_stack_.back();
+        repeat_stack_.pop_back();
+
+        MissionInstruction increment = makeInstruction(MissionOpcode::ADD, static_cast<std::uint32_t>(block.counter_slot));
+        increment.rhs = literal(1.0);
+        code_.push_back(increment);
+        code_.push_back(makeInstruction(MissionOpcode::JUMP, static_cast<std::uint32_t>(block.test_pc)));
+        code_[block.test_pc].target = pc();
+        return true;
+    }
+
+    bool parseOperand(const std::string& text, MissionOperand& operand) {
+        char* end = nullptr;
+        const double value = std::strtod(text.c_str(), &end);
+        if (end != text.c_str() && *end == '\0') {
+            operand = literal(value);
+            return true;
+        }
+        const auto field = sensorFieldNames().find(text);
+        if (field != sensorFieldNames().end()) {
+            operand = MissionOperand{};
+            operand.kind = static_cast<std::uint8_t>(MissionOperandKind::SENSOR_FIELD);
+            operand.index = static_cast<std::uint8_t>(field->second);
+            return true;
+        }
+        const auto variable = variables_.find(text);
+        if (variable != variables_.end()) {
+            operand = variableOperand(variable->second);
+            return true;
+        }
+        return fail("unknown variable or sensor field '" + text + "'");
+    }
+
+    bool allocateSlot(std::size_t& slot) {
+        if (next_slot_ >= kMaxMissionVariables) {
+            return fail("more than " + std::to_string(kMaxMissionVariables) + " variables and repeat levels");
+        }
+        slot = next_slot_++;
+        return true;
+    }
+
+    const std::vector<int>& step_ids_;
+    std::vector<MissionInstruction>& code_;
+    std::unordered_map<std::string, std::size_t> variables_;
+    std::unordered_map<std::string, std::uint32_t> labels_;
+    std::vector<LabelFixup> label_fixups_;
+    std::vector<RepeatBlock> repeat_stack_;
+    std::vector<std::size_t> repeat_slots_;
+    std::size_t next_slot_ = 0;
+    std::size_t line_number_ = 0;
+    std::string error_;
+};
+
+bool validOperand(const MissionOperand& operand) {
+    switch (static_cast<MissionOperandKind>(operand.kind)) {
+        case MissionOperandKind::LITERAL:
+            return true;
+        case MissionOperandKind::VARIABLE:
+            return operand.index < kMaxMissionVariables;
+        case MissionOperandKind::SENSOR_FIELD:
+            return operand.index <= static_cast<std::uint8_t>(MissionSensorField::AIRSPACE_BREACH);
+    }
+    return false;
+}
+
+}  // namespace
+
+bool compileMissionProgram(const std::string& source,
+                           const std::vector<int>& step_ids,
+                           std::vector<MissionInstruction>& code_out,
+                           std::string* error_out) {
+    std::vector<MissionInstruction> code;
+    std::string error;
+    if (!ProgramCompiler(step_ids, code).compile(source, error)) {
+        if (error_out) {
+            *error_out = error;
+        }
+        return false;
+    }
+    code_out = std::move(code);
+    return true;
+}
+
+bool validateMissionProgram(const MissionInstruction* code, std::size_t size, std::size_t step_count) {
+    for (std::size_t i = 0; i < size; ++i) {
+        const MissionInstruction& instruction = code[i];
+        switch (static_cast<MissionOpcode>(instruction.opcode)) {
+            case MissionOpcode::RUN_STEP:
+                if (instruction.target >= step_count) {
+                    return false;
+                }
+                break;
+            case MissionOpcode::SET:
+            case MissionOpcode::ADD:
+                if (instruction.target >= kMaxMissionVariables || !validOperand(instruction.rhs)) {
+                    return false;
+                }
+                break;
+            case MissionOpcode::JUMP_IF:
+                if (instruction.compare > static_cast<std::uint8_t>(MissionCompare::NE) ||
+                    !validOperand(instruction.lhs) || !validOperand(instruction.rhs)) {
+                    return false;
+                }
+                [[fallthrough]];
+            case MissionOpcode::JUMP:
+                if (instruction.target > size) {
+                    return false;
+                }
+                break;
+            case MissionOpcode::DONE:
+            case MissionOpcode::ABORT:
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+bool parseMissionSensorField(const std::string& name, MissionSensorField& field_out) {
+    const auto field = sensorFieldNames().find(name);
+    if (field == sensorFieldNames().end()) {
+        return false;
+    }
+    field_out = field->second;
+    return true;
+}
+
+double readMissionSensorField(const runtime::SensorFrame& sensor_frame, MissionSensorField field) {
+    switch (field) {
+        case MissionSensorField::ALTITUDE_M: return sensor_frame.altitude_m;
+        case MissionSensorField::ALTITUDE_AGL_M: return sensor_frame.altitude_agl_m;
+        case MissionSensorField::POSITION_ENU_X_M: return sensor_frame.position_enu_x_m;
+        case MissionSensorField::POSITION_ENU_Y_M: return sensor_frame.position_enu_y_m;
+        case MissionSensorField::POSITION_ENU_Z_M: return sensor_frame.position_enu_z_m;
+        case MissionSensorField::GPS_ALTITUDE_M: return sensor_frame.gps_altitude_m;
+        case MissionSensorField::GPS_VELOCITY_NORTH_MPS: return sensor_frame.gps_velocity_north_mps;
+        case MissionSensorField::GPS_VELOCITY_EAST_MPS: return sensor_frame.gps_velocity_east_mps;
+        case MissionSensorField::GPS_VELOCITY_DOWN_MPS: return sensor_frame.gps_velocity_down_mps;
+        case MissionSensorField::BATTERY_VOLTAGE_V: return sensor_frame.battery_voltage_v;
+        case MissionSensorField::BATTERY_SOC_PERCENT: return sensor_frame.battery_soc_percent;
+        case MissionSensorField::MOTOR_TEMPERATURE_C: return sensor_frame.motor_temperature_c;
+        case MissionSensorField::MOTOR_RPM: return sensor_frame.motor_rpm;
+        case MissionSensorField::YAW_RAD: return sensor_frame.yaw_rad;
+        case MissionSensorField::PITCH_RAD: return sensor_frame.pitch_rad;
+        case MissionSensorField::ROLL_RAD: return sensor_frame.roll_rad;
+        case MissionSensorField::AIRSPACE_BREACH: return sensor_frame.airspace_breach;
+    }
+    return 0.0;
+}
+
+void MissionVm::reset() {
+    pc_ = 0;
+    variables_.fill(0.0);
+    instructions_executed_ = 0;
+}
+
+MissionVmResult MissionVm::run(const MissionInstruction* code,
+                               std::size_t size,
+                               const runtime::SensorFrame& sensor_frame,
+                               std::size_t budget) {
+    const auto value = [&](const MissionOperand& operand) {
+        switch (static_cast<MissionOperandKind>(operand.kind)) {
+            case MissionOperandKind::VARIABLE:
+                return variables_[operand.index];
+            case MissionOperandKind::SENSOR_FIELD:
+                return readMissionSensorField(sensor_frame, static_cast<MissionSensorField>(operand.index));
+            case MissionOperandKind::LITERAL:
+                break;
+        }
+        return operand.value;
+    };
+
+    MissionVmResult result;
+    for (std::size_t executed = 0; executed < budget; ++executed) {
+        if (pc_ >= size) {
+            result.state = MissionVmState::DONE;
+            return result;
+        }
+        const MissionInstruction& instruction = code[pc_];
+        ++instructions_executed_;
+        switch (static_cast<MissionOpcode>(instruction.opcode)) {
+            case MissionOpcode::RUN_STEP:
+                ++pc_;
+                result.state = MissionVmState::STEP;
+                result.step_index = instruction.target;
+                return result;
+            case MissionOpcode::SET:
+                variables_[instruction.target] = value(instruction.rhs);
+                ++pc_;
+                break;
+            case MissionOpcode::ADD:
+                variables_[instruction.target] += value(instruction.rhs);
+                ++pc_;
+                break;
+            case MissionOpcode::JUMP:
+                pc_ = instruction.target;
+                break;
+            case MissionOpcode::JUMP_IF: {
+                const double lhs = value(instruction.lhs);
+                const double rhs = value(instruction.rhs);
+                bool taken = false;
+                switch (static_cast<MissionCompare>(instruction.compare)) {
+                    case MissionCompare::LT: taken = lhs < rhs; break;
+                    case MissionCompare::LE: taken = lhs <= rhs; break;
+                    case MissionCompare::GT: taken = lhs > rhs; break;
+                    case MissionCompare::GE: taken = lhs >= rhs; break;
+                    case MissionCompare::EQ: taken = lhs == rhs; break;
+                    case MissionCompare::NE: taken = lhs != rhs; break;
+                }
+                pc_ = taken ? instruction.target : pc_ + 1;
+                break;
+            }
+            case MissionOpcode::DONE:
+                result.state = MissionVmState::DONE;
+                return result;
+            case MissionOpcode::ABORT:
+                result.state = MissionVmState::ABORTED;
+                return result;
+        }
+    }
+    result.state = MissionVmState::YIELD;
+    return result;
+}
+
+}  // namespace drone::mission
@@ -0,0 +1,42 @@
+#include "drone/mission/mission_stream.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace drone::mission {
+
+ImageStepSource::ImageStepSource(std::shared_ptr<const MissionImage> image)
+    : image_(std::move(image)), end_(image_ ? image_->stepCount() : 0) {}
+
+ImageStepSource::ImageStepSource(std::shared_ptr<const MissionImage> image, std::size_t first_step, std::size_t end_step)
+    : image_(std::move(image)), cursor_(first_step), end_(image_ ? std::min(end_step, image_->stepCount()) : 0) {}
+
+bool ImageStepSource::next(FlatMissionStep& step_out, std::string& name_out) {
+    if (!image_ || cursor_ >= end_) {
+        return false;
+    }
+    step_out = image_->step(cursor_++);
+    name_out = image_->string(step_out.name_offset);
+    return true;
+}
+
+SequenceStepSource::SequenceStepSource(std::vector<std::unique_ptr<MissionStepSource>> sources)
+    : sources_(std::move(sources)) {}
+
+void SequenceStepSource::append(std::unique_ptr<MissionStepSource> source) {
+    sources_.push_back(std::move(source));
+}
+
+bool SequenceStepSource::next(FlatMissionStep& step_out, std::string& name_out) {
+    while (current_ < sources_.size()) {
+        if (sources_[current_] && sources_[current_]->next(step_out, name_out)) {
+            return true;
+        }
+        // release an exhausted source as soon as the sequence moves past it
+        sources_[current_].reset();
+        ++current_;
+    }
+    return false;
+}
+
+}  // namespace drone::mission
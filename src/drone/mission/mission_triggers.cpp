@@ -0,0 +1,134 @@
+#include "drone/mission/mission_triggers.h"
+
+#include "drone/runtime/real_drone.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace drone::mission {
+
+bool validateMissionTriggers(const FlatMissionTrigger* triggers, std::size_t count, std::size_t step_count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        const FlatMissionTrigger& trigger = triggers[i];
+        if (trigger.field > static_cast<std::uint8_t>(MissionSensorField::AIRSPACE_BREACH) ||
+            trigger.direction > static_cast<std::uint8_t>(MissionTriggerDirection::ABOVE) ||
+            trigger.action > static_cast<std::uint8_t>(MissionTriggerAction::ABORT) ||
+            !(trigger.hysteresis >= 0.0)) {
+            return false;
+        }
+        if (static_cast<MissionTriggerAction>(trigger.action) == MissionTriggerAction::GOTO_STEP &&
+            trigger.step_index >= step_count) {
+            return false;
+        }
+    }
+    return true;
+}
+
+MissionTriggerTable::MissionTriggerTable(const FlatMissionTrigger* triggers, std::size_t count)
+    : triggers_(triggers), trigger_count_(count) {
+    std::vector<std::uint32_t> order(count);
+    std::iota(order.begin(), order.end(), 0u);
+    const auto groupKey = [&](std::uint32_t index) {
+        return std::make_pair(triggers[index].field, triggers[index].direction);
+    };
+    std::stable_sort(order.begin(), order.end(),
+                     [&](std::uint32_t a, std::uint32_t b) { return groupKey(a) < groupKey(b); });
+
+    fire_keys_.reserve(count);
+    fire_triggers_.reserve(count);
+    rearm_keys_.reserve(count);
+    rearm_triggers_.reserve(count);
+    std::size_t group_begin = 0;
+    while (group_begin < count) {
+        std::size_t group_end = group_begin;
+        while (group_end < count && groupKey(order[group_end]) == groupKey(order[group_begin])) {
+            ++group_end;
+        }
+
+        const FlatMissionTrigger& first = triggers[order[group_begin]];
+        Group group;
+        group.field = static_cast<MissionSensorField>(first.field);
+        const bool below = static_cast<MissionTriggerDirection>(first.direction) == MissionTriggerDirection::BELOW;
+        group.sign = below ? 1.0 : -1.0;
+        group.begin = static_cast<std::uint32_t>(group_begin);
+        group.end = static_cast<std::uint32_t>(group_end);
+
+        std::vector<std::uint32_t> members(order.begin() + group_begin, order.begin() + group_end);
+        const auto fireKey = [&](std::uint32_t index) { return group.sign * triggers[index].threshold; };
+        const auto rearmKey = [&](std::uint32_t index) { return fireKey(index) + triggers[index].hysteresis; };
+
+        std::stable_sort(members.begin(), members.end(),
+                         [&](std::uint32_t a, std::uint32_t b) { return fireKey(a) < fireKey(b); });
+        for (const std::uint32_t index : members) {
+            fire_keys_.push_back(fireKey(index));
+            fire_triggers_.push_back(index);
+        }
+        std::stable_sort(members.begin(), members.end(),
+                         [&](std::uint32_t a, std::uint32_t b) { return rearmKey(a) < rearmKey(b); });
+        for (const std::uint32_t index : members) {
+            rearm_keys_.push_back(rearmKey(index));
+            rearm_triggers_.push_back(index);
+        }
+
+        groups_.push_back(group);
+        group_begin = group_end;
+    }
+}
+
+int selectMissionTrigger(const MissionTriggerTable& table, const std::vector<std::uint32_t>& fired) {
+    for (const std::uint32_t index : fired) {
+        if (static_cast<MissionTriggerAction>(table.trigger(index).action) == MissionTriggerAction::ABORT) {
+            return static_cast<int>(index);
+        }
+    }
+    return fired.empty() ? -1 : static_cast<int>(fired.front());
+}
+
+void MissionTriggerMonitor::reset(const MissionTriggerTable& table) {
+    armed_.assign(table.size(), 1);
+    fired_.clear();
+    fired_.reserve(table.size());
+    fire_cursor_.resize(table.groups_.size());
+    rearm_cursor_.resize(table.groups_.size());
+    for (std::size_t g = 0; g < table.groups_.size(); ++g) {
+        fire_cursor_[g] = table.groups_[g].end;  // nothing active yet, so active fields fire on the first tick
+        rearm_cursor_[g] = table.groups_[g].begin;
+    }
+}
+
+const std::vector<std::uint32_t>& MissionTriggerMonitor::update(const MissionTriggerTable& table,
+                                                                const runtime::SensorFrame& sensor_frame) {
+    fired_.clear();
+    for (std::size_t g = 0; g < table.groups_.size(); ++g) {
+        const auto& group = table.groups_[g];
+        const double key = group.sign * readMissionSensorField(sensor_frame, group.field);
+        const double* fire_begin = table.fire_keys_.data() + group.begin;
+        const double* fire_end = table.fire_keys_.data() + group.end;
+        const double* rearm_begin = table.rearm_keys_.data() + group.begin;
+        const double* rearm_end = table.rearm_keys_.data() + group.end;
+
+        // active: fire_key > key, a suffix; only entries that joined it since the last tick can fire
+        const auto fire_cursor =
+            static_cast<std::uint32_t>(std::upper_bound(fire_begin, fire_end, key) - table.fire_keys_.data());
+        for (std::uint32_t e = fire_cursor; e < fire_cursor_[g]; ++e) {
+            const std::uint32_t trigger = table.fire_triggers_[e];
+            if (armed_[trigger]) {
+                armed_[trigger] = 0;
+                fired_.push_back(trigger);
+            }
+        }
+        fire_cursor_[g] = fire_cursor;
+
+        // recovered: rearm_key <= key, a prefix; entries that joined it re-arm
+        const auto rearm_cursor =
+            static_cast<std::uint32_t>(std::upper_bound(rearm_begin, rearm_end, key) - table.rearm_keys_.data());
+        for (std::uint32_t e = rearm_cursor_[g]; e < rearm_cursor; ++e) {
+            armed_[table.rearm_triggers_[e]] = 1;
+        }
+        rearm_cursor_[g] = rearm_cursor;
+    }
+    std::sort(fired_.begin(), fired_.end());
+    return fired_;
+}
+
+}  // namespace drone::mission
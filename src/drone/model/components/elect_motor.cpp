@@ -1,19 +1,54 @@
 #include "drone/model/components/elect_motor.h"
 #include <algorithm>  // For std::clamp
+#include <mutex>
+#include <vector>
 #include "drone/model/utils.h"
 
 namespace drone::model::components {
 
+bool ElecMotorSpecs::operator==(const ElecMotorSpecs& other) const {
+    return max_speed_rpm == other.max_speed_rpm &&
+           nominal_voltage_v == other.nominal_voltage_v &&
+           max_current_a == other.max_current_a &&
+           efficiency == other.efficiency &&
+           thermal_resistance == other.thermal_resistance &&
+           weight_kg == other.weight_kg &&
+           blade_diameter_m == other.blade_diameter_m &&
+           blade_shape_coeff == other.blade_shape_coeff &&
+           thermal_time_constant_s == other.thermal_time_constant_s &&
+           max_ramp_rate_rpm_per_s_ == other.max_ramp_rate_rpm_per_s_;
+}
+
+std::shared_ptr<const ElecMotorSpecs> internElecMotorSpecs(const ElecMotorSpecs& specs) {
+    static std::mutex registry_mutex;
+    static std::vector<std::weak_ptr<const ElecMotorSpecs>> registry;
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (auto it = registry.begin(); it != registry.end();) {
+        if (auto existing = it->lock()) {
+            if (*existing == specs) {
+                return existing;
+            }
+            ++it;
+        } else {
+            it = registry.erase(it);  // drop specs no motor uses anymore
+        }
+    }
+    auto interned = std::make_shared<const ElecMotorSpecs>(specs);
+    registry.push_back(interned);
+    return interned;
+}
+
 ElecMotor::ElecMotor(const std::string& name, const drone::model::sensors::AnalogIOSpec& spec, const ElecMotorSpecs& motor_specs)
+    : ElecMotor(name, spec, internElecMotorSpecs(motor_specs))
+{
+}
+
+ElecMotor::ElecMotor(const std::string& name, const drone::model::sensors::AnalogIOSpec& spec, std::shared_ptr<const ElecMotorSpecs> motor_specs)
     : drone::model::sensors::BaseSensor(name, spec),      // Initialize base class
-      specs_(motor_specs),         // Initialize motor specs
-      speed_rpm_(0.0),             // Initial speed is 0
-      desired_speed_rpm_(0.0),     // Initial desired speed is 0
-      current_a_(0.0),             // Initial current is 0
-      voltage_v_(specs_.nominal_voltage_v),  // Set voltage to nominal
-      temperature_c_(25.0),        // Assume ambient temperature is 25°C
-      losses_w_(0.0),              // Initial losses are 0
-      ambient_temp_c_(25.0),       // Ambient temperature
+      specs_(std::move(motor_specs)),  // Shared motor specs
+      own_state_(),                // Zero speed/current/losses, 25°C motor and ambient
+      state_(&own_state_),         // Not bound to a vehicle yet
       last_update_time_(std::chrono::steady_clock::now()),  // Initialize last update time
       temp_sensor_(name + "_TempSensor",
                    drone::model::sensors::AnalogIOSpec(drone::model::sensors::AnalogIOSpec::IODirection::INPUT,
@@ -22,7 +57,37 @@ ElecMotor::ElecMotor(const std::string& name, const drone::model::sensors::Analo
                    drone::model::sensors::TemperatureSensorRanges(0.0, 50.0),
                    0.0)
 {
-    // No additional initialization needed
+    own_state_.voltage_v = specs_->nominal_voltage_v;  // Set voltage to nominal
+}
+
+ElecMotor::ElecMotor(ElecMotor&& other) noexcept
+    : drone::model::sensors::BaseSensor(std::move(other)),
+      specs_(std::move(other.specs_)),
+      own_state_(other.own_state_),
+      state_(other.state_ == &other.own_state_ ? &own_state_ : other.state_),
+      last_update_time_(other.last_update_time_),
+      temp_sensor_(std::move(other.temp_sensor_))
+{
+}
+
+ElecMotor& ElecMotor::operator=(ElecMotor&& other) noexcept {
+    if (this != &other) {
+        drone::model::sensors::BaseSensor::operator=(std::move(other));
+        specs_ = std::move(other.specs_);
+        own_state_ = other.own_state_;
+        state_ = other.state_ == &other.own_state_ ? &own_state_ : other.state_;
+        last_update_time_ = other.last_update_time_;
+        temp_sensor_ = std::move(other.temp_sensor_);
+    }
+    return *this;
+}
+
+void ElecMotor::bindState(ElecMotorState* state) {
+    ElecMotorState* target = state ? state : &own_state_;
+    if (target != state_) {
+        *target = *state_;
+        state_ = target;
+    }
 }
 
 void ElecMotor::update() {
@@ -32,12 +97,12 @@ void ElecMotor::update() {
 }
 
 void ElecMotor::setDesiredSpeedRPM(double speed_rpm) {
-    desired_speed_rpm_ = std::clamp(speed_rpm, 0.0, specs_.max_speed_rpm);
+    state_->desired_speed_rpm = std::clamp(speed_rpm, 0.0, specs_->max_speed_rpm);
 }
 
 double ElecMotor::calculateBatteryDrain(double time_s) const {
     // Energy = Power * time = (Voltage * Current) * time
-    return voltage_v_ * current_a_ * time_s;
+    return state_->voltage_v * state_->current_a * time_s;
 }
 
 }  // namespace drone::model::components
\ No newline at end of file
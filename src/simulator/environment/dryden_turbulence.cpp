@@ -0,0 +1,178 @@
+#include "simulator/environment/dryden_turbulence.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace drone::simulator::environment {
+
+namespace {
+constexpr double kSqrt3 = 1.7320508075688772;
+constexpr int kQuadratureIntervals = 64;  // Simpson intervals for the process-noise integral
+
+double component(const drone::Vector3& value, std::size_t axis) {
+    return axis == 0 ? value.x : (axis == 1 ? value.y : value.z);
+}
+}  // namespace
+
+void DrydenTurbulence::configure(const drone::Vector3& sigma,
+                                 const drone::Vector3& length_scale_m,
+                                 double airspeed_mps,
+                                 std::uint64_t seed,
+                                 std::size_t block_size) {
+    block_size_ = std::max<std::size_t>(block_size, 1);
+    gaussian_.reseed(seed);
+    noise_.assign(6 * block_size_, 0.0);
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        AxisFilter& filter = axes_[axis];
+        filter = AxisFilter{};
+        filter.second_order = axis != 0;
+        filter.output_gain = component(sigma, axis);
+        const double length_m = component(length_scale_m, axis);
+        filter.white = !(length_m > 0.0 && airspeed_mps > 0.0);
+        filter.tau_s = filter.white ? 0.0 : length_m / airspeed_mps;
+        if (!filter.white) {
+            if (filter.second_order) {
+                // stationary output variance of the unit-noise filter is 1/tau
+                const double scale = std::sqrt(filter.tau_s);
+                filter.c1 = scale / (filter.tau_s * filter.tau_s);
+                filter.c2 = scale * kSqrt3 / filter.tau_s;
+            } else {
+                filter.c1 = 1.0;
+            }
+        }
+        output_[axis].assign(block_size_, 0.0);
+        state_x1_[axis].assign(block_size_, 0.0);
+        state_x2_[axis].assign(block_size_, 0.0);
+    }
+
+    // start from the stationary distribution so statistics hold from t = 0
+    double initial[6];
+    gaussian_.fill(initial, 6);
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        AxisFilter& filter = axes_[axis];
+        if (filter.white) {
+            continue;
+        }
+        if (filter.second_order) {
+            filter.x1 = std::sqrt(filter.tau_s * filter.tau_s * filter.tau_s / 4.0) * initial[2 * axis];
+            filter.x2 = std::sqrt(filter.tau_s / 4.0) * initial[2 * axis + 1];
+        } else {
+            filter.x1 = initial[2 * axis];
+        }
+    }
+
+    cursor_ = 0;
+    filled_ = 0;
+    dt_s_ = 0.0;
+    configured_ = true;
+}
+
+void DrydenTurbulence::discretize(double dt_s) {
+    for (auto& filter : axes_) {
+        if (filter.white) {
+            continue;
+        }
+        const double tau = filter.tau_s;
+        const double decay = std::exp(-dt_s / tau);
+        if (!filter.second_order) {
+            filter.a11 = decay;
+            filter.l11 = std::sqrt(std::max(0.0, 1.0 - decay * decay));
+            continue;
+        }
+
+        // e^{A t} for the double pole at -1/tau
+        filter.a11 = decay * (1.0 + dt_s / tau);
+        filter.a12 = decay * dt_s;
+        filter.a21 = -decay * dt_s / (tau * tau);
+        filter.a22 = decay * (1.0 - dt_s / tau);
+
+        // Qd = int_0^dt e^{As} B B^T e^{A^T s} ds with e^{As} B = e^{-s/tau} [s, 1 - s/tau]
+        double q11 = 0.0, q12 = 0.0, q22 = 0.0;
+        const double h = dt_s / kQuadratureIntervals;
+        for (int n = 0; n <= kQuadratureIntervals; ++n) {
+            const double s = n * h;
+            const double weight = (n == 0 || n == kQuadratureIntervals) ? 1.0 : (n % 2 == 1 ? 4.0 : 2.0);
+            const double e = std::exp(-s / tau);
+            const double b1 = e * s;
+            const double b2 = e * (1.0 - s / tau);
+            q11 += weight * b1 * b1;
+            q12 += weight * b1 * b2;
+            q22 += weight * b2 * b2;
+        }
+        q11 *= h / 3.0;
+        q12 *= h / 3.0;
+        q22 *= h / 3.0;
+
+        filter.l11 = std::sqrt(std::max(0.0, q11));
+        filter.l21 = filter.l11 > 0.0 ? q12 / filter.l11 : 0.0;
+        filter.l22 = std::sqrt(std::max(0.0, q22 - filter.l21 * filter.l21));
+    }
+    dt_s_ = dt_s;
+}
+
+void DrydenTurbulence::refill() {
+    gaussian_.fill(noise_.data(), noise_.size());
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        AxisFilter& filter = axes_[axis];
+        const double* w1 = &noise_[(2 * axis) * block_size_];
+        const double* w2 = &noise_[(2 * axis + 1) * block_size_];
+        double* out = output_[axis].data();
+        double* s1 = state_x1_[axis].data();
+        double* s2 = state_x2_[axis].data();
+
+        if (filter.white) {
+            for (std::size_t n = 0; n < block_size_; ++n) {
+                out[n] = filter.output_gain * w1[n];
+            }
+            continue;
+        }
+
+        double x1 = filter.x1;
+        double x2 = filter.x2;
+        for (std::size_t n = 0; n < block_size_; ++n) {
+            const double next_x1 = filter.a11 * x1 + filter.a12 * x2 + filter.l11 * w1[n];
+            const double next_x2 = filter.a21 * x1 + filter.a22 * x2 + filter.l21 * w1[n] + filter.l22 * w2[n];
+            x1 = next_x1;
+            x2 = next_x2;
+            s1[n] = x1;
+            s2[n] = x2;
+            out[n] = filter.output_gain * (filter.c1 * x1 + filter.c2 * x2);
+        }
+    }
+    cursor_ = 0;
+    filled_ = block_size_;
+}
+
+drone::Vector3 DrydenTurbulence::next(double dt_s) {
+    if (!configured_ || dt_s <= 0.0) {
+        return drone::Vector3();
+    }
+
+    if (dt_s != dt_s_) {
+        // resume from the state after the last consumed sample
+        if (cursor_ > 0 && cursor_ <= filled_) {
+            for (std::size_t axis = 0; axis < 3; ++axis) {
+                axes_[axis].x1 = state_x1_[axis][cursor_ - 1];
+                axes_[axis].x2 = state_x2_[axis][cursor_ - 1];
+            }
+        }
+        discretize(dt_s);
+        filled_ = 0;
+        cursor_ = 0;
+    }
+
+    if (cursor_ >= filled_) {
+        if (filled_ > 0) {
+            for (std::size_t axis = 0; axis < 3; ++axis) {
+                axes_[axis].x1 = state_x1_[axis][filled_ - 1];
+                axes_[axis].x2 = state_x2_[axis][filled_ - 1];
+            }
+        }
+        refill();
+    }
+
+    const std::size_t n = cursor_++;
+    return drone::Vector3(output_[0][n], output_[1][n], output_[2][n]);
+}
+
+}  // namespace drone::simulator::environment
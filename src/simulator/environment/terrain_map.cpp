@@ -0,0 +1,199 @@
+#include "simulator/environment/terrain_map.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace drone::simulator::environment {
+
+namespace {
+
+constexpr char kMagic[8] = {'V', 'D', 'T', 'E', 'R', 'R', '\0', '\0'};
+constexpr std::uint32_t kVersion = 1;
+constexpr const char* kHeaderFileName = "terrain.hdr";
+
+struct TerrainHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t tile_cells;
+    std::uint32_t tiles_x;
+    std::uint32_t tiles_y;
+    double origin_x_m;
+    double origin_y_m;
+    double spacing_m;
+    double default_height_m;
+};
+
+std::string tileFileName(std::uint32_t tile_x, std::uint32_t tile_y) {
+    return "tile_" + std::to_string(tile_x) + "_" + std::to_string(tile_y) + ".dem";
+}
+
+std::uint64_t tileKey(std::uint32_t tile_x, std::uint32_t tile_y) {
+    return (static_cast<std::uint64_t>(tile_y) << 32) | tile_x;
+}
+
+}  // namespace
+
+bool TerrainMap::write(const std::string& terrain_dir, const TerrainGridSpec& spec, const std::vector<float>& heights_m) {
+    if (spec.tile_cells == 0 || spec.tiles_x == 0 || spec.tiles_y == 0 || spec.spacing_m <= 0.0) {
+        return false;
+    }
+    const std::size_t width = static_cast<std::size_t>(spec.tiles_x) * spec.tile_cells + 1;
+    const std::size_t height = static_cast<std::size_t>(spec.tiles_y) * spec.tile_cells + 1;
+    if (heights_m.size() != width * height) {
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(terrain_dir, error);
+    const std::filesystem::path directory(terrain_dir);
+
+    TerrainHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.tile_cells = spec.tile_cells;
+    header.tiles_x = spec.tiles_x;
+    header.tiles_y = spec.tiles_y;
+    header.origin_x_m = spec.origin_x_m;
+    header.origin_y_m = spec.origin_y_m;
+    header.spacing_m = spec.spacing_m;
+    header.default_height_m = spec.default_height_m;
+    {
+        std::ofstream out(directory / kHeaderFileName, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        if (!out) {
+            return false;
+        }
+    }
+
+    const std::size_t tile_samples = static_cast<std::size_t>(spec.tile_cells) + 1;
+    std::vector<float> tile(tile_samples * tile_samples);
+    for (std::uint32_t tile_y = 0; tile_y < spec.tiles_y; ++tile_y) {
+        for (std::uint32_t tile_x = 0; tile_x < spec.tiles_x; ++tile_x) {
+            const std::size_t x0 = static_cast<std::size_t>(tile_x) * spec.tile_cells;
+            const std::size_t y0 = static_cast<std::size_t>(tile_y) * spec.tile_cells;
+            for (std::size_t j = 0; j < tile_samples; ++j) {
+                std::memcpy(&tile[j * tile_samples], &heights_m[(y0 + j) * width + x0], tile_samples * sizeof(float));
+            }
+            std::ofstream out(directory / tileFileName(tile_x, tile_y), std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) {
+                return false;
+            }
+            out.write(reinterpret_cast<const char*>(tile.data()), static_cast<std::streamsize>(tile.size() * sizeof(float)));
+            if (!out) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<TerrainMap> TerrainMap::open(const std::string& terrain_dir, std::size_t cache_tiles) {
+    MappedFile header_file;
+    if (!header_file.open((std::filesystem::path(terrain_dir) / kHeaderFileName).string()) ||
+        header_file.size() < sizeof(TerrainHeader)) {
+        return nullptr;
+    }
+    TerrainHeader header{};
+    std::memcpy(&header, header_file.data(), sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion ||
+        header.tile_cells == 0 || header.tiles_x == 0 || header.tiles_y == 0 || !(header.spacing_m > 0.0)) {
+        return nullptr;
+    }
+
+    std::shared_ptr<TerrainMap> map(new TerrainMap());
+    map->directory_ = terrain_dir;
+    map->spec_.tile_cells = header.tile_cells;
+    map->spec_.tiles_x = header.tiles_x;
+    map->spec_.tiles_y = header.tiles_y;
+    map->spec_.origin_x_m = header.origin_x_m;
+    map->spec_.origin_y_m = header.origin_y_m;
+    map->spec_.spacing_m = header.spacing_m;
+    map->spec_.default_height_m = header.default_height_m;
+    map->inv_spacing_ = 1.0 / header.spacing_m;
+    map->samples_per_row_ = static_cast<std::size_t>(header.tile_cells) + 1;
+    map->slots_.resize(std::max<std::size_t>(cache_tiles, 1));
+    return map;
+}
+
+TerrainMap::TileSlot& TerrainMap::tile(std::uint32_t tile_x, std::uint32_t tile_y) const {
+    const std::uint64_t key = tileKey(tile_x, tile_y);
+    ++use_clock_;
+    const auto found = slot_of_tile_.find(key);
+    if (found != slot_of_tile_.end()) {
+        TileSlot& slot = slots_[found->second];
+        slot.last_use = use_clock_;
+        return slot;
+    }
+
+    // miss: take a free slot or evict the least recently used one
+    std::size_t victim = 0;
+    if (slot_of_tile_.size() < slots_.size()) {
+        victim = slot_of_tile_.size();
+    } else {
+        for (std::size_t i = 1; i < slots_.size(); ++i) {
+            if (slots_[i].last_use < slots_[victim].last_use) {
+                victim = i;
+            }
+        }
+        slot_of_tile_.erase(slots_[victim].key);
+    }
+
+    TileSlot& slot = slots_[victim];
+    slot.key = key;
+    slot.last_use = use_clock_;
+    slot.heights = nullptr;
+    const std::string path = (std::filesystem::path(directory_) / tileFileName(tile_x, tile_y)).string();
+    if (slot.file.open(path) && slot.file.size() == samples_per_row_ * samples_per_row_ * sizeof(float)) {
+        slot.heights = reinterpret_cast<const float*>(slot.file.data());
+    } else {
+        slot.file.close();
+    }
+    slot_of_tile_.emplace(key, victim);
+    ++tile_loads_;
+    return slot;
+}
+
+double TerrainMap::heightAtM(double x_m, double y_m) const {
+    const double gx = (x_m - spec_.origin_x_m) * inv_spacing_;
+    const double gy = (y_m - spec_.origin_y_m) * inv_spacing_;
+    const double max_x = static_cast<double>(spec_.tiles_x) * spec_.tile_cells;
+    const double max_y = static_cast<double>(spec_.tiles_y) * spec_.tile_cells;
+    if (!(gx >= 0.0 && gy >= 0.0 && gx <= max_x && gy <= max_y)) {
+        return spec_.default_height_m;
+    }
+
+    // cell (cx, cy) in global cells; the last row/column belongs to the last tile
+    const auto cx = std::min(static_cast<std::uint32_t>(gx), static_cast<std::uint32_t>(max_x) - 1);
+    const auto cy = std::min(static_cast<std::uint32_t>(gy), static_cast<std::uint32_t>(max_y) - 1);
+    const std::uint32_t tile_x = cx / spec_.tile_cells;
+    const std::uint32_t tile_y = cy / spec_.tile_cells;
+
+    TileSlot* slot = last_slot_;
+    if (slot && slot->key == tileKey(tile_x, tile_y)) {
+        slot->last_use = ++use_clock_;
+    } else {
+        slot = &tile(tile_x, tile_y);
+        last_slot_ = slot;
+    }
+    if (!slot->heights) {
+        return spec_.default_height_m;
+    }
+
+    const std::size_t local_x = cx - tile_x * spec_.tile_cells;
+    const std::size_t local_y = cy - tile_y * spec_.tile_cells;
+    const double fx = gx - static_cast<double>(cx);
+    const double fy = gy - static_cast<double>(cy);
+    const float* row0 = slot->heights + local_y * samples_per_row_ + local_x;
+    const float* row1 = row0 + samples_per_row_;
+    const double h0 = row0[0] + (row0[1] - row0[0]) * fx;
+    const double h1 = row1[0] + (row1[1] - row1[0]) * fx;
+    return h0 + (h1 - h0) * fy;
+}
+
+}  // namespace drone::simulator::environment
@@ -17,6 +17,15 @@ void WeatherModel::setConfig(const drone::simulator::config::WeatherConfig& weat
     turbulence_dist_x_ = std::normal_distribution<double>(0.0, config_.turbulence_std_enu_ms2.x);
     turbulence_dist_y_ = std::normal_distribution<double>(0.0, config_.turbulence_std_enu_ms2.y);
     turbulence_dist_z_ = std::normal_distribution<double>(0.0, config_.turbulence_std_enu_ms2.z);
+    dryden_enabled_ = config_.turbulence_model == "dryden";
+    if (dryden_enabled_) {
+        dryden_.configure(config_.turbulence_std_enu_ms2,
+                          config_.dryden_length_scale_m,
+                          config_.dryden_airspeed_mps,
+                          config_.random_seed,
+                          config_.turbulence_block_size);
+    }
+    last_elapsed_s_ = 0.0;
 }
 
 WeatherSample WeatherModel::sample(double elapsed_s) {
@@ -25,6 +34,13 @@ WeatherSample WeatherModel::sample(double elapsed_s) {
         return sample;
     }
 
+    if (tape_ && tape_->dtS() > 0.0) {
+        const double position = std::round(elapsed_s / tape_->dtS());
+        if (position >= 0.0 && position < static_cast<double>(tape_->size())) {
+            return sampleAt(static_cast<std::size_t>(position));
+        }
+    }
+
     sample.steady_accel_enu_ms2 = config_.steady_accel_enu_ms2;
 
     const double omega = kTwoPi * config_.gust_frequency_hz;
@@ -33,10 +49,16 @@ WeatherSample WeatherModel::sample(double elapsed_s) {
         config_.gust_amplitude_enu_ms2.y * std::sin(omega * elapsed_s + kTwoPi / 3.0),
         config_.gust_amplitude_enu_ms2.z * std::sin(omega * elapsed_s + 2.0 * kTwoPi / 3.0));
 
-    sample.turbulence_accel_enu_ms2 = drone::Vector3(
-        turbulence_dist_x_(rng_),
-        turbulence_dist_y_(rng_),
-        turbulence_dist_z_(rng_));
+    if (dryden_enabled_) {
+        // the filter is discretized for the step actually taken since the previous sample
+        sample.turbulence_accel_enu_ms2 = dryden_.next(elapsed_s - last_elapsed_s_);
+        last_elapsed_s_ = elapsed_s;
+    } else {
+        sample.turbulence_accel_enu_ms2 = drone::Vector3(
+            turbulence_dist_x_(rng_),
+            turbulence_dist_y_(rng_),
+            turbulence_dist_z_(rng_));
+    }
 
     sample.total_accel_enu_ms2 =
         sample.steady_accel_enu_ms2 + sample.gust_accel_enu_ms2 + sample.turbulence_accel_enu_ms2;
@@ -44,4 +66,28 @@ WeatherSample WeatherModel::sample(double elapsed_s) {
     return sample;
 }
 
+WeatherSample WeatherModel::sample(double elapsed_s, const drone::Vector3& position_enu_m) {
+    WeatherSample weather = sample(elapsed_s);
+    if (config_.enabled && wind_sampler_.hasField()) {
+        weather.wind_velocity_enu_mps = wind_sampler_.sample(position_enu_m, elapsed_s);
+    }
+    return weather;
+}
+
+WeatherSample WeatherModel::sampleAt(std::size_t tape_index) const {
+    WeatherSample sample;
+    if (!config_.enabled || !tape_ || tape_index >= tape_->size()) {
+        return sample;
+    }
+
+    const WeatherTapeSample& entry = (*tape_)[tape_index];
+    sample.steady_accel_enu_ms2 = config_.steady_accel_enu_ms2;
+    sample.gust_accel_enu_ms2 = drone::Vector3(entry.gust_enu_ms2[0], entry.gust_enu_ms2[1], entry.gust_enu_ms2[2]);
+    sample.turbulence_accel_enu_ms2 = drone::Vector3(
+        entry.turbulence_enu_ms2[0], entry.turbulence_enu_ms2[1], entry.turbulence_enu_ms2[2]);
+    sample.total_accel_enu_ms2 =
+        sample.steady_accel_enu_ms2 + sample.gust_accel_enu_ms2 + sample.turbulence_accel_enu_ms2;
+    return sample;
+}
+
 }  // namespace drone::simulator::environment
@@ -0,0 +1,205 @@
+#include "simulator/environment/weather_tape.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+#include "simulator/environment/weather_model.h"
+
+namespace drone::simulator::environment {
+
+namespace {
+constexpr char kMagic[8] = {'V', 'D', 'W', 'T', 'A', 'P', 'E', '\0'};
+constexpr std::uint32_t kVersion = 1;
+
+struct TapeHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t sample_size;
+    std::uint64_t key;
+    double dt_s;
+    std::uint64_t sample_count;
+};
+
+// FNV-1a over the raw bytes of each field
+class KeyHasher {
+public:
+    template <typename T>
+    void add(const T& value) {
+        const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            hash_ = (hash_ ^ bytes[i]) * 1099511628211ull;
+        }
+    }
+    void add(const drone::Vector3& value) {
+        add(value.x);
+        add(value.y);
+        add(value.z);
+    }
+    void add(const std::string& value) {
+        for (const char c : value) {
+            add(c);
+        }
+        add(value.size());
+    }
+    std::uint64_t value() const { return hash_; }
+
+private:
+    std::uint64_t hash_ = 1469598103934665603ull;
+};
+
+std::size_t sampleCountFor(double dt_s, double duration_s) {
+    return static_cast<std::size_t>(std::ceil(duration_s / dt_s)) + 1;
+}
+
+long processId() {
+#if !defined(_WIN32)
+    return static_cast<long>(getpid());
+#else
+    return 0L;
+#endif
+}
+}  // namespace
+
+std::uint64_t WeatherTape::computeKey(const drone::simulator::config::WeatherConfig& config,
+                                      double dt_s,
+                                      double duration_s) {
+    KeyHasher hasher;
+    hasher.add(kVersion);
+    hasher.add(config.gust_amplitude_enu_ms2);
+    hasher.add(config.gust_frequency_hz);
+    hasher.add(config.turbulence_std_enu_ms2);
+    hasher.add(config.random_seed);
+    if (config.turbulence_model == "dryden") {
+        hasher.add(config.turbulence_model);
+        hasher.add(config.dryden_length_scale_m);
+        hasher.add(config.dryden_airspeed_mps);
+        hasher.add(config.turbulence_block_size);
+    }
+    hasher.add(dt_s);
+    hasher.add(static_cast<std::uint64_t>(sampleCountFor(dt_s, duration_s)));
+    return hasher.value();
+}
+
+std::string WeatherTape::fileNameForKey(std::uint64_t key) {
+    std::ostringstream name;
+    name << "weather_" << std::hex << std::setw(16) << std::setfill('0') << key << ".tape";
+    return name.str();
+}
+
+bool WeatherTape::generate(const drone::simulator::config::WeatherConfig& config,
+                           double dt_s,
+                           double duration_s,
+                           const std::string& tape_file) {
+    if (dt_s <= 0.0 || duration_s < 0.0) {
+        return false;
+    }
+
+    // Sample the live model so playback matches it exactly
+    drone::simulator::config::WeatherConfig live_config = config;
+    live_config.enabled = true;
+    WeatherModel model;
+    model.setConfig(live_config);
+
+    TapeHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.sample_size = sizeof(WeatherTapeSample);
+    header.key = computeKey(config, dt_s, duration_s);
+    header.dt_s = dt_s;
+    header.sample_count = sampleCountFor(dt_s, duration_s);
+
+    std::ofstream out(tape_file, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (std::uint64_t i = 0; i < header.sample_count; ++i) {
+        const WeatherSample live = model.sample(static_cast<double>(i) * dt_s);
+        const WeatherTapeSample sample{
+            {live.gust_accel_enu_ms2.x, live.gust_accel_enu_ms2.y, live.gust_accel_enu_ms2.z},
+            {live.turbulence_accel_enu_ms2.x, live.turbulence_accel_enu_ms2.y, live.turbulence_accel_enu_ms2.z}};
+        out.write(reinterpret_cast<const char*>(&sample), sizeof(sample));
+    }
+    return static_cast<bool>(out);
+}
+
+std::shared_ptr<const WeatherTape> WeatherTape::open(const std::string& tape_file) {
+    std::shared_ptr<WeatherTape> tape(new WeatherTape());
+    if (!tape->file_.open(tape_file) || tape->file_.size() < sizeof(TapeHeader)) {
+        return nullptr;
+    }
+
+    TapeHeader header{};
+    std::memcpy(&header, tape->file_.data(), sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        header.version != kVersion ||
+        header.sample_size != sizeof(WeatherTapeSample) ||
+        tape->file_.size() < sizeof(TapeHeader) + header.sample_count * sizeof(WeatherTapeSample)) {
+        return nullptr;
+    }
+
+    tape->key_ = header.key;
+    tape->dt_s_ = header.dt_s;
+    tape->sample_count_ = static_cast<std::size_t>(header.sample_count);
+    tape->samples_ = reinterpret_cast<const WeatherTapeSample*>(tape->file_.data() + sizeof(TapeHeader));
+    return tape;
+}
+
+std::shared_ptr<const WeatherTape> WeatherTape::openShared(const std::string& tape_file) {
+    static std::mutex cache_mutex;
+    static std::map<std::string, std::weak_ptr<const WeatherTape>> cache;
+
+    std::error_code error;
+    const std::filesystem::path canonical = std::filesystem::weakly_canonical(tape_file, error);
+    const std::string cache_key = error ? tape_file : canonical.string();
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    if (auto existing = cache[cache_key].lock()) {
+        return existing;
+    }
+    auto tape = open(tape_file);
+    if (tape) {
+        cache[cache_key] = tape;
+    }
+    return tape;
+}
+
+std::shared_ptr<const WeatherTape> WeatherTape::loadOrGenerate(const drone::simulator::config::WeatherConfig& config,
+                                                               double dt_s,
+                                                               double duration_s,
+                                                               const std::string& tape_dir) {
+    const std::uint64_t key = computeKey(config, dt_s, duration_s);
+    const std::filesystem::path tape_path = std::filesystem::path(tape_dir) / fileNameForKey(key);
+
+    if (auto tape = openShared(tape_path.string()); tape && tape->key() == key) {
+        return tape;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(tape_dir, error);
+    // write beside the final name, then rename so concurrent workers never map a partial tape
+    const std::filesystem::path temp_path = tape_path.string() + ".tmp" + std::to_string(processId());
+    if (!generate(config, dt_s, duration_s, temp_path.string())) {
+        std::filesystem::remove(temp_path, error);
+        return nullptr;
+    }
+    std::filesystem::rename(temp_path, tape_path, error);
+    if (error) {
+        std::filesystem::remove(temp_path, error);
+        return nullptr;
+    }
+    return openShared(tape_path.string());
+}
+
+}  // namespace drone::simulator::environment
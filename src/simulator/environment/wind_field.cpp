@@ -0,0 +1,244 @@
+#include "simulator/environment/wind_field.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace drone::simulator::environment {
+
+namespace {
+constexpr char kMagic[8] = {'V', 'D', 'W', 'I', 'N', 'D', '\0', '\0'};
+constexpr std::uint32_t kVersion = 1;
+
+struct WindFieldHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t tile_size;
+    std::uint32_t nx;
+    std::uint32_t ny;
+    std::uint32_t nz;
+    std::uint32_t nt;
+    double origin_enu_m[3];
+    double spacing_m[3];
+    double t0_s;
+    double slice_dt_s;
+};
+
+std::size_t tilesAlong(std::uint32_t nodes, std::uint32_t tile_size) {
+    return (static_cast<std::size_t>(nodes) + tile_size - 1) / tile_size;
+}
+
+bool isPowerOfTwo(std::uint32_t value) {
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+// Node spacing divides every lookup, and the origin offsets it
+bool validGeometry(const drone::Vector3& origin_enu_m, const drone::Vector3& spacing_m) {
+    return std::isfinite(origin_enu_m.x) && std::isfinite(origin_enu_m.y) && std::isfinite(origin_enu_m.z) &&
+           std::isfinite(spacing_m.x) && std::isfinite(spacing_m.y) && std::isfinite(spacing_m.z) &&
+           spacing_m.x > 0.0 && spacing_m.y > 0.0 && spacing_m.z > 0.0;
+}
+
+std::uint32_t log2Exact(std::uint32_t value) {
+    std::uint32_t shift = 0;
+    while ((1u << shift) < value) {
+        ++shift;
+    }
+    return shift;
+}
+
+// Split a coordinate into a cell index (with room for the +1 corner) and fraction
+void locate(double grid_position, std::uint32_t count, std::uint32_t& index, double& fraction) {
+    if (count < 2) {
+        index = 0;
+        fraction = 0.0;
+        return;
+    }
+    const double clamped = std::min(std::max(grid_position, 0.0), static_cast<double>(count - 1));
+    index = std::min(static_cast<std::uint32_t>(clamped), count - 2);
+    fraction = clamped - static_cast<double>(index);
+}
+}  // namespace
+
+bool WindField::write(const std::string& field_file,
+                      const WindGridSpec& spec,
+                      const std::vector<drone::Vector3>& wind_enu_mps,
+                      std::uint32_t tile_size) {
+    const std::size_t node_count = static_cast<std::size_t>(spec.nx) * spec.ny * spec.nz * spec.nt;
+    if (node_count == 0 || wind_enu_mps.size() != node_count || !isPowerOfTwo(tile_size) ||
+        !validGeometry(spec.origin_enu_m, spec.spacing_m)) {
+        return false;
+    }
+
+    WindFieldHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.tile_size = tile_size;
+    header.nx = spec.nx;
+    header.ny = spec.ny;
+    header.nz = spec.nz;
+    header.nt = spec.nt;
+    header.origin_enu_m[0] = spec.origin_enu_m.x;
+    header.origin_enu_m[1] = spec.origin_enu_m.y;
+    header.origin_enu_m[2] = spec.origin_enu_m.z;
+    header.spacing_m[0] = spec.spacing_m.x;
+    header.spacing_m[1] = spec.spacing_m.y;
+    header.spacing_m[2] = spec.spacing_m.z;
+    header.t0_s = spec.t0_s;
+    header.slice_dt_s = spec.slice_dt_s;
+
+    const std::size_t tiles_x = tilesAlong(spec.nx, tile_size);
+    const std::size_t tiles_y = tilesAlong(spec.ny, tile_size);
+    const std::size_t tiles_z = tilesAlong(spec.nz, tile_size);
+    const std::size_t tile_nodes = static_cast<std::size_t>(tile_size) * tile_size * tile_size;
+    std::vector<float> tile_buffer(tile_nodes * 3);
+
+    std::ofstream out(field_file, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (std::uint32_t t = 0; t < spec.nt; ++t) {
+        for (std::size_t tz = 0; tz < tiles_z; ++tz) {
+            for (std::size_t ty = 0; ty < tiles_y; ++ty) {
+                for (std::size_t tx = 0; tx < tiles_x; ++tx) {
+                    std::fill(tile_buffer.begin(), tile_buffer.end(), 0.0f);
+                    for (std::uint32_t lz = 0; lz < tile_size; ++lz) {
+                        for (std::uint32_t ly = 0; ly < tile_size; ++ly) {
+                            for (std::uint32_t lx = 0; lx < tile_size; ++lx) {
+                                const std::size_t i = tx * tile_size + lx;
+                                const std::size_t j = ty * tile_size + ly;
+                                const std::size_t k = tz * tile_size + lz;
+                                if (i >= spec.nx || j >= spec.ny || k >= spec.nz) {
+                                    continue;  // padding
+                                }
+                                const drone::Vector3& value =
+                                    wind_enu_mps[((static_cast<std::size_t>(t) * spec.nz + k) * spec.ny + j) * spec.nx + i];
+                                float* slot = &tile_buffer[((static_cast<std::size_t>(lz) * tile_size + ly) * tile_size + lx) * 3];
+                                slot[0] = static_cast<float>(value.x);
+                                slot[1] = static_cast<float>(value.y);
+                                slot[2] = static_cast<float>(value.z);
+                            }
+                        }
+                    }
+                    out.write(reinterpret_cast<const char*>(tile_buffer.data()),
+                              static_cast<std::streamsize>(tile_buffer.size() * sizeof(float)));
+                }
+            }
+        }
+    }
+    return static_cast<bool>(out);
+}
+
+std::shared_ptr<const WindField> WindField::open(const std::string& field_file) {
+    std::shared_ptr<WindField> field(new WindField());
+    if (!field->file_.open(field_file) || field->file_.size() < sizeof(WindFieldHeader)) {
+        return nullptr;
+    }
+
+    WindFieldHeader header{};
+    std::memcpy(&header, field->file_.data(), sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion ||
+        !isPowerOfTwo(header.tile_size) || header.nx == 0 || header.ny == 0 || header.nz == 0 || header.nt == 0) {
+        return nullptr;
+    }
+
+    field->tile_size_ = header.tile_size;
+    field->tile_shift_ = log2Exact(header.tile_size);
+    field->tile_mask_ = header.tile_size - 1;
+    field->tiles_x_ = tilesAlong(header.nx, header.tile_size);
+    field->tiles_y_ = tilesAlong(header.ny, header.tile_size);
+    field->tile_stride_ = static_cast<std::size_t>(header.tile_size) * header.tile_size * header.tile_size;
+    field->slice_stride_ = field->tiles_x_ * field->tiles_y_ * tilesAlong(header.nz, header.tile_size) * field->tile_stride_;
+
+    const std::size_t payload = field->slice_stride_ * header.nt * 3 * sizeof(float);
+    if (field->file_.size() < sizeof(WindFieldHeader) + payload) {
+        return nullptr;
+    }
+    const drone::Vector3 origin_enu_m(header.origin_enu_m[0], header.origin_enu_m[1], header.origin_enu_m[2]);
+    const drone::Vector3 spacing_m(header.spacing_m[0], header.spacing_m[1], header.spacing_m[2]);
+    if (!validGeometry(origin_enu_m, spacing_m)) {
+        return nullptr;
+    }
+    field->nodes_ = reinterpret_cast<const float*>(field->file_.data() + sizeof(WindFieldHeader));
+
+    field->spec_.nx = header.nx;
+    field->spec_.ny = header.ny;
+    field->spec_.nz = header.nz;
+    field->spec_.nt = header.nt;
+    field->spec_.origin_enu_m = origin_enu_m;
+    field->spec_.spacing_m = spacing_m;
+    field->spec_.t0_s = header.t0_s;
+    field->spec_.slice_dt_s = header.slice_dt_s;
+    return field;
+}
+
+WindFieldSampler::WindFieldSampler(std::shared_ptr<const WindField> field)
+    : field_(std::move(field)) {}
+
+void WindFieldSampler::loadCell(std::uint32_t i, std::uint32_t j, std::uint32_t k, std::uint32_t t) {
+    const WindGridSpec& spec = field_->spec();
+    const std::uint32_t i1 = std::min(i + 1, spec.nx - 1);
+    const std::uint32_t j1 = std::min(j + 1, spec.ny - 1);
+    const std::uint32_t k1 = std::min(k + 1, spec.nz - 1);
+    const std::uint32_t t1 = std::min(t + 1, spec.nt - 1);
+    const std::uint32_t slices[2] = {t, t1};
+
+    for (int s = 0; s < 2; ++s) {
+        for (int corner = 0; corner < 8; ++corner) {
+            const float* value = field_->nodeData(slices[s],
+                                                  (corner & 1) ? i1 : i,
+                                                  (corner & 2) ? j1 : j,
+                                                  (corner & 4) ? k1 : k);
+            corners_[s][corner][0] = value[0];
+            corners_[s][corner][1] = value[1];
+            corners_[s][corner][2] = value[2];
+        }
+    }
+    cached_i_ = i;
+    cached_j_ = j;
+    cached_k_ = k;
+    cached_t_ = t;
+}
+
+drone::Vector3 WindFieldSampler::sample(const drone::Vector3& position_enu_m, double time_s) {
+    if (!field_) {
+        return drone::Vector3();
+    }
+
+    const WindGridSpec& spec = field_->spec();
+    std::uint32_t i = 0, j = 0, k = 0, t = 0;
+    double fx = 0.0, fy = 0.0, fz = 0.0, ft = 0.0;
+    locate((position_enu_m.x - spec.origin_enu_m.x) / spec.spacing_m.x, spec.nx, i, fx);
+    locate((position_enu_m.y - spec.origin_enu_m.y) / spec.spacing_m.y, spec.ny, j, fy);
+    locate((position_enu_m.z - spec.origin_enu_m.z) / spec.spacing_m.z, spec.nz, k, fz);
+    locate(spec.slice_dt_s > 0.0 ? (time_s - spec.t0_s) / spec.slice_dt_s : 0.0, spec.nt, t, ft);
+
+    if (i == cached_i_ && j == cached_j_ && k == cached_k_ && t == cached_t_) {
+        ++cache_hits_;
+    } else {
+        ++cache_misses_;
+        loadCell(i, j, k, t);
+    }
+
+    double result[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        double slice_value[2];
+        for (int s = 0; s < 2; ++s) {
+            const auto& c = corners_[s];
+            const double x00 = c[0][axis] + fx * (c[1][axis] - c[0][axis]);
+            const double x10 = c[2][axis] + fx * (c[3][axis] - c[2][axis]);
+            const double x01 = c[4][axis] + fx * (c[5][axis] - c[4][axis]);
+            const double x11 = c[6][axis] + fx * (c[7][axis] - c[6][axis]);
+            const double y0 = x00 + fy * (x10 - x00);
+            const double y1 = x01 + fy * (x11 - x01);
+            slice_value[s] = y0 + fz * (y1 - y0);
+        }
+        result[axis] = slice_value[0] + ft * (slice_value[1] - slice_value[0]);
+    }
+    return drone::Vector3(result[0], result[1], result[2]);
+}
+
+}  // namespace drone::simulator::environment
@@ -10,13 +10,26 @@
 
 #include "drone/config/altitude_controller_config.h"
 #include "drone/config/attitude_controller_config.h"
+#include "drone/mission/airspace.h"
+#include "drone/mission/mission_image.h"
 #include "drone/model/quadrocopter.h"
+#include "drone/runtime/controller_setup.h"
 #include "drone/runtime/real_drone.h"
+#include "simulator/config/battery_config.h"
+#include "simulator/config/imu_config.h"
+#include "simulator/config/rotor_config.h"
+#include "simulator/config/sensor_noise_config.h"
+#include "simulator/config/terrain_config.h"
 #include "simulator/config/weather_config.h"
+#include "simulator/environment/weather_tape.h"
+#include "simulator/environment/terrain_map.h"
+#include "simulator/environment/wind_field.h"
 #include "simulator/physics/battery_sim.h"
 #include "simulator/physics/gps_sim.h"
 #include "simulator/physics/motor_physics.h"
+#include "simulator/physics/rotor_model.h"
 #include "simulator/quadrosimulator.h"
+#include "simulator/runtime/mission_energy_estimator.h"
 #include "simulator/runtime/noisy_sensor_source.h"
 
 namespace {
@@ -77,6 +90,12 @@ std::filesystem::path resolveLogsDir(const std::string& logs_dir_arg) {
     return cwd_tutorial;
 }
 
+std::string formatMicroseconds(double seconds) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2) << seconds * 1e6;
+    return out.str();
+}
+
 void logEvent(std::ofstream& events_log, double sim_elapsed_s, const std::string& message) {
     if (!events_log.is_open()) {
         return;
@@ -96,7 +115,9 @@ bool parseArgs(
     std::string& attitude_config_file,
     std::string& weather_config_file,
     std::string& mission_file,
-    std::string& logs_dir) {
+    std::string& logs_dir,
+    std::string& battery_config_file,
+    std::string& sensor_noise_config_file) {
     if (argc >= 2) {
         try {
             steps = static_cast<uint64_t>(std::stoull(argv[1]));
@@ -126,6 +147,12 @@ bool parseArgs(
     if (argc >= 8) {
         logs_dir = argv[7];
     }
+    if (argc >= 9) {
+        battery_config_file = argv[8];
+    }
+    if (argc >= 10) {
+        sensor_noise_config_file = argv[9];
+    }
     return true;
 }
 
@@ -139,17 +166,21 @@ int main(int argc, char** argv) {
     std::string weather_config_file = "config/weather.yaml";
     std::string mission_file;
     std::string logs_dir;
+    std::string battery_config_file = "config/battery.yaml";
+    std::string sensor_noise_config_file = "config/sensor_noise.yaml";
     double sim_elapsed_s = 0.0;
 
-    if (!parseArgs(argc, argv, steps, dt_s, altitude_config_file, attitude_config_file, weather_config_file, mission_file, logs_dir)) {
-        std::cerr << "Usage: " << argv[0] << " [steps] [dt_s] [altitude_config_file] [attitude_config_file] [weather_config_file] [mission_file] [logs_dir]" << std::endl;
+    if (!parseArgs(argc, argv, steps, dt_s, altitude_config_file, attitude_config_file, weather_config_file, mission_file, logs_dir, battery_config_file, sensor_noise_config_file)) {
+        std::cerr << "Usage: " << argv[0] << " [steps] [dt_s] [altitude_config_file] [attitude_config_file] [weather_config_file] [mission_file] [logs_dir] [battery_config_file] [sensor_noise_config_file]" << std::endl;
         std::cerr << "  steps: number of simulation steps (default: 10)" << std::endl;
         std::cerr << "  dt_s: time step in seconds (default: 0.01)" << std::endl;
         std::cerr << "  altitude_config_file: YAML config file path (default: config/altitude_controller.yaml)" << std::endl;
         std::cerr << "  attitude_config_file: YAML config file path (default: config/attitude_controller.yaml)" << std::endl;
         std::cerr << "  weather_config_file: YAML config file path (default: config/weather.yaml)" << std::endl;
-        std::cerr << "  mission_file: YAML mission file path (optional)" << std::endl;
+        std::cerr << "  mission_file: YAML mission file or compiled mission image from mission_compile (optional)" << std::endl;
         std::cerr << "  logs_dir: output directory for simulation_telemetry.csv and simulation_events.log (optional, default: docs/tutorials)" << std::endl;
+        std::cerr << "  battery_config_file: YAML cell chemistry and rotor curve config path (default: config/battery.yaml)" << std::endl;
+        std::cerr << "  sensor_noise_config_file: YAML per-channel sensor noise config path (default: config/sensor_noise.yaml)" << std::endl;
         return 1;
     }
 
@@ -171,6 +202,8 @@ int main(int argc, char** argv) {
              " weather_config='" + weather_config_file + "'" +
              " mission_file='" + mission_file + "'" +
              " logs_dir='" + output_logs_dir.string() + "'" +
+             " battery_config='" + battery_config_file + "'" +
+             " sensor_noise_config='" + sensor_noise_config_file + "'" +
              " telemetry_csv='" + telemetry_log_file + "'");
 
     // Load altitude controller configuration
@@ -199,61 +232,47 @@ int main(int argc, char** argv) {
         logEvent(events_log, sim_elapsed_s, "Loaded weather config: '" + weather_config_file + "'");
     }
 
-    // Create default motor specs
-    drone::model::components::ElecMotorSpecs motor_specs(15000.0, 14.8, 20.0, 0.9, 0.4, 0.12);
-    
-    // Create I/O specs for motors
-    drone::model::sensors::AnalogIOSpec motor_io_spec(
-        drone::model::sensors::AnalogIOSpec::IODirection::OUTPUT,
-        drone::model::sensors::AnalogIOSpec::CurrentRange::ZERO_TO_10V,
-        0, 10000
-    );
-
-    // Create battery specs
-    drone::model::components::CellSpecs cell_specs(1500.0, 4.2);
-    drone::model::components::BatterySpecs battery_specs(4, cell_specs, 0.35);
-
-    // Create temperature sensor specs
-    drone::model::sensors::AnalogIOSpec temp_io_spec(
-        drone::model::sensors::AnalogIOSpec::IODirection::INPUT,
-        drone::model::sensors::AnalogIOSpec::CurrentRange::FOUR_TO_20mA,
-        4000, 20000
-    );
-    drone::model::sensors::TemperatureSensorRanges temp_ranges(-50.0, 150.0);
-
-    // Create GPS specs
-    drone::model::components::GPSSensorSpecs gps_specs;
-
-    // Create altitude controller with parameters from config file
-    drone::model::components::AltitudeController alt_ctrl(
-        alt_config.altitude_param_p,
-        alt_config.max_altitude_delta_mps,
-        alt_config.control_param_p,
-        alt_config.control_param_i,
-        alt_config.neutral_rpm,
-        alt_config.control_param_d,
-        alt_config.enable_i_component,
-        alt_config.enable_d_component,
-        alt_config.activation_error_band_m
-    );
-
-    drone::runtime::RealDrone real_drone(alt_ctrl);
-    real_drone.setTargetAltitude(alt_config.target_altitude_m);
-    real_drone.setPositionControlEnabled(alt_config.position_hold_enabled);
-    real_drone.setPositionGain(alt_config.position_hold_kp_pos);
-    real_drone.setVelocityGains(alt_config.position_hold_kp_vel, alt_config.position_hold_kd_vel);
-    real_drone.setMaxVelocity(alt_config.position_hold_max_velocity_mps);
-    real_drone.setMaxTilt(alt_config.position_hold_max_tilt_rad);
-    
-    // Apply attitude controller gains
-    real_drone.setAttitudeGains(
-        att_config.yaw_p_gain_rpm_per_rad,
-        att_config.yaw_d_gain_rpm_per_rad_s,
-        att_config.pitch_p_gain_rpm_per_rad,
-        att_config.pitch_d_gain_rpm_per_rad_s,
-        att_config.roll_p_gain_rpm_per_rad,
-        att_config.roll_d_gain_rpm_per_rad_s
-    );
+    // The terrain section lives in the weather (environment) config file
+    drone::simulator::config::TerrainConfig terrain_config;
+    if (!terrain_config.loadFromFile(weather_config_file)) {
+        terrain_config = drone::simulator::config::TerrainConfig{};
+    }
+
+    drone::simulator::config::BatteryConfig battery_config;
+    if (!battery_config.loadFromFile(battery_config_file)) {
+        logEvent(events_log, sim_elapsed_s,
+                 "WARN battery config load failed: '" + battery_config_file + "' using defaults");
+        battery_config = drone::simulator::config::BatteryConfig{};
+    } else {
+        logEvent(events_log, sim_elapsed_s, "Loaded battery config: '" + battery_config_file + "'");
+    }
+
+    // The rotor section lives in the battery (vehicle hardware) config file
+    drone::simulator::config::RotorConfig rotor_config;
+    if (!rotor_config.loadFromFile(battery_config_file)) {
+        rotor_config = drone::simulator::config::RotorConfig{};
+    }
+
+    drone::simulator::config::SensorNoiseConfig sensor_noise_config;
+    if (!sensor_noise_config.loadFromFile(sensor_noise_config_file)) {
+        logEvent(events_log, sim_elapsed_s,
+                 "WARN sensor noise config load failed: '" + sensor_noise_config_file + "' using defaults");
+        sensor_noise_config = drone::simulator::config::SensorNoiseConfig{};
+    } else {
+        logEvent(events_log, sim_elapsed_s, "Loaded sensor noise config: '" + sensor_noise_config_file + "'");
+    }
+
+    // The IMU section lives in the sensor noise config file
+    drone::simulator::config::ImuConfig imu_config;
+    if (!imu_config.loadFromFile(sensor_noise_config_file)) {
+        logEvent(events_log, sim_elapsed_s,
+                 "WARN imu config load failed: '" + sensor_noise_config_file + "' IMU disabled");
+        imu_config = drone::simulator::config::ImuConfig{};
+    }
+
+    // Altitude controller, position hold and attitude gains from the config files
+    drone::runtime::RealDrone real_drone(drone::runtime::makeAltitudeController(alt_config));
+    drone::runtime::applyControllerConfig(real_drone, alt_config, att_config);
 
     {
         std::ostringstream params;
@@ -273,7 +292,11 @@ int main(int argc, char** argv) {
                << " position_hold_kp_vel=" << alt_config.position_hold_kp_vel
                << " position_hold_kd_vel=" << alt_config.position_hold_kd_vel
                << " position_hold_max_velocity_mps=" << alt_config.position_hold_max_velocity_mps
-               << " position_hold_max_tilt_rad=" << alt_config.position_hold_max_tilt_rad;
+               << " position_hold_max_tilt_rad=" << alt_config.position_hold_max_tilt_rad
+               << " position_hold_roll_gain_rad_per_m=" << alt_config.position_hold_roll_gain_rad_per_m
+               << " position_hold_roll_damping_rad_per_mps=" << alt_config.position_hold_roll_damping_rad_per_mps
+               << " position_hold_roll_velocity_gain_rad_per_mps="
+               << alt_config.position_hold_roll_velocity_gain_rad_per_mps;
         logEvent(events_log, sim_elapsed_s, params.str());
     }
     
@@ -290,23 +313,60 @@ int main(int argc, char** argv) {
     }
 
     // Create simulation using factory
-    auto sim = drone::simulator::QuadroSimulationFactory(
-        "QuadTest",
-        motor_specs,
-        motor_io_spec,
-        battery_specs,
-        temp_io_spec,
-        temp_ranges,
-        0.02,  // temp_sensor_weight_kg
-        gps_specs,
-        1.2,   // body_weight_kg
-        0.3,   // blade_diameter_m
-        1.0,   // blade_shape_coeff
-        steps,
-        dt_s
-    );
+    auto sim = drone::simulator::QuadroSimulationFactory(steps, dt_s);
 
     sim->setWeatherConfig(weather_config);
+    if (!terrain_config.terrain_dir.empty()) {
+        auto terrain_map = drone::simulator::environment::TerrainMap::open(terrain_config.terrain_dir,
+                                                                           terrain_config.cache_tiles);
+        if (terrain_map) {
+            sim->setTerrainMap(terrain_map);
+            logEvent(events_log, sim_elapsed_s, "Loaded terrain: '" + terrain_config.terrain_dir + "'");
+        } else {
+            logEvent(events_log, sim_elapsed_s,
+                     "WARN terrain load failed: '" + terrain_config.terrain_dir + "' using flat ground");
+        }
+    }
+    if (weather_config.enabled && !weather_config.wind_field_file.empty()) {
+        auto wind_field = drone::simulator::environment::WindField::open(weather_config.wind_field_file);
+        if (wind_field) {
+            sim->setWindField(wind_field);
+            logEvent(events_log, sim_elapsed_s, "Loaded wind field: '" + weather_config.wind_field_file + "'");
+        } else {
+            logEvent(events_log, sim_elapsed_s,
+                     "WARN wind field load failed: '" + weather_config.wind_field_file + "' using uniform weather");
+        }
+    }
+    if (weather_config.enabled && !weather_config.tape_dir.empty()) {
+        auto weather_tape = drone::simulator::environment::WeatherTape::loadOrGenerate(
+            weather_config, dt_s, static_cast<double>(steps) * dt_s, weather_config.tape_dir);
+        if (weather_tape) {
+            sim->setWeatherTape(weather_tape);
+            logEvent(events_log, sim_elapsed_s,
+                     "Weather tape: '" + weather_config.tape_dir + "/" +
+                     drone::simulator::environment::WeatherTape::fileNameForKey(weather_tape->key()) + "'");
+        } else {
+            logEvent(events_log, sim_elapsed_s,
+                     "WARN weather tape unavailable in '" + weather_config.tape_dir + "' using live weather");
+        }
+    }
+    sim->setBatteryConfig(battery_config);
+    if (!rotor_config.curve_file.empty()) {
+        drone::simulator::physics::RotorCurveTable curve_table;
+        if (drone::simulator::physics::RotorCurveTable::loadCsv(rotor_config.curve_file, curve_table,
+                                                                rotor_config.curve_rpm_samples)) {
+            sim->setRotorCurveTable(std::move(curve_table));
+            logEvent(events_log, sim_elapsed_s, "Loaded rotor curve: '" + rotor_config.curve_file + "'");
+        } else {
+            logEvent(events_log, sim_elapsed_s,
+                     "WARN rotor curve load failed: '" + rotor_config.curve_file + "' using quadratic thrust law");
+        }
+    }
+    if (imu_config.enabled) {
+        sim->setImuSpecs(imu_config.specs);
+        logEvent(events_log, sim_elapsed_s,
+                 "IMU enabled sample_rate_hz=" + std::to_string(imu_config.specs.sample_rate_hz));
+    }
     if (!sim->setTelemetryLogFile(telemetry_log_file)) {
         logEvent(events_log, sim_elapsed_s, "ERROR failed to open telemetry csv: '" + telemetry_log_file + "'");
         return 1;
@@ -315,25 +375,101 @@ int main(int argc, char** argv) {
 
     if (!mission_file.empty()) {
         std::string mission_error;
+        const bool compiled_mission = drone::mission::MissionImage::isImageFile(mission_file);
+        const auto load_start = std::chrono::steady_clock::now();
         if (!real_drone.loadMissionFromFile(mission_file, &mission_error)) {
             logEvent(events_log, sim_elapsed_s,
                      "ERROR mission load failed: '" + mission_file + "' reason='" + mission_error + "'");
             return 1;
         }
+        const double load_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - load_start).count();
         real_drone.startMission();
+        // a mission with a pattern section runs as a stream, without an image to estimate
+        const bool streamed_mission = !real_drone.getMissionImage();
         logEvent(events_log, sim_elapsed_s, "Loaded mission: '" + mission_file + "'");
+        logEvent(events_log, sim_elapsed_s,
+                 std::string("PHASE_PROFILE phase=mission_load format=") +
+                     (compiled_mission ? "image" : streamed_mission ? "stream" : "yaml") +
+                     " load_us=" + formatMicroseconds(load_time_s));
+        if (streamed_mission) {
+            logEvent(events_log, sim_elapsed_s, "WARN streamed mission: pre-flight estimate skipped");
+        }
+
+        if (const auto& image = real_drone.getMissionImage()) {
+            const auto estimate_start = std::chrono::steady_clock::now();
+            drone::simulator::runtime::MissionEnergyTiming timing;
+            timing.reserve_soc_percent = battery_config.mission_reserve_soc_percent;
+            const drone::simulator::runtime::MissionEnergyEstimator estimator(sim->getMissionEnergyVehicle(), timing);
+            const auto estimate = estimator.estimate(*image);
+            const double estimate_time_s =
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - estimate_start).count();
+            for (const auto& step : estimate.steps) {
+                std::ostringstream line;
+                line << "MISSION_ESTIMATE_STEP step_id=" << step.step_id << " start_s=" << step.start_time_s
+                     << " duration_s=" << step.duration_s << " energy_wh=" << step.energy_wh
+                     << " end_soc_percent=" << step.end_soc_percent << " timed_out=" << (step.timed_out ? 1 : 0);
+                logEvent(events_log, sim_elapsed_s, line.str());
+            }
+            std::ostringstream line;
+            line << "MISSION_ESTIMATE outcome=" << drone::simulator::runtime::missionEnergyOutcomeToString(estimate.outcome)
+                 << " duration_s=" << estimate.duration_s << " energy_wh=" << estimate.energy_wh
+                 << " final_soc_percent=" << estimate.final_soc_percent
+                 << " average_current_a=" << estimate.average_current_a
+                 << " reserve_time_s=" << estimate.reserve_time_s << " estimate_us=" << formatMicroseconds(estimate_time_s);
+            logEvent(events_log, sim_elapsed_s, line.str());
+
+            // an infeasible estimate rejects the mission unless battery.mission_reject_infeasible is
+            // off; running low while landing is flown either way
+            const std::string outcome = drone::simulator::runtime::missionEnergyOutcomeToString(estimate.outcome);
+            if (estimate.outcome == drone::simulator::runtime::MissionEnergyOutcome::INVALID_VEHICLE) {
+                logEvent(events_log, sim_elapsed_s,
+                         std::string("WARN pre-flight estimate skipped: vehicle ") + estimator.vehicleProblem());
+            } else if (estimate.outcome == drone::simulator::runtime::MissionEnergyOutcome::BATTERY_EMPTY &&
+                       estimate.reserve_while_landing) {
+                logEvent(events_log, sim_elapsed_s, "WARN mission estimate reaches the battery reserve while landing");
+            } else if (!estimate.feasible() && battery_config.mission_reject_infeasible) {
+                logEvent(events_log, sim_elapsed_s,
+                         "ERROR mission rejected: '" + mission_file + "' estimate outcome=" + outcome);
+                return 1;
+            } else if (!estimate.feasible()) {
+                logEvent(events_log, sim_elapsed_s, "WARN mission estimate outcome=" + outcome + ", flying it anyway");
+            }
+        }
+
+        if (real_drone.getAirspace()) {
+            const auto& profile = real_drone.getAirspaceLoadProfile();
+            logEvent(events_log, sim_elapsed_s,
+                     "PHASE_PROFILE phase=airspace_mission_check volumes=" + std::to_string(profile.volumes) +
+                         " bvh_nodes=" + std::to_string(profile.nodes) +
+                         " legs=" + std::to_string(profile.legs_checked) +
+                         " nodes_visited=" + std::to_string(profile.stats.nodes_visited) +
+                         " volumes_tested=" + std::to_string(profile.stats.volumes_tested) +
+                         " build_us=" + formatMicroseconds(profile.build_time_s) +
+                         " check_us=" + formatMicroseconds(profile.check_time_s));
+        }
     }
+    drone::mission::AirspaceMonitor airspace_monitor(real_drone.getAirspace());
 
     sim->start();
     logEvent(events_log, sim_elapsed_s, "Simulation runtime started");
 
-    drone::simulator::runtime::NoisySensorSource noisy_sensor_source(*sim);
+    drone::simulator::runtime::NoisySensorSource noisy_sensor_source(*sim, sensor_noise_config);
     drone::mission::MissionStatus last_mission_status = drone::mission::MissionStatus::IDLE;
     int last_mission_step_id = -1;
+    std::uint64_t last_mission_trigger_count = 0;
+    bool airspace_breach = false;
 
     for (uint64_t i = 0; i < steps; ++i) {
         if (real_drone.hasMissionLoaded()) {
-            real_drone.updateMission(sim->readSensors(), dt_s);
+            auto mission_frame = sim->readSensors();
+            mission_frame.airspace_breach = airspace_breach ? 1.0 : 0.0;
+            real_drone.updateMission(mission_frame, dt_s);
+
+            if (real_drone.getFiredMissionTriggerCount() != last_mission_trigger_count) {
+                last_mission_trigger_count = real_drone.getFiredMissionTriggerCount();
+                logEvent(events_log, sim_elapsed_s,
+                         "MISSION_TRIGGER name='" + real_drone.getLastMissionTriggerName() + "'");
+            }
 
             const auto mission_status = real_drone.getMissionStatus();
             const int mission_step_id = real_drone.getCurrentMissionStepId();
@@ -355,10 +491,31 @@ int main(int argc, char** argv) {
             }
         }
 
+        if (imu_config.enabled) {
+            real_drone.drainImu(*sim);
+        }
         real_drone.update(dt_s, noisy_sensor_source, *sim);
         sim->step(dt_s);
         sim_elapsed_s += dt_s;
 
+        if (real_drone.getAirspace()) {
+            const auto truth = sim->readSensors();
+            const auto airspace_result = airspace_monitor.update(
+                drone::Vector3(truth.position_enu_x_m, truth.position_enu_y_m, truth.position_enu_z_m));
+            airspace_breach = airspace_result.hit;
+            if (airspace_result.entered) {
+                const auto& volume = real_drone.getAirspace()->volume(airspace_result.first_hit.volume_index);
+                logEvent(events_log, sim_elapsed_s,
+                         "AIRSPACE_VIOLATION kind=" + drone::mission::airspaceVolumeKindToString(volume.kind) +
+                             " name='" + volume.name + "'" +
+                             " x=" + std::to_string(airspace_result.first_hit.point_enu_m.x) +
+                             " y=" + std::to_string(airspace_result.first_hit.point_enu_m.y) +
+                             " z=" + std::to_string(airspace_result.first_hit.point_enu_m.z));
+            } else if (airspace_result.cleared) {
+                logEvent(events_log, sim_elapsed_s, "AIRSPACE_CLEAR");
+            }
+        }
+
         if (real_drone.hasMissionLoaded()) {
             const auto status = real_drone.getMissionStatus();
             if (status == drone::mission::MissionStatus::COMPLETED ||
@@ -371,6 +528,18 @@ int main(int argc, char** argv) {
         }
     }
     sim->stop();
+    if (real_drone.getAirspace()) {
+        const auto& stats = airspace_monitor.stats();
+        const double queries = static_cast<double>(std::max<std::uint64_t>(stats.queries, 1));
+        std::ostringstream profile;
+        profile << std::fixed << std::setprecision(2)
+                << "PHASE_PROFILE phase=airspace_tick queries=" << stats.queries
+                << " nodes_per_query=" << static_cast<double>(stats.nodes_visited) / queries
+                << " volumes_per_query=" << static_cast<double>(stats.volumes_tested) / queries
+                << " mean_us=" << airspace_monitor.totalQueryTimeS() * 1e6 / queries
+                << " max_us=" << airspace_monitor.maxQueryTimeS() * 1e6;
+        logEvent(events_log, sim_elapsed_s, profile.str());
+    }
     logEvent(events_log, sim_elapsed_s, "SIMULATION_STOP");
     events_log.close();
 
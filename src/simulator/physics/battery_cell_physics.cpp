@@ -1,7 +1,15 @@
 #include "drone/model/components/battery_cell.h"
 #include "simulator/physics/battery_cell_physics.h"
+#include "simulator/physics/cell_ocv_table.h"
+
+#include <algorithm>
 
 namespace drone::simulator::physics {
+
+namespace {
+constexpr CellOcvTable kLiPoOcvTable = CellOcvTable::lipo();
+}  // namespace
+
 /**
  * @brief Calculates the voltage drop based on the state of charge.
  * 
@@ -19,23 +27,27 @@ namespace drone::simulator::physics {
  *       0%        100%
 */
 void BatteryCellPhysics::calculateVoltageDrop(Battery_Cell& cell) {
-    double voltage_v = 3.9;
-    double state_of_charge_percent = cell.getStateOfChargePercent();
-    if (state_of_charge_percent > 85.0) {
-        double deltaV = (4.2 - 3.9);
-        voltage_v = 3.9 + ((state_of_charge_percent - 85.0) / 15.0) * deltaV;   
-    }
-    else if (state_of_charge_percent <= 85.0 && state_of_charge_percent >= 30.0) {
-        double deltaV = (3.9 - 3.5);
-        voltage_v = 3.9 - ((85.0 - state_of_charge_percent) / 55.0) * deltaV;
-    }        
-    else if (state_of_charge_percent < 30.0) {
-        double deltaV = (3.5 - 3.2);
-        voltage_v = 3.5 - ((30.0 - state_of_charge_percent) / 30.0) * deltaV;
-    }
-
     // update cell voltage
-    cell.voltage_v_ = voltage_v;
+    cell.voltage_v_ = openCircuitVoltageV(cell.getStateOfChargePercent());
+}
+
+/**
+ * @brief Open-circuit voltage of the LiPo cell curve.
+ * @param soc_percent The state of charge in percent (clamped to 0..100).
+ * @return The voltage in V.
+ */
+double BatteryCellPhysics::openCircuitVoltageV(double soc_percent) {
+    return kLiPoOcvTable.voltageV(soc_percent);
+}
+
+/**
+ * @brief Exact integral of the LiPo open-circuit voltage between two states of charge.
+ * @param soc_from_percent Start state of charge in percent.
+ * @param soc_to_percent End state of charge in percent.
+ * @return Integral in V * percent (negative when soc_to < soc_from).
+ */
+double BatteryCellPhysics::integrateOpenCircuitVoltage(double soc_from_percent, double soc_to_percent) {
+    return kLiPoOcvTable.integrate(soc_from_percent, soc_to_percent);
 }
 
 /**
@@ -69,20 +81,34 @@ void BatteryCellPhysics::setStateOfChargePercent(Battery_Cell& cell, double soc_
  * @param delta_time_ms Time elapsed since last update in milliseconds.
  */
 void BatteryCellPhysics::update(Battery_Cell& cell, int delta_time_ms) {
-    // depending on current, lower the state of charge, reclaculate voltage and state of charge
+    discharge(cell, delta_time_ms / 1000.0);
+}
 
-    cell.capacity_mah_ -= (cell.getCurrentA() * (delta_time_ms / 3600000.0)) * 1000; // Convert ms to hours, mA
-    if (cell.capacity_mah_ < 0) {
-        cell.capacity_mah_ = 0;
+/**
+ * @brief Discharges the cell at its present (constant) current over one step.
+ *
+ * Capacity falls linearly with charge drawn, clamped at empty, so the end state is
+ * exact regardless of step length. Delivered energy is the OCV integral over the
+ * SOC interval, including any knee crossings inside the step.
+ * @param cell The battery cell object.
+ * @param delta_time_s Step length in seconds.
+ * @return Energy delivered in Wh (negative while charging).
+ */
+double BatteryCellPhysics::discharge(Battery_Cell& cell, double delta_time_s) {
+    if (delta_time_s <= 0.0 || cell.nominal_capacity_mah_ <= 0.0) {
+        return 0.0;
     }
 
-    double soc_percent = 0.0;
-    if (cell.nominal_capacity_mah_ > 0.0) {
-        soc_percent = (cell.capacity_mah_ / cell.nominal_capacity_mah_) * 100.0;
-    }
+    const double soc_from_percent = (cell.capacity_mah_ / cell.nominal_capacity_mah_) * 100.0;
+    const double charge_mah = cell.getCurrentA() * delta_time_s / 3.6;  // A*s -> mAh
+    cell.capacity_mah_ = std::clamp(cell.capacity_mah_ - charge_mah, 0.0, cell.nominal_capacity_mah_);
 
-    cell.state_of_charge_percent_ = soc_percent;
+    const double soc_to_percent = (cell.capacity_mah_ / cell.nominal_capacity_mah_) * 100.0;
+    cell.state_of_charge_percent_ = soc_to_percent;
     calculateVoltageDrop(cell);
+
+    // Wh = Ah_nominal / 100 * integral(V dSOC[%])
+    return -(cell.nominal_capacity_mah_ / 1000.0 / 100.0) * integrateOpenCircuitVoltage(soc_from_percent, soc_to_percent);
 }
 
-} // namespace drone::simulator::physics
\ No newline at end of file
+} // namespace drone::simulator::physics
@@ -1,91 +1,114 @@
 #include "simulator/physics/battery_sim.h"
 
-#include "simulator/physics/battery_cell_physics.h"
+#include <algorithm>
 
 namespace drone::simulator::physics {
 
 BatterySim::BatterySim(const std::string& name, const drone::model::components::BatterySpecs& specs)
     : name_(name), specs_(specs) {
-    cells_.reserve(specs_.cells);
-    for (int i = 0; i < specs_.cells; ++i) {
-        cells_.emplace_back(
-            "Cell_" + std::to_string(i + 1),
-            specs_.cell_specs.capacity_mah,
-            specs_.cell_specs.nominal_voltage_v);
-    }
+    const std::size_t cell_count = static_cast<std::size_t>(std::max(0, specs_.cells)) *
+                                   static_cast<std::size_t>(specs_.parallel_cells);
+    cell_nominal_capacity_mah_.assign(cell_count, specs_.cell_specs.capacity_mah);
+    cell_capacity_mah_.assign(cell_count, specs_.cell_specs.capacity_mah);
+    cell_soc_percent_.assign(cell_count, 100.0);
+    cell_voltage_v_.assign(cell_count, specs_.cell_specs.nominal_voltage_v);
+    cell_prev_soc_percent_.assign(cell_count, 100.0);
+    refreshPackState();
 }
 
 std::string BatterySim::getName() const {
     return name_;
 }
 
-double BatterySim::getVoltageV() const {
-    double total_voltage = 0.0;
-    for (const auto& cell : cells_) {
-        total_voltage += (cell.getCapacityMah() < 0.1 ? 0.0 : cell.getVoltageV()); // If capacity is very low, consider voltage to be 0 to simulate cutoff
-    }
-    return total_voltage;
+double BatterySim::getWeightKg() const {
+    return specs_.weight_kg;
 }
 
-double BatterySim::getCurrentA() const {
-    if (cells_.empty()) {
-        return 0.0;
-    }
-    return cells_.front().getCurrentA();
+void BatterySim::setCurrentA(double current_a) {
+    pack_current_a_ = current_a;
 }
 
-double BatterySim::getStateOfChargePercent() const {
-    if (cells_.empty()) {
-        return 0.0;
+void BatterySim::setStateOfChargePercent(double soc_percent) {
+    soc_percent = std::clamp(soc_percent, 0.0, 100.0);
+    const double voltage_v = ocv_table_.voltageV(soc_percent);
+    for (std::size_t i = 0; i < cell_capacity_mah_.size(); ++i) {
+        cell_capacity_mah_[i] = (soc_percent / 100.0) * cell_nominal_capacity_mah_[i];
+        cell_soc_percent_[i] = soc_percent;
+        cell_voltage_v_[i] = voltage_v;
     }
+    refreshPackState();
+}
 
-    double total_soc = 0.0;
-    for (const auto& cell : cells_) {
-        total_soc += cell.getStateOfChargePercent();
+void BatterySim::setOcvTable(const CellOcvTable& ocv_table) {
+    ocv_table_ = ocv_table;
+    for (std::size_t i = 0; i < cell_capacity_mah_.size(); ++i) {
+        cell_voltage_v_[i] = ocv_table_.voltageV(cell_soc_percent_[i]);
     }
-    return total_soc / cells_.size();
+    refreshPackState();
+}
+
+void BatterySim::update(int delta_time_ms) {
+    advance(delta_time_ms / 1000.0);
 }
 
-double BatterySim::getRemainingCapacityMah() const {
-    if (cells_.empty()) {
-        return 0.0;
+void BatterySim::advance(double delta_time_s) {
+    const std::size_t cell_count = cell_capacity_mah_.size();
+    if (delta_time_s <= 0.0 || cell_count == 0) {
+        return;
     }
 
-    double total_capacity = 0.0;
-    for (const auto& cell : cells_) {
-        total_capacity += cell.getRemainingCapacityMah();
+    // pack current splits evenly across the parallel cells of each series group
+    const double cell_current_a = pack_current_a_ / specs_.parallel_cells;
+    const double charge_mah = cell_current_a * delta_time_s / 3.6;  // A*s -> mAh
+
+    const double* nominal = cell_nominal_capacity_mah_.data();
+    double* capacity = cell_capacity_mah_.data();
+    double* soc = cell_soc_percent_.data();
+    double* prev_soc = cell_prev_soc_percent_.data();
+
+    // branch-free capacity/SOC update over all cells
+    for (std::size_t i = 0; i < cell_count; ++i) {
+        prev_soc[i] = soc[i];
+        const double drained = capacity[i] - charge_mah;
+        capacity[i] = std::min(std::max(drained, 0.0), nominal[i]);
+        soc[i] = nominal[i] > 0.0 ? capacity[i] / nominal[i] * 100.0 : 0.0;
     }
-    return total_capacity / cells_.size();
-}
 
-double BatterySim::getRemainingEnergyWh() const {
-    double total_energy_wh = 0.0;
-    for (const auto& cell : cells_) {
-        total_energy_wh += (cell.getRemainingCapacityMah() / 1000.0) * cell.getVoltageV();
+    double energy_wh = 0.0;
+    for (std::size_t i = 0; i < cell_count; ++i) {
+        cell_voltage_v_[i] = ocv_table_.voltageV(soc[i]);
+        energy_wh -= (nominal[i] / 1000.0 / 100.0) * ocv_table_.integrate(prev_soc[i], soc[i]);
     }
-    return total_energy_wh;
-}
+    consumed_energy_wh_ += energy_wh;
 
-double BatterySim::getWeightKg() const {
-    return specs_.weight_kg;
+    refreshPackState();
 }
 
-void BatterySim::setCurrentA(double current_a) {
-    for (auto& cell : cells_) {
-        BatteryCellPhysics::setCurrentA(cell, current_a);
+void BatterySim::refreshPackState() {
+    const std::size_t cell_count = cell_capacity_mah_.size();
+    if (cell_count == 0) {
+        pack_state_ = PackState{};
+        return;
     }
-}
 
-void BatterySim::setStateOfChargePercent(double soc_percent) {
-    for (auto& cell : cells_) {
-        BatteryCellPhysics::setStateOfChargePercent(cell, soc_percent);
+    double voltage_sum = 0.0;
+    double soc_sum = 0.0;
+    double capacity_sum = 0.0;
+    double energy_wh = 0.0;
+    for (std::size_t i = 0; i < cell_count; ++i) {
+        // a cell without capacity reads 0 V to simulate cutoff
+        voltage_sum += cell_nominal_capacity_mah_[i] < 0.1 ? 0.0 : cell_voltage_v_[i];
+        soc_sum += cell_soc_percent_[i];
+        capacity_sum += cell_capacity_mah_[i];
+        energy_wh += (cell_capacity_mah_[i] / 1000.0) * cell_voltage_v_[i];
     }
-}
 
-void BatterySim::update(int delta_time_ms) {
-    for (auto& cell : cells_) {
-        BatteryCellPhysics::update(cell, delta_time_ms);
-    }
+    const double parallel = static_cast<double>(specs_.parallel_cells);
+    const double series = static_cast<double>(cell_count) / parallel;
+    pack_state_.voltage_v = voltage_sum / parallel;              // series sum of group voltages
+    pack_state_.state_of_charge_percent = soc_sum / cell_count;
+    pack_state_.remaining_capacity_mah = capacity_sum / series;  // capacity of one series string
+    pack_state_.remaining_energy_wh = energy_wh;
 }
 
 } // namespace drone::simulator::physics
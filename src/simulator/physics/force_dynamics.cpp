@@ -23,6 +23,41 @@ drone::Vector3 rotateBodyToEnu(const drone::Vector3& body_vec, const drone::Atti
     return drone::Vector3(x, y, z);
 }
 
+drone::Vector3 rotateEnuToBody(const drone::Vector3& enu_vec, const drone::AttitudeYPR& attitude_ypr) {
+    const double yaw = attitude_ypr.yaw_rad;
+    const double pitch = attitude_ypr.pitch_rad;
+    const double roll = attitude_ypr.roll_rad;
+
+    const double cz = std::cos(yaw);
+    const double sz = std::sin(yaw);
+    const double cy = std::cos(pitch);
+    const double sy = std::sin(pitch);
+    const double cx = std::cos(roll);
+    const double sx = std::sin(roll);
+
+    // transpose of the body-to-ENU matrix
+    const double x = (cz * cy) * enu_vec.x + (sz * cy) * enu_vec.y + (-sy) * enu_vec.z;
+    const double y = (cz * sy * sx - sz * cx) * enu_vec.x + (sz * sy * sx + cz * cx) * enu_vec.y + (cy * sx) * enu_vec.z;
+    const double z = (cz * sy * cx + sz * sx) * enu_vec.x + (sz * sy * cx - cz * sx) * enu_vec.y + (cy * cx) * enu_vec.z;
+
+    return drone::Vector3(x, y, z);
+}
+
+drone::Vector3 eulerRatesToBodyRates(const drone::AttitudeYPR& attitude_ypr,
+                                     double yaw_rate_rps,
+                                     double pitch_rate_rps,
+                                     double roll_rate_rps) {
+    const double cy = std::cos(attitude_ypr.pitch_rad);
+    const double sy = std::sin(attitude_ypr.pitch_rad);
+    const double cx = std::cos(attitude_ypr.roll_rad);
+    const double sx = std::sin(attitude_ypr.roll_rad);
+
+    return drone::Vector3(
+        roll_rate_rps - sy * yaw_rate_rps,
+        cx * pitch_rate_rps + sx * cy * yaw_rate_rps,
+        -sx * pitch_rate_rps + cx * cy * yaw_rate_rps);
+}
+
 drone::Vector3 computeGravityEnu(double mass_kg, double gravity_ms2) {
     return drone::Vector3(0.0, 0.0, -mass_kg * gravity_ms2);
 }
@@ -44,4 +79,17 @@ drone::Vector3 computeNetForceEnu(
     return thrust_enu_n + gravity_enu_n - damping_enu_n;
 }
 
+drone::Vector3 computeNetForceEnu(
+    const drone::Vector3& thrust_body_n,
+    const Matrix3& body_to_enu,
+    double mass_kg,
+    const drone::Vector3& velocity_enu_mps,
+    double damping_n_per_mps,
+    double gravity_ms2) {
+    const drone::Vector3 thrust_enu_n = body_to_enu * thrust_body_n;
+    const drone::Vector3 gravity_enu_n = computeGravityEnu(mass_kg, gravity_ms2);
+    const drone::Vector3 damping_enu_n = computeLinearDampingEnu(velocity_enu_mps, damping_n_per_mps);
+    return thrust_enu_n + gravity_enu_n - damping_enu_n;
+}
+
 }  // namespace drone::simulator::physics
@@ -0,0 +1,117 @@
+#include "simulator/physics/imu_sim.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace drone::simulator::physics {
+
+namespace {
+
+// Noise row layout: white noise for accel xyz, gyro xyz, then bias-walk increments in the same order
+
+std::vector<double> noiseSigmas(const ImuSpecs& specs) {
+    const double sample_period_s = specs.sample_rate_hz > 0.0 ? 1.0 / specs.sample_rate_hz : 0.0;
+    const double walk_scale = std::sqrt(sample_period_s);
+    const double accel_walk = specs.accel_bias_walk_ms2_per_sqrt_s * walk_scale;
+    const double gyro_walk = specs.gyro_bias_walk_rps_per_sqrt_s * walk_scale;
+    return {
+        specs.accel_noise_std_ms2, specs.accel_noise_std_ms2, specs.accel_noise_std_ms2,
+        specs.gyro_noise_std_rps, specs.gyro_noise_std_rps, specs.gyro_noise_std_rps,
+        accel_walk, accel_walk, accel_walk,
+        gyro_walk, gyro_walk, gyro_walk,
+    };
+}
+
+double digitize(double value, double lsb, double range) {
+    if (lsb > 0.0) {
+        value = std::round(value / lsb) * lsb;
+    }
+    return std::clamp(value, -range, range);
+}
+
+drone::Vector3 lerp(const drone::Vector3& a, const drone::Vector3& b, double fraction) {
+    return a + (b - a) * fraction;
+}
+
+}  // namespace
+
+ImuSim::ImuSim(const ImuSpecs& specs)
+    : noise_(noiseSigmas(specs), specs.random_seed) {
+    setSpecs(specs);
+}
+
+void ImuSim::setSpecs(const ImuSpecs& specs) {
+    specs_ = specs;
+    specs_.fifo_capacity = std::max<std::size_t>(specs_.fifo_capacity, 1);
+    noise_ = drone::simulator::random::NoiseBlock(noiseSigmas(specs_), specs_.random_seed);
+    accel_bias_ms2_ = specs_.accel_bias_ms2;
+    gyro_bias_rps_ = specs_.gyro_bias_rps;
+    time_s_ = 0.0;
+    next_sample_index_ = 1;
+    fifo_.assign(specs_.fifo_capacity, drone::runtime::ImuSample{});
+    fifo_head_ = 0;
+    fifo_count_ = 0;
+    overflow_count_ = 0;
+}
+
+void ImuSim::advance(double dt_s, const ImuTruth& step_start, const ImuTruth& step_end) {
+    if (dt_s <= 0.0 || specs_.sample_rate_hz <= 0.0) {
+        return;
+    }
+
+    const double step_start_s = time_s_;
+    time_s_ += dt_s;
+    const double sample_period_s = 1.0 / specs_.sample_rate_hz;
+
+    // sample k is taken at k / rate; indexing avoids accumulating timestamp drift
+    while (static_cast<double>(next_sample_index_) * sample_period_s <= time_s_ + 1e-12) {
+        const double sample_time_s = static_cast<double>(next_sample_index_) * sample_period_s;
+        ++next_sample_index_;
+        const double fraction = std::clamp((sample_time_s - step_start_s) / dt_s, 0.0, 1.0);
+        const double* noise = noise_.next();
+
+        accel_bias_ms2_ += drone::Vector3(noise[6], noise[7], noise[8]);
+        gyro_bias_rps_ += drone::Vector3(noise[9], noise[10], noise[11]);
+
+        const drone::Vector3 accel = lerp(step_start.specific_force_body_ms2, step_end.specific_force_body_ms2, fraction) +
+                                     accel_bias_ms2_ + drone::Vector3(noise[0], noise[1], noise[2]);
+        const drone::Vector3 gyro = lerp(step_start.angular_rate_body_rps, step_end.angular_rate_body_rps, fraction) +
+                                    gyro_bias_rps_ + drone::Vector3(noise[3], noise[4], noise[5]);
+
+        drone::runtime::ImuSample sample;
+        sample.timestamp_s = sample_time_s;
+        sample.specific_force_body_ms2 = drone::Vector3(
+            digitize(accel.x, specs_.accel_lsb_ms2, specs_.accel_range_ms2),
+            digitize(accel.y, specs_.accel_lsb_ms2, specs_.accel_range_ms2),
+            digitize(accel.z, specs_.accel_lsb_ms2, specs_.accel_range_ms2));
+        sample.angular_rate_body_rps = drone::Vector3(
+            digitize(gyro.x, specs_.gyro_lsb_rps, specs_.gyro_range_rps),
+            digitize(gyro.y, specs_.gyro_lsb_rps, specs_.gyro_range_rps),
+            digitize(gyro.z, specs_.gyro_lsb_rps, specs_.gyro_range_rps));
+        push(sample);
+    }
+}
+
+void ImuSim::push(const drone::runtime::ImuSample& sample) {
+    const std::size_t capacity = fifo_.size();
+    if (fifo_count_ == capacity) {
+        fifo_head_ = (fifo_head_ + 1) % capacity;
+        --fifo_count_;
+        ++overflow_count_;
+    }
+    fifo_[(fifo_head_ + fifo_count_) % capacity] = sample;
+    ++fifo_count_;
+}
+
+std::size_t ImuSim::read(drone::runtime::ImuSample* out, std::size_t capacity) {
+    const std::size_t count = std::min(capacity, fifo_count_);
+    const std::size_t fifo_capacity = fifo_.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = fifo_[(fifo_head_ + i) % fifo_capacity];
+    }
+    fifo_head_ = (fifo_head_ + count) % fifo_capacity;
+    fifo_count_ -= count;
+    return count;
+}
+
+}  // namespace drone::simulator::physics
@@ -1,5 +1,6 @@
 #include "simulator/physics/motor_physics.h"
 #include <algorithm>  // For std::clamp
+#include <cmath>
 #include "drone/model/utils.h"
 
 namespace drone::simulator::physics {
@@ -70,14 +71,20 @@ void MotorPhysics::calculateLosses(drone::model::components::ElecMotor& motor) {
 }
 
 void MotorPhysics::updateTemperature(drone::model::components::ElecMotor& motor, uint64_t delta_ms) {
-    // Simple time-based temperature calculation: integrate temperature change over time
-    // dT/dt = (losses * thermal_resistance - (T - ambient)) / thermal_time_constant
-    // For simplicity, assume thermal_time_constant = 10.0 s, and delta_time = 1.0 s per update
-    // Approximation: T_new = T + (target_T - T) * (delta_time / tau)
-    double target_temp = motor.getAmbientTempC() + motor.getLossesW() * motor.getSpecs().thermal_resistance;
-    double tau = 10.0;  // Thermal time constant in seconds (can be added to specs if needed)
-    double delta_s = delta_ms / 1000.0;       // Convert to seconds for calculation
-    double new_temp = motor.getTemperatureC() + (target_temp - motor.getTemperatureC()) * (delta_s / tau);
+    MotorPhysics::advanceTemperature(motor, delta_ms / 1000.0);
+}
+
+void MotorPhysics::advanceTemperature(drone::model::components::ElecMotor& motor, double delta_s) {
+    // First-order thermal model: dT/dt = (target_T - T) / tau, target_T = ambient + losses * R_th
+    // With losses constant over the step the solution is exact for any step length:
+    //   T_new = target_T + (T - target_T) * exp(-delta_t / tau)
+    // so slow thermal updates can run at a lower rate than the control loop without overshoot.
+    const double target_temp = motor.getAmbientTempC() + motor.getLossesW() * motor.getSpecs().thermal_resistance;
+    const double tau = motor.getSpecs().thermal_time_constant_s;
+    double new_temp = target_temp;
+    if (tau > 0.0) {
+        new_temp = target_temp + (motor.getTemperatureC() - target_temp) * std::exp(-std::max(0.0, delta_s) / tau);
+    }
     motor.setTemperatureC(new_temp);
 
     // Update internal temperature sensor reading
@@ -98,26 +105,42 @@ double MotorPhysics::calculateBatteryDrain(const drone::model::components::ElecM
     return motor.getVoltageV() * motor.getCurrentA() * time_s;
 }
 
-void MotorPhysics::updateMotorPhysics(
-        drone::model::components::ElecMotor& motor, 
-        uint64_t delta_ms, 
+void MotorPhysics::updateElectricalState(
+        drone::model::components::ElecMotor& motor,
+        uint64_t delta_ms,
         double currentBattVoltageV) {
 
     MotorPhysics::updateSpeed(motor, delta_ms, currentBattVoltageV);
     MotorPhysics::calculateCurrent(motor);
     MotorPhysics::calculateLosses(motor);
-    MotorPhysics::updateTemperature(motor, delta_ms);    
 }
 
-void MotorPhysics::updateMotorPhysics(
-        drone::model::components::ElecMotor& motor, 
-        uint64_t delta_ms, 
+void MotorPhysics::updateElectricalState(
+        drone::model::components::ElecMotor& motor,
+        uint64_t delta_ms,
         drone::model::components::Battery_base* battery) {
 
     const double available_voltage = isBatteryDepleted(battery) ? 0.0 : battery->getVoltageV();
     MotorPhysics::updateSpeed(motor, delta_ms, available_voltage);
     MotorPhysics::calculateCurrent(motor, battery);
     MotorPhysics::calculateLosses(motor);
+}
+
+void MotorPhysics::updateMotorPhysics(
+        drone::model::components::ElecMotor& motor, 
+        uint64_t delta_ms, 
+        double currentBattVoltageV) {
+
+    MotorPhysics::updateElectricalState(motor, delta_ms, currentBattVoltageV);
+    MotorPhysics::updateTemperature(motor, delta_ms);    
+}
+
+void MotorPhysics::updateMotorPhysics(
+        drone::model::components::ElecMotor& motor, 
+        uint64_t delta_ms, 
+        drone::model::components::Battery_base* battery) {
+
+    MotorPhysics::updateElectricalState(motor, delta_ms, battery);
     MotorPhysics::updateTemperature(motor, delta_ms);
 }
 
@@ -0,0 +1,165 @@
+#include "simulator/physics/rigid_body.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace drone::simulator::physics {
+
+namespace {
+
+drone::Vector3 cross(const drone::Vector3& a, const drone::Vector3& b) {
+    return drone::Vector3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+
+Quaternion normalized(const Quaternion& q) {
+    const double norm_sq = q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z;
+    if (norm_sq <= 0.0) {
+        return Quaternion{};
+    }
+    const double inv_norm = 1.0 / std::sqrt(norm_sq);
+    return Quaternion{q.w * inv_norm, q.x * inv_norm, q.y * inv_norm, q.z * inv_norm};
+}
+
+}  // namespace
+
+Quaternion Quaternion::fromAttitude(const drone::AttitudeYPR& attitude_ypr) {
+    const double cz = std::cos(attitude_ypr.yaw_rad * 0.5);
+    const double sz = std::sin(attitude_ypr.yaw_rad * 0.5);
+    const double cy = std::cos(attitude_ypr.pitch_rad * 0.5);
+    const double sy = std::sin(attitude_ypr.pitch_rad * 0.5);
+    const double cx = std::cos(attitude_ypr.roll_rad * 0.5);
+    const double sx = std::sin(attitude_ypr.roll_rad * 0.5);
+    return Quaternion{cz * cy * cx + sz * sy * sx,
+                      cz * cy * sx - sz * sy * cx,
+                      cz * sy * cx + sz * cy * sx,
+                      sz * cy * cx - cz * sy * sx};
+}
+
+Matrix3 Matrix3::diagonal(const drone::Vector3& d) {
+    Matrix3 out;
+    out.m = {d.x, 0.0, 0.0, 0.0, d.y, 0.0, 0.0, 0.0, d.z};
+    return out;
+}
+
+Matrix3 Matrix3::fromQuaternion(const Quaternion& q) {
+    const double xx = q.x * q.x;
+    const double yy = q.y * q.y;
+    const double zz = q.z * q.z;
+    const double xy = q.x * q.y;
+    const double xz = q.x * q.z;
+    const double yz = q.y * q.z;
+    const double wx = q.w * q.x;
+    const double wy = q.w * q.y;
+    const double wz = q.w * q.z;
+
+    Matrix3 out;
+    out.m = {1.0 - 2.0 * (yy + zz), 2.0 * (xy - wz), 2.0 * (xz + wy),
+             2.0 * (xy + wz), 1.0 - 2.0 * (xx + zz), 2.0 * (yz - wx),
+             2.0 * (xz - wy), 2.0 * (yz + wx), 1.0 - 2.0 * (xx + yy)};
+    return out;
+}
+
+Matrix3 Matrix3::fromAttitude(const drone::AttitudeYPR& attitude_ypr) {
+    const double cz = std::cos(attitude_ypr.yaw_rad);
+    const double sz = std::sin(attitude_ypr.yaw_rad);
+    const double cy = std::cos(attitude_ypr.pitch_rad);
+    const double sy = std::sin(attitude_ypr.pitch_rad);
+    const double cx = std::cos(attitude_ypr.roll_rad);
+    const double sx = std::sin(attitude_ypr.roll_rad);
+
+    Matrix3 out;
+    out.m = {cz * cy, cz * sy * sx - sz * cx, cz * sy * cx + sz * sx,
+             sz * cy, sz * sy * sx + cz * cx, sz * sy * cx - cz * sx,
+             -sy, cy * sx, cy * cx};
+    return out;
+}
+
+bool Matrix3::inverse(Matrix3& out) const {
+    const auto& a = m;
+    const double c00 = a[4] * a[8] - a[5] * a[7];
+    const double c01 = a[5] * a[6] - a[3] * a[8];
+    const double c02 = a[3] * a[7] - a[4] * a[6];
+    const double det = a[0] * c00 + a[1] * c01 + a[2] * c02;
+    if (std::abs(det) < 1e-15) {
+        return false;
+    }
+    const double inv_det = 1.0 / det;
+    out.m = {c00 * inv_det, (a[2] * a[7] - a[1] * a[8]) * inv_det, (a[1] * a[5] - a[2] * a[4]) * inv_det,
+             c01 * inv_det, (a[0] * a[8] - a[2] * a[6]) * inv_det, (a[2] * a[3] - a[0] * a[5]) * inv_det,
+             c02 * inv_det, (a[1] * a[6] - a[0] * a[7]) * inv_det, (a[0] * a[4] - a[1] * a[3]) * inv_det};
+    return true;
+}
+
+drone::AttitudeYPR Matrix3::toAttitude() const {
+    return drone::AttitudeYPR(std::atan2(m[3], m[0]),
+                              std::asin(std::clamp(-m[6], -1.0, 1.0)),
+                              std::atan2(m[7], m[8]));
+}
+
+RigidBody::RigidBody(const RigidBodyParams& params) {
+    setParams(params);
+}
+
+void RigidBody::setParams(const RigidBodyParams& params) {
+    params_ = params;
+    if (!params_.inertia_kgm2.inverse(inertia_inverse_)) {
+        params_.inertia_kgm2 = RigidBodyParams{}.inertia_kgm2;
+        params_.inertia_kgm2.inverse(inertia_inverse_);
+    }
+}
+
+void RigidBody::setAttitude(const Quaternion& attitude) {
+    attitude_ = normalized(attitude);
+    body_to_enu_ = Matrix3::fromQuaternion(attitude_);
+}
+
+void RigidBody::step(double dt_s, double mass_kg, const drone::Vector3& force_enu_n, const drone::Vector3& torque_body_nm) {
+    if (dt_s <= 0.0 || mass_kg <= 0.0) {
+        return;
+    }
+
+    // Translation, semi-implicit Euler
+    velocity_enu_mps_ += force_enu_n * (dt_s / mass_kg);
+    position_enu_m_ += velocity_enu_mps_ * dt_s;
+
+    // Euler's equation: I w' = tau - w x (I w)
+    const drone::Vector3& w = angular_rate_body_rps_;
+    const drone::Vector3 gyroscopic = cross(w, params_.inertia_kgm2 * w);
+    angular_rate_body_rps_ += inertia_inverse_ * (torque_body_nm - gyroscopic) * dt_s;
+
+    // q <- q * dq(w dt); cos/sin of the half angle replaced by their Taylor series
+    const drone::Vector3 theta = angular_rate_body_rps_ * dt_s;
+    const double theta_sq = theta.x * theta.x + theta.y * theta.y + theta.z * theta.z;
+    const double dq_w = 1.0 - theta_sq / 8.0 + theta_sq * theta_sq / 384.0;
+    const double dq_s = 0.5 - theta_sq / 48.0;
+    const double dx = theta.x * dq_s;
+    const double dy = theta.y * dq_s;
+    const double dz = theta.z * dq_s;
+    const Quaternion& q = attitude_;
+    attitude_ = normalized(Quaternion{q.w * dq_w - q.x * dx - q.y * dy - q.z * dz,
+                                      q.w * dx + q.x * dq_w + q.y * dz - q.z * dy,
+                                      q.w * dy - q.x * dz + q.y * dq_w + q.z * dx,
+                                      q.w * dz + q.x * dy - q.y * dx + q.z * dq_w});
+    body_to_enu_ = Matrix3::fromQuaternion(attitude_);
+}
+
+drone::Vector3 RigidBody::quadXTorqueBodyNm(const std::vector<double>& thrust_n,
+                                            const std::vector<double>& torque_nm) const {
+    // rotor positions at 45 degrees: FL (+a, +a), FR (+a, -a), RR (-a, -a), RL (-a, +a)
+    constexpr double kInvSqrt2 = 0.7071067811865476;
+    constexpr std::array<double, 4> kX{1.0, 1.0, -1.0, -1.0};
+    constexpr std::array<double, 4> kY{1.0, -1.0, -1.0, 1.0};
+    constexpr std::array<double, 4> kSpin{1.0, -1.0, 1.0, -1.0};
+    const double a = params_.arm_length_m * kInvSqrt2;
+
+    drone::Vector3 torque;
+    const std::size_t count = std::min<std::size_t>({thrust_n.size(), torque_nm.size(), kX.size()});
+    for (std::size_t i = 0; i < count; ++i) {
+        torque.x += a * kY[i] * thrust_n[i];
+        torque.y -= a * kX[i] * thrust_n[i];
+        torque.z += kSpin[i] * torque_nm[i];
+    }
+    return torque;
+}
+
+}  // namespace drone::simulator::physics
@@ -0,0 +1,205 @@
+#include "simulator/physics/rotor_model.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <utility>
+
+namespace drone::simulator::physics {
+
+namespace {
+constexpr double kRpmToRadPerSec = 2.0 * M_PI / 60.0;
+
+struct CurvePoint {
+    double rpm;
+    double thrust_n;
+    double torque_nm;
+};
+
+std::vector<std::string> splitCsvLine(const std::string& line) {
+    std::vector<std::string> fields;
+    std::stringstream stream(line);
+    std::string field;
+    while (std::getline(stream, field, ',')) {
+        field.erase(0, field.find_first_not_of(" \t\r"));
+        field.erase(field.find_last_not_of(" \t\r") + 1);
+        fields.push_back(field);
+    }
+    return fields;
+}
+
+// Piecewise-linear lookup in points sorted by rpm, clamped at both ends
+CurvePoint interpolateCurve(const std::vector<CurvePoint>& points, double rpm) {
+    if (rpm <= points.front().rpm) {
+        return points.front();
+    }
+    if (rpm >= points.back().rpm) {
+        return points.back();
+    }
+    const auto upper = std::lower_bound(points.begin(), points.end(), rpm,
+                                        [](const CurvePoint& point, double value) { return point.rpm < value; });
+    const auto lower = upper - 1;
+    const double t = (rpm - lower->rpm) / (upper->rpm - lower->rpm);
+    return CurvePoint{rpm,
+                      lower->thrust_n + t * (upper->thrust_n - lower->thrust_n),
+                      lower->torque_nm + t * (upper->torque_nm - lower->torque_nm)};
+}
+}  // namespace
+
+bool RotorCurveTable::loadCsv(const std::string& csv_file, RotorCurveTable& table, std::size_t rpm_samples) {
+    std::ifstream in(csv_file);
+    if (!in.is_open() || rpm_samples < 2) {
+        return false;
+    }
+
+    std::string line;
+    if (!std::getline(in, line)) {
+        return false;
+    }
+    const std::vector<std::string> header = splitCsvLine(line);
+    const auto column = [&header](const char* name) -> int {
+        const auto it = std::find(header.begin(), header.end(), name);
+        return it == header.end() ? -1 : static_cast<int>(it - header.begin());
+    };
+    const int rpm_col = column("rpm");
+    const int thrust_col = column("thrust_n");
+    const int torque_col = column("torque_nm");
+    const int inflow_col = column("inflow_mps");
+    if (rpm_col < 0 || thrust_col < 0 || torque_col < 0) {
+        return false;
+    }
+
+    std::map<double, std::vector<CurvePoint>> groups;  // keyed by inflow speed
+    try {
+        while (std::getline(in, line)) {
+            const std::vector<std::string> fields = splitCsvLine(line);
+            if (fields.empty() || (fields.size() == 1 && fields[0].empty())) {
+                continue;
+            }
+            const int needed = std::max({rpm_col, thrust_col, torque_col, inflow_col});
+            if (static_cast<int>(fields.size()) <= needed) {
+                return false;
+            }
+            const double inflow = inflow_col >= 0 ? std::stod(fields[inflow_col]) : 0.0;
+            groups[inflow].push_back(CurvePoint{std::stod(fields[rpm_col]),
+                                                std::stod(fields[thrust_col]),
+                                                std::stod(fields[torque_col])});
+        }
+    } catch (const std::exception&) {
+        return false;
+    }
+    if (groups.empty()) {
+        return false;
+    }
+
+    double rpm_min = 0.0;
+    double rpm_max = 0.0;
+    bool first = true;
+    std::vector<double> inflows;
+    std::vector<std::vector<CurvePoint>> curves;
+    for (auto& [inflow, points] : groups) {
+        std::sort(points.begin(), points.end(),
+                  [](const CurvePoint& a, const CurvePoint& b) { return a.rpm < b.rpm; });
+        rpm_min = first ? points.front().rpm : std::min(rpm_min, points.front().rpm);
+        rpm_max = first ? points.back().rpm : std::max(rpm_max, points.back().rpm);
+        first = false;
+        inflows.push_back(inflow);
+        curves.push_back(std::move(points));
+    }
+    if (rpm_max <= rpm_min) {
+        return false;
+    }
+
+    RotorCurveTable result;
+    result.rpm_min = rpm_min;
+    result.rpm_count = rpm_samples;
+    result.rpm_step = (rpm_max - rpm_min) / static_cast<double>(rpm_samples - 1);
+    result.inflow_min_mps = inflows.front();
+    result.inflow_count = std::max<std::size_t>(inflows.size(), 2);
+    result.inflow_step_mps = inflows.size() > 1
+        ? (inflows.back() - inflows.front()) / static_cast<double>(inflows.size() - 1)
+        : 1.0;
+    result.thrust_n.resize(result.inflow_count * result.rpm_count);
+    result.torque_nm.resize(result.inflow_count * result.rpm_count);
+
+    for (std::size_t row = 0; row < result.inflow_count; ++row) {
+        // locate the measured inflow groups bracketing this grid row
+        const double inflow = result.inflow_min_mps + static_cast<double>(row) * result.inflow_step_mps;
+        std::size_t upper = 0;
+        while (upper + 1 < inflows.size() && inflows[upper] < inflow) {
+            ++upper;
+        }
+        const std::size_t lower = upper > 0 ? upper - 1 : 0;
+        const double span = inflows[upper] - inflows[lower];
+        const double t = span > 0.0 ? std::clamp((inflow - inflows[lower]) / span, 0.0, 1.0) : 0.0;
+
+        for (std::size_t col = 0; col < result.rpm_count; ++col) {
+            const double rpm = result.rpm_min + static_cast<double>(col) * result.rpm_step;
+            const CurvePoint a = interpolateCurve(curves[lower], rpm);
+            const CurvePoint b = interpolateCurve(curves[upper], rpm);
+            result.thrust_n[row * result.rpm_count + col] = a.thrust_n + t * (b.thrust_n - a.thrust_n);
+            result.torque_nm[row * result.rpm_count + col] = a.torque_nm + t * (b.torque_nm - a.torque_nm);
+        }
+    }
+
+    table = std::move(result);
+    return true;
+}
+
+RotorModel::RotorModel(const ThrustModelParams& params,
+                       const std::vector<drone::model::components::ElecMotor>& motors) {
+    thrust_per_rpm2_.reserve(motors.size());
+    torque_per_rpm2_.reserve(motors.size());
+    for (const auto& motor : motors) {
+        // kT * D * shape * (2*pi/60)^2, folded once per rotor
+        const double scale = motor.getSpecs().blade_diameter_m * motor.getSpecs().blade_shape_coeff *
+                             kRpmToRadPerSec * kRpmToRadPerSec;
+        thrust_per_rpm2_.push_back(params.kT * scale);
+        torque_per_rpm2_.push_back(params.kQ * scale);
+    }
+}
+
+void RotorModel::setCurveTable(RotorCurveTable table) {
+    curve_ = std::move(table);
+    inv_rpm_step_ = curve_.empty() ? 0.0 : 1.0 / curve_.rpm_step;
+    inv_inflow_step_ = curve_.empty() ? 0.0 : 1.0 / curve_.inflow_step_mps;
+}
+
+void RotorModel::evaluate(const double* rpm, const double* inflow_mps, double* thrust_n, double* torque_nm) const {
+    const std::size_t count = rotorCount();
+    if (curve_.empty()) {
+        for (std::size_t i = 0; i < count; ++i) {
+            const double rpm2 = rpm[i] * rpm[i];
+            thrust_n[i] = thrust_per_rpm2_[i] * rpm2;
+            torque_nm[i] = torque_per_rpm2_[i] * rpm2;
+        }
+        return;
+    }
+
+    const double max_col = static_cast<double>(curve_.rpm_count - 1);
+    const double max_row = static_cast<double>(curve_.inflow_count - 1);
+    const std::size_t stride = curve_.rpm_count;
+    const double* thrust = curve_.thrust_n.data();
+    const double* torque = curve_.torque_nm.data();
+    for (std::size_t i = 0; i < count; ++i) {
+        const double x = std::min(std::max((std::abs(rpm[i]) - curve_.rpm_min) * inv_rpm_step_, 0.0), max_col);
+        const double y = std::min(std::max((inflow_mps[i] - curve_.inflow_min_mps) * inv_inflow_step_, 0.0), max_row);
+        const std::size_t col = std::min(static_cast<std::size_t>(x), curve_.rpm_count - 2);
+        const std::size_t row = std::min(static_cast<std::size_t>(y), curve_.inflow_count - 2);
+        const double fx = x - static_cast<double>(col);
+        const double fy = y - static_cast<double>(row);
+
+        const std::size_t k00 = row * stride + col;
+        const std::size_t k10 = k00 + stride;
+        const double thrust_lo = thrust[k00] + fx * (thrust[k00 + 1] - thrust[k00]);
+        const double thrust_hi = thrust[k10] + fx * (thrust[k10 + 1] - thrust[k10]);
+        const double torque_lo = torque[k00] + fx * (torque[k00 + 1] - torque[k00]);
+        const double torque_hi = torque[k10] + fx * (torque[k10 + 1] - torque[k10]);
+        thrust_n[i] = thrust_lo + fy * (thrust_hi - thrust_lo);
+        torque_nm[i] = torque_lo + fy * (torque_hi - torque_lo);
+    }
+}
+
+}  // namespace drone::simulator::physics
@@ -27,12 +27,10 @@ double ThrustModel::computeThrustN(const drone::model::components::ElecMotor* mo
     if (!motor) {
         return 0.0;
     }
-    ThrustModelParams adjusted = params;
-    adjusted.diameter_m = motor->getSpecs().blade_diameter_m;
-    adjusted.shape_coeff = motor->getSpecs().blade_shape_coeff;
-
+    // blade geometry comes from the motor specs, not params
+    const double scale = motor->getSpecs().blade_diameter_m * motor->getSpecs().blade_shape_coeff;
     const double omega = rpmToRadPerSec(motor->getSpeedRPM());
-    return computeThrustN(omega, adjusted);
+    return params.kT * scale * omega * omega;
 }
 
 double ThrustModel::computeTorqueNm(const drone::model::components::ElecMotor* motor,
@@ -40,12 +38,10 @@ double ThrustModel::computeTorqueNm(const drone::model::components::ElecMotor* m
     if (!motor) {
         return 0.0;
     }
-    ThrustModelParams adjusted = params;
-    adjusted.diameter_m = motor->getSpecs().blade_diameter_m;
-    adjusted.shape_coeff = motor->getSpecs().blade_shape_coeff;
-
+    // blade geometry comes from the motor specs, not params
+    const double scale = motor->getSpecs().blade_diameter_m * motor->getSpecs().blade_shape_coeff;
     const double omega = rpmToRadPerSec(motor->getSpeedRPM());
-    return computeTorqueNm(omega, adjusted);
+    return params.kQ * scale * omega * omega;
 }
 
 }  // namespace drone::simulator::physics
\ No newline at end of file
@@ -2,11 +2,13 @@
 #include "simulator/physics/motor_physics.h"
 #include "simulator/physics/battery_sim.h"
 #include "simulator/physics/thrust_model.h"
+#include "simulator/physics/rotor_model.h"
 #include "simulator/physics/gps_sim.h"
 #include "simulator/physics/force_dynamics.h"
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <ctime>
 #include <fstream>
 #include <iomanip>
@@ -29,6 +31,17 @@ std::string localTimestampNow() {
     return out.str();
 }
 
+// Small quadcopter props; blade diameter and shape come from each motor's specs
+const drone::simulator::physics::ThrustModelParams kDefaultThrustParams{
+    1.5e-5,  // kT thrust coefficient
+    1.5e-6,  // kQ torque coefficient (typically kT / 10)
+    0.3,
+    1.0,
+};
+
+// Linear drag of the point-mass dynamics [N per m/s]
+constexpr double kDampingNPerMps = 1.2;
+
 }  // namespace
 
 namespace drone::simulator {
@@ -40,6 +53,7 @@ drone::runtime::SensorFrame QuaroSimulation::readSensors() const {
     }
 
     sensor_frame.altitude_m = quad_->getAltitudeM();
+    sensor_frame.altitude_agl_m = position_enu_m_.z - ground_height_m_;
     sensor_frame.position_enu_x_m = position_enu_m_.x;
     sensor_frame.position_enu_y_m = position_enu_m_.y;
     sensor_frame.position_enu_z_m = position_enu_m_.z;
@@ -56,9 +70,10 @@ drone::runtime::SensorFrame QuaroSimulation::readSensors() const {
     sensor_frame.battery_voltage_v = quad_->getBatteryVoltageV();
     sensor_frame.battery_soc_percent = quad_->getBatterySOC();
     sensor_frame.motor_temperature_c = quad_->getTemperatureC();
-    sensor_frame.yaw_rad = attitude_ypr_rad_.yaw_rad;
-    sensor_frame.pitch_rad = attitude_ypr_rad_.pitch_rad;
-    sensor_frame.roll_rad = attitude_ypr_rad_.roll_rad;
+    const drone::AttitudeYPR& attitude_ypr_rad = attitudeYpr();
+    sensor_frame.yaw_rad = attitude_ypr_rad.yaw_rad;
+    sensor_frame.pitch_rad = attitude_ypr_rad.pitch_rad;
+    sensor_frame.roll_rad = attitude_ypr_rad.roll_rad;
 
     const auto& motors = quad_->getMotors();
     sensor_frame.motor_rpm = motors.empty() ? 0.0 : motors[0].getSpeedRPM();
@@ -76,9 +91,12 @@ void QuaroSimulation::applyActuators(const drone::runtime::ActuatorFrame& actuat
     yaw_control_rpm_ = actuator_frame.yaw_control_rpm;
     pitch_control_rpm_ = actuator_frame.pitch_control_rpm;
     roll_control_rpm_ = actuator_frame.roll_control_rpm;
-    attitude_ypr_rad_.yaw_rad = actuator_frame.desired_yaw_rad;
-    attitude_ypr_rad_.pitch_rad = actuator_frame.desired_pitch_rad;
-    attitude_ypr_rad_.roll_rad = actuator_frame.desired_roll_rad;
+    if (!rigid_body_enabled_) {
+        attitude_ypr_rad_.yaw_rad = actuator_frame.desired_yaw_rad;
+        attitude_ypr_rad_.pitch_rad = actuator_frame.desired_pitch_rad;
+        attitude_ypr_rad_.roll_rad = actuator_frame.desired_roll_rad;
+        body_to_enu_ = drone::simulator::physics::Matrix3::fromAttitude(attitude_ypr_rad_);
+    }
     target_altitude_m_ = actuator_frame.target_altitude_m;
     target_error_m_ = actuator_frame.target_error_m;
     p_component_rpm_ = actuator_frame.p_component_rpm;
@@ -104,6 +122,231 @@ void QuaroSimulation::setWeatherConfig(const drone::simulator::config::WeatherCo
     weather_model_.setConfig(weather_config);
 }
 
+void QuaroSimulation::setWindField(std::shared_ptr<const drone::simulator::environment::WindField> wind_field) {
+    weather_model_.setWindField(std::move(wind_field));
+}
+
+void QuaroSimulation::setWeatherTape(std::shared_ptr<const drone::simulator::environment::WeatherTape> weather_tape) {
+    weather_model_.setTape(std::move(weather_tape));
+}
+
+void QuaroSimulation::setRotorCurveTable(drone::simulator::physics::RotorCurveTable curve_table) {
+    rotor_curve_table_ = std::move(curve_table);
+    rebuildRotorModel();
+}
+
+void QuaroSimulation::rebuildRotorModel() {
+    const std::size_t rotor_count = quad_ ? quad_->getMotors().size() : 0;
+    rotor_model_ = quad_ ? drone::simulator::physics::RotorModel(kDefaultThrustParams, quad_->getMotors())
+                         : drone::simulator::physics::RotorModel();
+    rotor_model_.setCurveTable(rotor_curve_table_);
+    rotor_rpm_.assign(rotor_count, 0.0);
+    rotor_inflow_mps_.assign(rotor_count, 0.0);
+    rotor_thrust_n_.assign(rotor_count, 0.0);
+    rotor_torque_nm_.assign(rotor_count, 0.0);
+}
+
+std::size_t QuaroSimulation::readImuSamples(drone::runtime::ImuSample* out, std::size_t capacity) {
+    return imu_.read(out, capacity);
+}
+
+void QuaroSimulation::setImuSpecs(const drone::simulator::physics::ImuSpecs& imu_specs) {
+    constexpr double kGravityMs2 = 9.81;
+    imu_.setSpecs(imu_specs);
+    imu_enabled_ = true;
+    imu_truth_ = drone::simulator::physics::ImuTruth{
+        body_to_enu_.transposeTimes(acceleration_enu_ms2_ + drone::Vector3(0.0, 0.0, kGravityMs2)),
+        rigid_body_enabled_ ? rigid_body_.getAngularRateBodyRps() : drone::Vector3()};
+    imu_prev_attitude_ypr_rad_ = attitudeYpr();
+}
+
+void QuaroSimulation::setRigidBodyParams(const drone::simulator::physics::RigidBodyParams& params) {
+    rigid_body_.setParams(params);
+    rigid_body_.setPositionEnuM(position_enu_m_);
+    rigid_body_.setVelocityEnuMps(velocity_enu_mps_);
+    rigid_body_.setAngularRateBodyRps(drone::Vector3());
+    rigid_body_.setAttitude(drone::simulator::physics::Quaternion::fromAttitude(attitudeYpr()));
+    body_to_enu_ = rigid_body_.getBodyToEnu();
+    rigid_body_enabled_ = true;
+}
+
+void QuaroSimulation::setTerrainMap(std::shared_ptr<const drone::simulator::environment::TerrainMap> terrain_map) {
+    terrain_map_ = std::move(terrain_map);
+    ground_height_m_ = terrain_map_ ? terrain_map_->heightAtM(position_enu_m_.x, position_enu_m_.y) : 0.0;
+}
+
+drone::simulator::runtime::MissionEnergyVehicle QuaroSimulation::getMissionEnergyVehicle() const {
+    drone::simulator::runtime::MissionEnergyVehicle vehicle;
+    vehicle.damping_n_per_mps = kDampingNPerMps;
+    if (!quad_) {
+        return vehicle;
+    }
+    vehicle.mass_kg = quad_->getTotalWeightKg();
+    const auto& motors = quad_->getMotors();
+    vehicle.rotor_count = motors.size();
+    if (!motors.empty()) {
+        const auto& specs = motors.front().getSpecs();
+        vehicle.motor_max_speed_rpm = specs.max_speed_rpm;
+        vehicle.motor_max_current_a = specs.max_current_a;
+        vehicle.motor_efficiency = specs.efficiency;
+        double thrust_per_rpm2_sum = 0.0;
+        for (std::size_t i = 0; i < rotor_model_.rotorCount(); ++i) {
+            thrust_per_rpm2_sum += rotor_model_.thrustPerRpm2(i);
+        }
+        vehicle.thrust_per_rpm2_n = rotor_model_.rotorCount() > 0 ? thrust_per_rpm2_sum / rotor_model_.rotorCount() : 0.0;
+    }
+    const auto* battery_sim = dynamic_cast<const drone::simulator::physics::BatterySim*>(quad_->getBattery());
+    if (battery_sim) {
+        vehicle.series_cells = battery_sim->getSpecs().cells;
+        vehicle.parallel_cells = battery_sim->getSpecs().parallel_cells;
+        vehicle.cell_capacity_mah = battery_sim->getSpecs().cell_specs.capacity_mah;
+        vehicle.ocv_table = battery_sim->getOcvTable();
+        vehicle.initial_soc_percent = battery_sim->getStateOfChargePercent();
+    }
+    return vehicle;
+}
+
+const drone::AttitudeYPR& QuaroSimulation::attitudeYpr() const {
+    if (attitude_ypr_stale_) {
+        attitude_ypr_rad_ = body_to_enu_.toAttitude();
+        attitude_ypr_stale_ = false;
+    }
+    return attitude_ypr_rad_;
+}
+
+drone::Vector3 QuaroSimulation::stillAirAccelerationEnuMs2(const drone::Vector3& velocity_enu_mps,
+                                                          const drone::AttitudeYPR& attitude_ypr_rad,
+                                                          const std::vector<double>& rotor_rpm) const {
+    constexpr double kGravityMs2 = 9.81;
+    const std::vector<double> inflow_mps(rotor_rpm.size(), velocity_enu_mps.z);
+    std::vector<double> thrust_n(rotor_rpm.size(), 0.0);
+    std::vector<double> torque_nm(rotor_rpm.size(), 0.0);
+    rotor_model_.evaluate(rotor_rpm.data(), inflow_mps.data(), thrust_n.data(), torque_nm.data());
+    double total_thrust_n = 0.0;
+    for (double value : thrust_n) {
+        total_thrust_n += value;
+    }
+    const double total_weight_kg = quad_->getTotalWeightKg();
+    const drone::Vector3 net_force_enu_n = drone::simulator::physics::computeNetForceEnu(
+        drone::Vector3(0.0, 0.0, total_thrust_n),
+        drone::simulator::physics::Matrix3::fromAttitude(attitude_ypr_rad),
+        total_weight_kg,
+        velocity_enu_mps,
+        kDampingNPerMps,
+        kGravityMs2);
+    return net_force_enu_n * (1.0 / total_weight_kg);
+}
+
+drone::simulator::runtime::SurrogateModel QuaroSimulation::linearizeHover(
+    const drone::simulator::runtime::SurrogateLinearization& options) const {
+    using drone::simulator::runtime::kSurrogateInputCount;
+    using drone::simulator::runtime::kSurrogateStateCount;
+    constexpr std::size_t kRotors = drone::runtime::kMotorCount;
+
+    drone::simulator::runtime::SurrogateModel model;
+    if (!quad_ || quad_->getMotors().size() != kRotors || rotor_model_.rotorCount() != kRotors) {
+        return model;
+    }
+    const auto& motor_specs = quad_->getMotors().front().getSpecs();
+    const double battery_voltage_v = quad_->getBatteryVoltageV();
+    model.battery_voltage_v = battery_voltage_v;
+    // MotorPhysics::updateSpeed scales the speed limit with the pack voltage
+    model.motor_max_speed_rpm = motor_specs.max_speed_rpm * battery_voltage_v / motor_specs.nominal_voltage_v;
+
+    const drone::Vector3 rest;
+    const drone::AttitudeYPR level;
+    const auto vertical_acceleration = [&](double rpm) {
+        return stillAirAccelerationEnuMs2(rest, level, std::vector<double>(kRotors, rpm)).z;
+    };
+
+    // hover trim: thrust rises monotonically with RPM
+    double low_rpm = 0.0;
+    double high_rpm = model.motor_max_speed_rpm;
+    if (vertical_acceleration(high_rpm) < 0.0) {
+        return model;  // cannot hover
+    }
+    for (int i = 0; i < 100 && high_rpm - low_rpm > 1e-9; ++i) {
+        const double mid_rpm = 0.5 * (low_rpm + high_rpm);
+        if (vertical_acceleration(mid_rpm) < 0.0) {
+            low_rpm = mid_rpm;
+        } else {
+            high_rpm = mid_rpm;
+        }
+    }
+    model.hover_rpm = 0.5 * (low_rpm + high_rpm);
+    // at the trim thrust balances gravity alone; recover it from the level acceleration with thrust removed
+    model.hover_thrust_accel_mps2 = -stillAirAccelerationEnuMs2(rest, level, std::vector<double>(kRotors, 0.0)).z;
+
+    // velocity rows: central differences around hover
+    const std::vector<double> hover_rpm(kRotors, model.hover_rpm);
+    const auto set_column = [&](auto& matrix, std::size_t column_count, std::size_t column,
+                                const drone::Vector3& plus, const drone::Vector3& minus, double step) {
+        const drone::Vector3 derivative = (plus - minus) * (0.5 / step);
+        matrix[0 * column_count + column] = derivative.x;
+        matrix[1 * column_count + column] = derivative.y;
+        matrix[2 * column_count + column] = derivative.z;
+    };
+    const drone::Vector3 axes[3] = {drone::Vector3(1.0, 0.0, 0.0), drone::Vector3(0.0, 1.0, 0.0),
+                                    drone::Vector3(0.0, 0.0, 1.0)};
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        const drone::Vector3 step = axes[axis] * options.velocity_step_mps;
+        set_column(model.a, kSurrogateStateCount, axis, stillAirAccelerationEnuMs2(step, level, hover_rpm),
+                   stillAirAccelerationEnuMs2(step * -1.0, level, hover_rpm), options.velocity_step_mps);
+    }
+    for (std::size_t rotor = 0; rotor < kRotors; ++rotor) {
+        std::vector<double> plus = hover_rpm;
+        std::vector<double> minus = hover_rpm;
+        plus[rotor] += options.rpm_step;
+        minus[rotor] -= options.rpm_step;
+        set_column(model.a, kSurrogateStateCount, 3 + rotor, stillAirAccelerationEnuMs2(rest, level, plus),
+                   stillAirAccelerationEnuMs2(rest, level, minus), options.rpm_step);
+    }
+    const double angle_step_rad = options.angle_step_rad;
+    set_column(model.b, kSurrogateInputCount, kRotors,
+               stillAirAccelerationEnuMs2(rest, drone::AttitudeYPR(0.0, angle_step_rad, 0.0), hover_rpm),
+               stillAirAccelerationEnuMs2(rest, drone::AttitudeYPR(0.0, -angle_step_rad, 0.0), hover_rpm),
+               angle_step_rad);
+    set_column(model.b, kSurrogateInputCount, kRotors + 1,
+               stillAirAccelerationEnuMs2(rest, drone::AttitudeYPR(0.0, 0.0, angle_step_rad), hover_rpm),
+               stillAirAccelerationEnuMs2(rest, drone::AttitudeYPR(0.0, 0.0, -angle_step_rad), hover_rpm),
+               angle_step_rad);
+
+    // motor rows: step the speed model from hover and fit a lag at the 63 % rise time
+    const auto& motor = quad_->getMotors().front();
+    drone::model::components::ElecMotor probe(
+        "ramp_probe", motor.getType(), std::make_shared<const drone::model::components::ElecMotorSpecs>(motor_specs));
+    probe.setSpeedRPM(model.hover_rpm);
+    probe.setDesiredSpeedRPM(model.hover_rpm + options.motor_step_rpm);
+    const uint64_t delta_ms = static_cast<uint64_t>(options.dt_s * 1000.0);
+    const double rise_rpm = model.hover_rpm + (1.0 - std::exp(-1.0)) * options.motor_step_rpm;
+    double time_s = 0.0;
+    double time_constant_s = 0.0;
+    for (int i = 0; i < 100000 && time_constant_s <= 0.0 && delta_ms > 0; ++i) {
+        const double before_rpm = probe.getSpeedRPM();
+        drone::simulator::physics::MotorPhysics::updateSpeed(probe, delta_ms, battery_voltage_v);
+        const double after_rpm = probe.getSpeedRPM();
+        if (after_rpm >= rise_rpm && after_rpm > before_rpm) {
+            time_constant_s = time_s + delta_ms / 1000.0 * (rise_rpm - before_rpm) / (after_rpm - before_rpm);
+        }
+        time_s += delta_ms / 1000.0;
+    }
+    model.motor_time_constant_s = time_constant_s;
+    if (time_constant_s > 0.0) {
+        for (std::size_t rotor = 0; rotor < kRotors; ++rotor) {
+            model.a[(3 + rotor) * kSurrogateStateCount + 3 + rotor] = -1.0 / time_constant_s;
+            model.b[(3 + rotor) * kSurrogateInputCount + rotor] = 1.0 / time_constant_s;
+        }
+    }
+    return model;
+}
+
+void QuaroSimulation::setBatteryConfig(const drone::simulator::config::BatteryConfig& battery_config) {
+    auto* battery_sim = quad_ ? dynamic_cast<drone::simulator::physics::BatterySim*>(quad_->getBattery()) : nullptr;
+    if (battery_sim) {
+        battery_sim->setOcvTable(battery_config.ocvTable());
+    }
+}
+
 bool QuaroSimulation::setTelemetryLogFile(const std::string& telemetry_log_file) {
     telemetry_log_file_ = telemetry_log_file;
     if (telemetry_log_stream_.is_open()) {
@@ -119,6 +362,8 @@ void QuaroSimulation::onStart() {
     if (!is_running_) {
         is_running_ = true;
         elapsed_s_ = 0.0;
+        slow_subsystem_elapsed_s_ = 0.0;
+        slow_subsystem_charge_as_ = 0.0;
         position_enu_m_ = drone::Vector3(0.0, 0.0, altitude_m_);
         velocity_enu_mps_ = drone::Vector3(0.0, 0.0, vertical_speed_mps_);
         acceleration_enu_ms2_ = drone::Vector3();
@@ -179,6 +424,11 @@ void QuaroSimulation::onStep(double delta_time_s) {
             }
         }
         
+        slow_subsystem_elapsed_s_ += delta_time_s;
+        // nothing to average over until time has passed (zero-length steps)
+        const bool slow_update_due =
+            slow_subsystem_elapsed_s_ > 0.0 && slow_subsystem_elapsed_s_ >= slow_subsystem_period_s_;
+
         for (std::size_t i = 0; i < motors.size(); ++i) {
             auto& motor = motors[i];
             const double motor_rpm_ref = (has_per_motor_refs && i < desired_motor_rpm_each_.size())
@@ -188,9 +438,12 @@ void QuaroSimulation::onStep(double delta_time_s) {
             motor.setDesiredSpeedRPM(motor_rpm_ref);
             // Use battery-aware physics engine to update motor (includes depletion cutoff)
             if (battery) {
-                drone::simulator::physics::MotorPhysics::updateMotorPhysics(motor, delta_ms, battery);
+                drone::simulator::physics::MotorPhysics::updateElectricalState(motor, delta_ms, battery);
             } else {
-                drone::simulator::physics::MotorPhysics::updateMotorPhysics(motor, delta_ms, battery_voltage);
+                drone::simulator::physics::MotorPhysics::updateElectricalState(motor, delta_ms, battery_voltage);
+            }
+            if (slow_update_due) {
+                drone::simulator::physics::MotorPhysics::advanceTemperature(motor, slow_subsystem_elapsed_s_);
             }
         }
         
@@ -199,59 +452,110 @@ void QuaroSimulation::onStep(double delta_time_s) {
         for (const auto& motor : motors) {
             total_current += motor.getCurrentA();
         }
+        slow_subsystem_charge_as_ += total_current * delta_time_s;
         
-        // Update battery with total current draw
+        // Update battery with the mean current drawn since its last update
         if (quad_->getBattery()) {
             auto* battery_sim = dynamic_cast<drone::simulator::physics::BatterySim*>(quad_->getBattery());
             if (battery_sim) {
+                if (slow_update_due) {
+                    battery_sim->setCurrentA(slow_subsystem_charge_as_ / slow_subsystem_elapsed_s_);
+                    battery_sim->advance(slow_subsystem_elapsed_s_);
+                }
                 battery_sim->setCurrentA(total_current);
-                battery_sim->update(delta_ms);
             }
         }
+        if (slow_update_due) {
+            slow_subsystem_elapsed_s_ = 0.0;
+            slow_subsystem_charge_as_ = 0.0;
+        }
         
         // Calculate thrust from all motors and update altitude
         double total_thrust_n = 0.0;
-        drone::simulator::physics::ThrustModelParams thrust_params;
-        thrust_params.kT = 1.5e-5;  // Thrust coefficient for small quadcopter props
-        thrust_params.kQ = 1.5e-6;  // Torque coefficient (typically kQ = kT / 10)
-        thrust_params.diameter_m = 0.3;  // Will be overridden by motor specs
-        thrust_params.shape_coeff = 1.0;  // Will be overridden by motor specs
-        
-        for (const auto& motor : motors) {
-            total_thrust_n += drone::simulator::physics::ThrustModel::computeThrustN(&motor, thrust_params);
+        if (rotor_model_.rotorCount() != motors.size()) {
+            rebuildRotorModel();
+        }
+        for (std::size_t i = 0; i < motors.size(); ++i) {
+            rotor_rpm_[i] = motors[i].getSpeedRPM();
+            rotor_inflow_mps_[i] = velocity_enu_mps_.z;  // axial inflow from climb rate
+        }
+        rotor_model_.evaluate(rotor_rpm_.data(), rotor_inflow_mps_.data(),
+                              rotor_thrust_n_.data(), rotor_torque_nm_.data());
+        for (double thrust_n : rotor_thrust_n_) {
+            total_thrust_n += thrust_n;
         }
         
         // Calculate net force and acceleration in ENU coordinates
         const double GRAVITY_MS2 = 9.81;
-        const double DAMPING_N_PER_MPS = 1.2;
         double total_weight_kg = quad_->getTotalWeightKg();
         const drone::Vector3 thrust_body_n(0.0, 0.0, total_thrust_n);
         const drone::Vector3 net_force_enu_n = drone::simulator::physics::computeNetForceEnu(
             thrust_body_n,
-            attitude_ypr_rad_,
+            body_to_enu_,
             total_weight_kg,
             velocity_enu_mps_,
-            DAMPING_N_PER_MPS,
+            kDampingNPerMps,
             GRAVITY_MS2);
 
-        weather_sample_ = weather_model_.sample(elapsed_s_);
-        const drone::Vector3 weather_force_enu_n = weather_sample_.total_accel_enu_ms2 * total_weight_kg;
+        weather_sample_ = weather_model_.sample(elapsed_s_, position_enu_m_);
+        // wind moves the air the linear drag acts against
+        const drone::Vector3 weather_force_enu_n = weather_sample_.total_accel_enu_ms2 * total_weight_kg +
+                                                   weather_sample_.wind_velocity_enu_mps * kDampingNPerMps;
         const drone::Vector3 net_force_with_weather_enu_n = net_force_enu_n + weather_force_enu_n;
 
         acceleration_enu_ms2_ = net_force_with_weather_enu_n * (1.0 / total_weight_kg);
 
-        // Integrate translational dynamics
+        // Integrate translational (and in rigid-body mode rotational) dynamics
         const drone::Vector3 prev_position_enu_m = position_enu_m_;
-        velocity_enu_mps_ += acceleration_enu_ms2_ * delta_time_s;
-        position_enu_m_ += velocity_enu_mps_ * delta_time_s;
+        if (rigid_body_enabled_) {
+            const drone::Vector3 torque_body_nm = rigid_body_.quadXTorqueBodyNm(rotor_thrust_n_, rotor_torque_nm_);
+            rigid_body_.step(delta_time_s, total_weight_kg, net_force_with_weather_enu_n, torque_body_nm);
+            velocity_enu_mps_ = rigid_body_.getVelocityEnuMps();
+            position_enu_m_ = rigid_body_.getPositionEnuM();
+            body_to_enu_ = rigid_body_.getBodyToEnu();
+            attitude_ypr_stale_ = true;
+        } else {
+            velocity_enu_mps_ += acceleration_enu_ms2_ * delta_time_s;
+            position_enu_m_ += velocity_enu_mps_ * delta_time_s;
+        }
 
-        // Ground clamp and lock (z=0): no movement allowed while grounded
-        if (position_enu_m_.z <= 0.0) {
+        // Ground clamp and lock (terrain height, z=0 without terrain): no movement allowed while grounded
+        ground_height_m_ = terrain_map_ ? terrain_map_->heightAtM(position_enu_m_.x, position_enu_m_.y) : 0.0;
+        if (position_enu_m_.z <= ground_height_m_) {
+            if (terrain_map_) {
+                ground_height_m_ = terrain_map_->heightAtM(prev_position_enu_m.x, prev_position_enu_m.y);
+            }
             position_enu_m_.x = prev_position_enu_m.x;
             position_enu_m_.y = prev_position_enu_m.y;
-            position_enu_m_.z = 0.0;
+            position_enu_m_.z = ground_height_m_;
             velocity_enu_mps_ = drone::Vector3(0.0, 0.0, 0.0);
             acceleration_enu_ms2_ = drone::Vector3(0.0, 0.0, 0.0);
+            if (rigid_body_enabled_) {
+                rigid_body_.setPositionEnuM(position_enu_m_);
+                rigid_body_.setVelocityEnuMps(velocity_enu_mps_);
+                rigid_body_.setAngularRateBodyRps(drone::Vector3());
+            }
+        }
+
+        if (imu_enabled_) {
+            drone::Vector3 angular_rate_body_rps = rigid_body_.getAngularRateBodyRps();
+            if (!rigid_body_enabled_) {
+                // Attitude is commanded directly, so body rates come from its change over the step
+                constexpr double kPi = 3.14159265358979323846;
+                double yaw_delta_rad = attitude_ypr_rad_.yaw_rad - imu_prev_attitude_ypr_rad_.yaw_rad;
+                yaw_delta_rad = std::remainder(yaw_delta_rad, 2.0 * kPi);
+                angular_rate_body_rps = drone::simulator::physics::eulerRatesToBodyRates(
+                    attitude_ypr_rad_,
+                    yaw_delta_rad / delta_time_s,
+                    (attitude_ypr_rad_.pitch_rad - imu_prev_attitude_ypr_rad_.pitch_rad) / delta_time_s,
+                    (attitude_ypr_rad_.roll_rad - imu_prev_attitude_ypr_rad_.roll_rad) / delta_time_s);
+                imu_prev_attitude_ypr_rad_ = attitude_ypr_rad_;
+            }
+            const drone::simulator::physics::ImuTruth imu_truth{
+                body_to_enu_.transposeTimes(acceleration_enu_ms2_ + drone::Vector3(0.0, 0.0, GRAVITY_MS2)),
+                angular_rate_body_rps};
+            imu_.advance(delta_time_s, imu_truth_, imu_truth);
+            imu_truth_ = imu_truth;
         }
 
         // Legacy compatibility mirrors
@@ -302,7 +606,7 @@ void QuaroSimulation::onStep(double delta_time_s) {
         }
         
         if (telemetry_log_stream_.is_open()) {
-            const bool ground_locked = position_enu_m_.z <= 0.0;
+            const bool ground_locked = position_enu_m_.z <= ground_height_m_;
             telemetry_log_stream_ << std::fixed << std::setprecision(6)
                 << localTimestampNow() << ","
                 << elapsed_s_ << ","
@@ -329,9 +633,9 @@ void QuaroSimulation::onStep(double delta_time_s) {
                 << velocity_enu_mps_.x << ","
                 << velocity_enu_mps_.y << ","
                 << velocity_enu_mps_.z << ","
-                << attitude_ypr_rad_.yaw_rad << ","
-                << attitude_ypr_rad_.pitch_rad << ","
-                << attitude_ypr_rad_.roll_rad << ","
+                << attitudeYpr().yaw_rad << ","
+                << attitudeYpr().pitch_rad << ","
+                << attitudeYpr().roll_rad << ","
                 << target_altitude_m_ << ","
                 << target_error_m_ << ","
                 << p_component_rpm_ << ","
@@ -407,8 +711,39 @@ std::shared_ptr<QuaroSimulation> QuadroSimulationFactory(
             gps_sim->setReferenceGeodetic(drone::Position3D(0.0, 0.0, 0.0));
         }
     }
+    sim->rebuildRotorModel();
 
     return sim;
 }
 
+std::shared_ptr<QuaroSimulation> QuadroSimulationFactory(uint64_t steps, double dt_s) {
+    const drone::model::components::ElecMotorSpecs motor_specs(15000.0, 14.8, 20.0, 0.9, 0.4, 0.12);
+    const drone::model::sensors::AnalogIOSpec motor_io_spec(
+        drone::model::sensors::AnalogIOSpec::IODirection::OUTPUT,
+        drone::model::sensors::AnalogIOSpec::CurrentRange::ZERO_TO_10V,
+        0, 10000);
+    const drone::model::components::CellSpecs cell_specs(1500.0, 4.2);
+    const drone::model::components::BatterySpecs battery_specs(4, cell_specs, 0.35);
+    const drone::model::sensors::AnalogIOSpec temp_io_spec(
+        drone::model::sensors::AnalogIOSpec::IODirection::INPUT,
+        drone::model::sensors::AnalogIOSpec::CurrentRange::FOUR_TO_20mA,
+        4000, 20000);
+    const drone::model::sensors::TemperatureSensorRanges temp_ranges(-50.0, 150.0);
+
+    return QuadroSimulationFactory(
+        "QuadTest",
+        motor_specs,
+        motor_io_spec,
+        battery_specs,
+        temp_io_spec,
+        temp_ranges,
+        0.02,  // temp_sensor_weight_kg
+        drone::model::components::GPSSensorSpecs(),
+        1.2,   // body_weight_kg
+        0.3,   // blade_diameter_m
+        1.0,   // blade_shape_coeff
+        steps,
+        dt_s);
+}
+
 }  // namespace drone::simulator;
@@ -0,0 +1,44 @@
+#include "simulator/random/gaussian_block.h"
+
+#include <cmath>
+
+namespace drone::simulator::random {
+
+namespace {
+constexpr double kTwoPi = 6.283185307179586;
+
+inline std::uint64_t splitmix64(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+// Uniform in (0, 1]: never zero, so log() below is finite
+inline double toUnitInterval(std::uint64_t bits) {
+    return static_cast<double>((bits >> 11) + 1) * (1.0 / 9007199254740992.0);
+}
+}  // namespace
+
+void GaussianBlockGenerator::fill(double* out, std::size_t count) {
+    const std::uint64_t stream = splitmix64(seed_);
+    const std::size_t pairs = count / 2;
+    for (std::size_t p = 0; p < pairs; ++p) {
+        const std::uint64_t index = counter_ + 2 * p;
+        const double u1 = toUnitInterval(splitmix64(stream ^ index));
+        const double u2 = toUnitInterval(splitmix64(stream ^ (index + 1)));
+        const double radius = std::sqrt(-2.0 * std::log(u1));
+        out[2 * p] = radius * std::cos(kTwoPi * u2);
+        out[2 * p + 1] = radius * std::sin(kTwoPi * u2);
+    }
+    counter_ += 2 * pairs;
+
+    if (count % 2 != 0) {
+        const double u1 = toUnitInterval(splitmix64(stream ^ counter_));
+        const double u2 = toUnitInterval(splitmix64(stream ^ (counter_ + 1)));
+        out[count - 1] = std::sqrt(-2.0 * std::log(u1)) * std::cos(kTwoPi * u2);
+        counter_ += 2;
+    }
+}
+
+}  // namespace drone::simulator::random
@@ -0,0 +1,27 @@
+#include "simulator/random/noise_block.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace drone::simulator::random {
+
+NoiseBlock::NoiseBlock(std::vector<double> sigmas, std::uint64_t seed, std::size_t block_ticks)
+    : sigmas_(std::move(sigmas)),
+      block_ticks_(std::max<std::size_t>(block_ticks, 1)),
+      buffer_(block_ticks_ * std::max<std::size_t>(sigmas_.size(), 1), 0.0),
+      cursor_(block_ticks_),
+      gaussian_(seed) {}
+
+void NoiseBlock::refill() {
+    const std::size_t channels = sigmas_.size();
+    gaussian_.fill(buffer_.data(), buffer_.size());
+    for (std::size_t tick = 0; tick < block_ticks_; ++tick) {
+        double* row = &buffer_[tick * channels];
+        for (std::size_t channel = 0; channel < channels; ++channel) {
+            row[channel] *= sigmas_[channel];
+        }
+    }
+    cursor_ = 0;
+}
+
+}  // namespace drone::simulator::random
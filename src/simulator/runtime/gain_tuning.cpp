@@ -0,0 +1,359 @@
+#include "simulator/runtime/gain_tuning.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <yaml-cpp/yaml.h>
+
+#include "drone/runtime/controller_setup.h"
+#include "simulator/environment/weather_model.h"
+#include "simulator/quadrosimulator.h"
+
+namespace drone::simulator::runtime {
+
+namespace {
+
+using drone::config::AltitudeControllerConfig;
+using drone::config::AttitudeControllerConfig;
+
+constexpr const char* kAltitudeSection = "altitude_controller";
+constexpr const char* kAttitudeSection = "attitude_controller";
+
+template <double AltitudeControllerConfig::*Field>
+double& altitudeGain(AltitudeControllerConfig& alt_config, AttitudeControllerConfig&) {
+    return alt_config.*Field;
+}
+
+template <double AttitudeControllerConfig::*Field>
+double& attitudeGain(AltitudeControllerConfig&, AttitudeControllerConfig& att_config) {
+    return att_config.*Field;
+}
+
+const TunableGain kAltitudeGainTable[] = {
+    {kAltitudeSection, "altitude_param_p", 0.2, 5.0, true,
+     &altitudeGain<&AltitudeControllerConfig::altitude_param_p>},
+    {kAltitudeSection, "max_altitude_delta_mps", 0.5, 8.0, false,
+     &altitudeGain<&AltitudeControllerConfig::max_altitude_delta_mps>},
+    {kAltitudeSection, "control_param_p", 5.0, 400.0, true,
+     &altitudeGain<&AltitudeControllerConfig::control_param_p>},
+    {kAltitudeSection, "control_param_i", 0.05, 50.0, true,
+     &altitudeGain<&AltitudeControllerConfig::control_param_i>},
+    {kAltitudeSection, "control_param_d", 0.5, 100.0, true,
+     &altitudeGain<&AltitudeControllerConfig::control_param_d>},
+};
+
+const TunableGain kPositionGainTable[] = {
+    {kAltitudeSection, "position_hold_roll_gain_rad_per_m", 0.01, 0.3, true,
+     &altitudeGain<&AltitudeControllerConfig::position_hold_roll_gain_rad_per_m>},
+    {kAltitudeSection, "position_hold_roll_damping_rad_per_mps", 0.0, 0.4, false,
+     &altitudeGain<&AltitudeControllerConfig::position_hold_roll_damping_rad_per_mps>},
+};
+
+const TunableGain kAttitudeGainTable[] = {
+    {kAttitudeSection, "yaw_p_gain_rpm_per_rad", 20.0, 2000.0, true,
+     &attitudeGain<&AttitudeControllerConfig::yaw_p_gain_rpm_per_rad>},
+    {kAttitudeSection, "yaw_d_gain_rpm_per_rad_s", 2.0, 400.0, true,
+     &attitudeGain<&AttitudeControllerConfig::yaw_d_gain_rpm_per_rad_s>},
+    {kAttitudeSection, "pitch_p_gain_rpm_per_rad", 20.0, 2000.0, true,
+     &attitudeGain<&AttitudeControllerConfig::pitch_p_gain_rpm_per_rad>},
+    {kAttitudeSection, "pitch_d_gain_rpm_per_rad_s", 2.0, 400.0, true,
+     &attitudeGain<&AttitudeControllerConfig::pitch_d_gain_rpm_per_rad_s>},
+    {kAttitudeSection, "roll_p_gain_rpm_per_rad", 20.0, 2000.0, true,
+     &attitudeGain<&AttitudeControllerConfig::roll_p_gain_rpm_per_rad>},
+    {kAttitudeSection, "roll_d_gain_rpm_per_rad_s", 2.0, 400.0, true,
+     &attitudeGain<&AttitudeControllerConfig::roll_d_gain_rpm_per_rad_s>},
+};
+
+double length(const drone::Vector3& value) {
+    return std::sqrt(value.x * value.x + value.y * value.y + value.z * value.z);
+}
+
+double toUnit(const TunableGain& gain, double value) {
+    value = std::clamp(value, gain.min_value, gain.max_value);
+    if (gain.log_scale) {
+        return std::log(value / gain.min_value) / std::log(gain.max_value / gain.min_value);
+    }
+    return (value - gain.min_value) / (gain.max_value - gain.min_value);
+}
+
+double fromUnit(const TunableGain& gain, double unit) {
+    unit = std::clamp(unit, 0.0, 1.0);
+    if (gain.log_scale) {
+        return gain.min_value * std::pow(gain.max_value / gain.min_value, unit);
+    }
+    return gain.min_value + unit * (gain.max_value - gain.min_value);
+}
+
+// Running ISE / overshoot / settling bookkeeping; a segment starts at every target change
+class SetpointScore {
+public:
+    explicit SetpointScore(double settle_band_m) : settle_band_m_(settle_band_m) {}
+
+    void sample(double time_s, const drone::Vector3& position_enu_m, const drone::Vector3& target_enu_m, double dt_s) {
+        if (!segment_open_ || length(target_enu_m - target_enu_m_) > 1e-6) {
+            closeSegment();
+            segment_open_ = true;
+            target_enu_m_ = target_enu_m;
+            segment_start_s_ = time_s;
+            last_outside_s_ = time_s;
+            segment_overshoot_m_ = 0.0;
+            const drone::Vector3 travel_enu_m = target_enu_m - position_enu_m;
+            const double travel_m = length(travel_enu_m);
+            has_direction_ = travel_m > settle_band_m_;
+            direction_enu_ = has_direction_ ? travel_enu_m * (1.0 / travel_m) : drone::Vector3();
+        }
+        const drone::Vector3 error_enu_m = target_enu_m_ - position_enu_m;
+        const double error_m = length(error_enu_m);
+        ise_m2s_ += error_m * error_m * dt_s;
+        last_error_m_ = error_m;
+        if (error_m > settle_band_m_) {
+            last_outside_s_ = time_s + dt_s;
+        }
+        if (has_direction_) {
+            const double past_target_m = -(error_enu_m.x * direction_enu_.x + error_enu_m.y * direction_enu_.y +
+                                           error_enu_m.z * direction_enu_.z);
+            segment_overshoot_m_ = std::max(segment_overshoot_m_, past_target_m);
+        }
+    }
+
+    void closeSegment() {
+        if (!segment_open_) {
+            return;
+        }
+        settling_s_ += last_outside_s_ - segment_start_s_;
+        overshoot_m_ += segment_overshoot_m_;
+        segment_overshoot_m_ = 0.0;
+        segment_open_ = false;
+    }
+
+    double iseM2s() const { return ise_m2s_; }
+    // closed segments plus the running one; neither term shrinks later
+    double overshootM() const { return overshoot_m_ + segment_overshoot_m_; }
+    double settlingS() const { return settling_s_; }
+    double lastErrorM() const { return last_error_m_; }
+
+private:
+    double settle_band_m_;
+    bool segment_open_ = false;
+    drone::Vector3 target_enu_m_{};
+    drone::Vector3 direction_enu_{};
+    bool has_direction_ = false;
+    double segment_start_s_ = 0.0;
+    double last_outside_s_ = 0.0;
+    double segment_overshoot_m_ = 0.0;
+    double ise_m2s_ = 0.0;
+    double overshoot_m_ = 0.0;
+    double settling_s_ = 0.0;
+    double last_error_m_ = 0.0;
+};
+
+template <typename Vehicle, typename StepFn>
+TuningCost fly(Vehicle& vehicle,
+               StepFn step,
+               const AltitudeControllerConfig& alt_config,
+               const AttitudeControllerConfig& att_config,
+               const TuningScenario& scenario,
+               const TuningFlightOptions& options,
+               const TuningCostWeights& weights,
+               double abort_above,
+               double prior_cost) {
+    drone::runtime::RealDrone real_drone(drone::runtime::makeAltitudeController(alt_config));
+    drone::runtime::applyControllerConfig(real_drone, alt_config, att_config);
+    real_drone.loadMission(scenario.mission);
+    real_drone.startMission();
+
+    TuningCost cost;
+    SetpointScore score(options.settle_band_m);
+    const double dt_s = options.dt_s;
+    const auto steps = static_cast<std::size_t>(std::ceil(options.max_duration_s / dt_s));
+    const double energy_scale = 1.0 / (options.energy_reference_rpm * options.energy_reference_rpm *
+                                       options.energy_reference_rpm * drone::runtime::kMotorCount);
+    bool finished = false;
+    bool failed = false;
+    for (std::size_t i = 0; i < steps && !finished; ++i) {
+        const double time_s = static_cast<double>(i) * dt_s;
+        real_drone.updateMission(vehicle.readSensors(), dt_s);
+        real_drone.update(dt_s, vehicle, vehicle);
+        step(time_s);
+
+        const auto sensors = vehicle.readSensors();
+        const drone::Vector3 position_enu_m(sensors.position_enu_x_m, sensors.position_enu_y_m,
+                                            sensors.position_enu_z_m);
+        const drone::Vector3 target_xy = real_drone.getTargetPosition();
+        score.sample(time_s, position_enu_m,
+                     drone::Vector3(target_xy.x, target_xy.y, real_drone.getTargetAltitude()), dt_s);
+        for (double rpm : sensors.motor_rpm_each) {
+            cost.energy_hover_s += rpm * rpm * rpm * energy_scale * dt_s;
+        }
+        cost.flown_s = time_s + dt_s;
+
+        const auto status = real_drone.getMissionStatus();
+        if (status == drone::mission::MissionStatus::COMPLETED) {
+            finished = true;
+        } else if (status == drone::mission::MissionStatus::FAILED ||
+                   status == drone::mission::MissionStatus::ABORTED ||
+                   !std::isfinite(score.lastErrorM()) || score.lastErrorM() > options.divergence_m) {
+            finished = true;
+            failed = true;
+        }
+
+        const double monotone_cost = prior_cost + weights.ise * score.iseM2s() +
+                                     weights.overshoot * score.overshootM() +
+                                     weights.settling * score.settlingS() + weights.energy * cost.energy_hover_s +
+                                     (failed ? weights.failure : 0.0);
+        if (monotone_cost > abort_above) {
+            cost.aborted = true;
+            break;
+        }
+    }
+    if (!finished && !cost.aborted) {
+        failed = true;  // out of time
+    }
+    score.closeSegment();
+    cost.ise_m2s = score.iseM2s();
+    cost.overshoot_m = score.overshootM();
+    cost.settling_s = score.settlingS();
+    cost.failures = failed ? 1 : 0;
+    cost.total = weights.ise * cost.ise_m2s + weights.overshoot * cost.overshoot_m +
+                 weights.settling * cost.settling_s + weights.energy * cost.energy_hover_s +
+                 weights.failure * static_cast<double>(cost.failures);
+    return cost;
+}
+
+}  // namespace
+
+std::vector<TunableGain> tunableGains(std::uint32_t groups) {
+    std::vector<TunableGain> gains;
+    if (groups & kAltitudeGains) {
+        gains.insert(gains.end(), std::begin(kAltitudeGainTable), std::end(kAltitudeGainTable));
+    }
+    if (groups & kPositionGains) {
+        gains.insert(gains.end(), std::begin(kPositionGainTable), std::end(kPositionGainTable));
+    }
+    if (groups & kAttitudeGains) {
+        gains.insert(gains.end(), std::begin(kAttitudeGainTable), std::end(kAttitudeGainTable));
+    }
+    return gains;
+}
+
+std::vector<double> normalizeGains(const std::vector<TunableGain>& gains,
+                                   const AltitudeControllerConfig& alt_config,
+                                   const AttitudeControllerConfig& att_config) {
+    AltitudeControllerConfig alt = alt_config;
+    AttitudeControllerConfig att = att_config;
+    std::vector<double> unit_point;
+    unit_point.reserve(gains.size());
+    for (const auto& gain : gains) {
+        unit_point.push_back(toUnit(gain, gain.access(alt, att)));
+    }
+    return unit_point;
+}
+
+void applyNormalizedGains(const std::vector<TunableGain>& gains,
+                          const std::vector<double>& unit_point,
+                          AltitudeControllerConfig& alt_config,
+                          AttitudeControllerConfig& att_config) {
+    for (std::size_t i = 0; i < gains.size() && i < unit_point.size(); ++i) {
+        gains[i].access(alt_config, att_config) = fromUnit(gains[i], unit_point[i]);
+    }
+}
+
+TuningCost evaluateFlight(const TuningPlant& plant,
+                          const AltitudeControllerConfig& alt_config,
+                          const AttitudeControllerConfig& att_config,
+                          const TuningScenario& scenario,
+                          const TuningFlightOptions& options,
+                          const TuningCostWeights& weights,
+                          double abort_above,
+                          double prior_cost) {
+    drone::simulator::config::WeatherConfig weather_config = plant.weather;
+    weather_config.random_seed = scenario.weather_seed;
+
+    if (plant.surrogate) {
+        SurrogateVehicle vehicle(*plant.surrogate, options.dt_s);
+        drone::simulator::environment::WeatherModel weather_model;
+        weather_model.setConfig(weather_config);
+        // wind acts through the same linear drag the model was linearized with
+        const double drag_per_mass = -plant.surrogate->a[0];
+        const auto step = [&](double time_s) {
+            const auto sample = weather_model.sample(time_s, vehicle.getPositionEnu());
+            vehicle.setDisturbanceAccelerationEnu(sample.total_accel_enu_ms2 +
+                                                  sample.wind_velocity_enu_mps * drag_per_mass);
+            vehicle.step();
+        };
+        return fly(vehicle, step, alt_config, att_config, scenario, options, weights, abort_above, prior_cost);
+    }
+
+    auto sim = drone::simulator::QuadroSimulationFactory(0, options.dt_s);
+    sim->setTelemetryLogFile("");  // an empty name leaves the telemetry CSV closed
+    sim->setBatteryConfig(plant.battery);
+    sim->setWeatherConfig(weather_config);
+    sim->start();
+    const auto step = [&](double) { sim->step(options.dt_s); };
+    TuningCost cost = fly(*sim, step, alt_config, att_config, scenario, options, weights, abort_above, prior_cost);
+    sim->stop();
+    return cost;
+}
+
+TuningCost evaluateScenarios(const TuningPlant& plant,
+                             const AltitudeControllerConfig& alt_config,
+                             const AttitudeControllerConfig& att_config,
+                             const std::vector<TuningScenario>& scenarios,
+                             const TuningFlightOptions& options,
+                             const TuningCostWeights& weights,
+                             double abort_above) {
+    TuningCost sum;
+    for (const auto& scenario : scenarios) {
+        const TuningCost cost =
+            evaluateFlight(plant, alt_config, att_config, scenario, options, weights, abort_above, sum.total);
+        sum.ise_m2s += cost.ise_m2s;
+        sum.overshoot_m += cost.overshoot_m;
+        sum.settling_s += cost.settling_s;
+        sum.energy_hover_s += cost.energy_hover_s;
+        sum.failures += cost.failures;
+        sum.flown_s += cost.flown_s;
+        sum.total += cost.total;
+        if (cost.aborted) {
+            sum.aborted = true;
+            sum.total = std::max(sum.total, abort_above);
+            break;
+        }
+    }
+    return sum;
+}
+
+bool writeTunedGains(const std::vector<TunableGain>& gains,
+                     const AltitudeControllerConfig& alt_config,
+                     const AttitudeControllerConfig& att_config,
+                     const std::string& section,
+                     const std::string& source_file,
+                     const std::string& out_file,
+                     const std::string& header_comment) {
+    YAML::Node root;
+    try {
+        root = YAML::LoadFile(source_file);
+    } catch (const YAML::Exception&) {
+        root = YAML::Node(YAML::NodeType::Map);
+    }
+    AltitudeControllerConfig alt = alt_config;
+    AttitudeControllerConfig att = att_config;
+    for (const auto& gain : gains) {
+        if (section == gain.section) {
+            // six significant digits keep the file readable; the tuner's resolution is far coarser
+            std::ostringstream value;
+            value << std::setprecision(6) << gain.access(alt, att);
+            root[section][gain.key] = value.str();
+        }
+    }
+
+    YAML::Emitter out;
+    out << YAML::Comment(header_comment) << YAML::Newline << root;
+    std::ofstream file(out_file, std::ios::trunc);
+    file << out.c_str() << "\n";
+    return static_cast<bool>(file);
+}
+
+}  // namespace drone::simulator::runtime
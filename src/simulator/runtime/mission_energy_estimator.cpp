@@ -0,0 +1,347 @@
+#include "simulator/runtime/mission_energy_estimator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "drone/mission/mission_program.h"
+#include "drone/mission/mission_triggers.h"
+#include "drone/runtime/real_drone.h"
+
+namespace drone::simulator::runtime {
+
+using drone::mission::ActionType;
+using drone::mission::AdvanceMode;
+using drone::mission::FlatMissionStep;
+using drone::mission::TimeoutBehavior;
+
+struct MissionEnergyEstimator::State {
+    double time_s = 0.0;
+    double soc_percent = 100.0;
+    double energy_wh = 0.0;
+    double reserve_time_s = -1.0;
+    double x_m = 0.0;
+    double y_m = 0.0;
+    double altitude_m = 0.0;
+};
+
+namespace {
+
+const char* missionEnergyVehicleProblem(const MissionEnergyVehicle& vehicle) {
+    if (!(vehicle.mass_kg > 0.0)) {
+        return "mass_kg must be positive";
+    }
+    if (vehicle.rotor_count == 0 || !(vehicle.thrust_per_rpm2_n > 0.0)) {
+        return "needs rotors with a positive thrust_per_rpm2_n";
+    }
+    if (!(vehicle.motor_max_speed_rpm > 0.0) || !(vehicle.motor_max_current_a >= 0.0) ||
+        !(vehicle.motor_efficiency > 0.0)) {
+        return "motor max speed and efficiency must be positive";
+    }
+    if (vehicle.series_cells <= 0 || vehicle.parallel_cells <= 0 || !(vehicle.cell_capacity_mah > 0.0)) {
+        return "pack needs series_cells, parallel_cells and cell_capacity_mah above zero";
+    }
+    return nullptr;
+}
+
+// A constant-thrust piece of a step; `transit` pieces move the vehicle towards the step target
+struct Phase {
+    double duration_s = 0.0;
+    double thrust_n = 0.0;
+    bool transit = false;
+};
+
+}  // namespace
+
+std::string missionEnergyOutcomeToString(MissionEnergyOutcome outcome) {
+    switch (outcome) {
+        case MissionEnergyOutcome::COMPLETED:
+            return "COMPLETED";
+        case MissionEnergyOutcome::ABORTED:
+            return "ABORTED";
+        case MissionEnergyOutcome::BATTERY_EMPTY:
+            return "BATTERY_EMPTY";
+        case MissionEnergyOutcome::STEP_LIMIT:
+            return "STEP_LIMIT";
+        case MissionEnergyOutcome::INVALID_VEHICLE:
+            return "INVALID_VEHICLE";
+    }
+    return "UNKNOWN";
+}
+
+MissionEnergyEstimator::MissionEnergyEstimator(const MissionEnergyVehicle& vehicle, const MissionEnergyTiming& timing)
+    : vehicle_(vehicle), timing_(timing), vehicle_problem_(missionEnergyVehicleProblem(vehicle)) {}
+
+double MissionEnergyEstimator::packCurrentA(double total_thrust_n) const {
+    if (vehicle_.rotor_count == 0 || vehicle_.thrust_per_rpm2_n <= 0.0 || total_thrust_n <= 0.0) {
+        return 0.0;
+    }
+    // T = k * rpm^2 per rotor; MotorPhysics::calculateCurrent is linear in RPM
+    const double rpm = std::sqrt(total_thrust_n / static_cast<double>(vehicle_.rotor_count) / vehicle_.thrust_per_rpm2_n);
+    const double motor_current_a = std::min(
+        rpm / vehicle_.motor_max_speed_rpm * vehicle_.motor_max_current_a / vehicle_.motor_efficiency,
+        vehicle_.motor_max_current_a);
+    return motor_current_a * static_cast<double>(vehicle_.rotor_count);
+}
+
+double MissionEnergyEstimator::cruiseSpeedMps(double max_tilt_rad) const {
+    if (vehicle_.damping_n_per_mps <= 0.0) {
+        return 0.0;
+    }
+    return vehicle_.mass_kg * kGravityMs2 * std::tan(max_tilt_rad) / vehicle_.damping_n_per_mps;
+}
+
+void MissionEnergyEstimator::fly(State& state, double duration_s, double total_thrust_n) const {
+    if (duration_s <= 0.0 || state.soc_percent <= 0.0) {
+        return;
+    }
+    // constant-current discharge, as BatterySim::advance
+    const double cell_current_a = packCurrentA(total_thrust_n) / vehicle_.parallel_cells;
+    const double soc_rate_percent_per_s = cell_current_a / 3.6 / vehicle_.cell_capacity_mah * 100.0;
+    const double soc_end_percent = std::max(0.0, state.soc_percent - soc_rate_percent_per_s * duration_s);
+
+    if (state.reserve_time_s < 0.0 && soc_end_percent <= timing_.reserve_soc_percent) {
+        // an idle pack only gets here when it already sits at the reserve
+        state.reserve_time_s =
+            soc_rate_percent_per_s > 0.0
+                ? state.time_s + std::max(0.0, state.soc_percent - timing_.reserve_soc_percent) / soc_rate_percent_per_s
+                : state.time_s;
+    }
+    const double cell_count = static_cast<double>(vehicle_.series_cells * vehicle_.parallel_cells);
+    state.energy_wh +=
+        cell_count * vehicle_.cell_capacity_mah / 1000.0 / 100.0 *
+        vehicle_.ocv_table.integrate(soc_end_percent, state.soc_percent);
+    state.soc_percent = soc_end_percent;
+    state.time_s += duration_s;
+}
+
+bool MissionEnergyEstimator::flyStep(State& state, const FlatMissionStep& step) const {
+    if (!step.enabled) {
+        return false;
+    }
+    const auto& action = step.action;
+    const double weight_n = vehicle_.mass_kg * kGravityMs2;
+    const double drag = vehicle_.damping_n_per_mps;
+
+    // step target
+    double target_x_m = state.x_m;
+    double target_y_m = state.y_m;
+    double target_altitude_m = state.altitude_m;
+    bool min_jerk = false;
+    double max_tilt_rad = timing_.max_tilt_rad;
+    switch (step.actionType()) {
+        case ActionType::HOVER:
+        case ActionType::CHANGE_ALTITUDE:
+            target_altitude_m = action.target_altitude_m;
+            break;
+        case ActionType::GO_TO_POSITION:
+            target_x_m = action.target_x_m;
+            target_y_m = action.target_y_m;
+            target_altitude_m = action.target_altitude_m;  // AGL legs assume flat ground
+            min_jerk = step.min_jerk_trajectory != 0;
+            max_tilt_rad = std::min(action.max_tilt_rad, timing_.max_tilt_rad);
+            break;
+        case ActionType::LAND:
+            target_altitude_m = 0.0;
+            break;
+        case ActionType::SET_ATTITUDE:
+        case ActionType::ROTATE_YAW:
+            break;
+    }
+
+    // vertical transit at the reference rate limit; drag adds to (or relieves) the weight
+    const double dz_m = target_altitude_m - state.altitude_m;
+    const double vertical_speed_mps = dz_m >= 0.0 ? timing_.climb_rate_mps : -timing_.descent_rate_mps;
+    const double vertical_time_s = std::abs(dz_m) / std::max(std::abs(vertical_speed_mps), 1e-3);
+    const double vertical_thrust_n = std::max(0.0, weight_n + drag * vertical_speed_mps);
+
+    // horizontal transit: trapezoidal speed profile at the speed where the tilt balances drag
+    const double distance_m = std::hypot(target_x_m - state.x_m, target_y_m - state.y_m);
+    double cruise_speed_mps = cruiseSpeedMps(max_tilt_rad);
+    double acceleration_mps2 = kGravityMs2 * std::tan(max_tilt_rad);
+    if (min_jerk) {
+        // the planner honours max_velocity_mps and keeps half the tilt for tracking
+        cruise_speed_mps = std::min(cruise_speed_mps, action.max_velocity_mps);
+        acceleration_mps2 *= 0.5;
+    }
+    double horizontal_time_s = 0.0;
+    if (distance_m > 0.0 && cruise_speed_mps > 0.0 && acceleration_mps2 > 0.0) {
+        horizontal_time_s = distance_m >= cruise_speed_mps * cruise_speed_mps / acceleration_mps2
+                                ? distance_m / cruise_speed_mps + cruise_speed_mps / acceleration_mps2
+                                : 2.0 * std::sqrt(distance_m / acceleration_mps2);
+    }
+    const double horizontal_drag_n = drag * cruise_speed_mps;
+
+    Phase phases[3];
+    const double overlap_s = std::min(vertical_time_s, horizontal_time_s);
+    phases[0] = Phase{overlap_s, std::hypot(vertical_thrust_n, horizontal_drag_n), true};
+    phases[1] = vertical_time_s > horizontal_time_s
+                    ? Phase{vertical_time_s - overlap_s, vertical_thrust_n, true}
+                    : Phase{horizontal_time_s - overlap_s, std::hypot(weight_n, horizontal_drag_n), true};
+    const double transit_time_s = phases[0].duration_s + phases[1].duration_s;
+
+    // settle inside the completion tolerances (nothing to settle after no transit) and hold;
+    // a landed vehicle idles
+    const bool on_ground = target_altitude_m <= 0.0;
+    const double hold_thrust_n = on_ground ? 0.0 : weight_n;
+    double settle_time_s = timing_.settle_time_s;
+    if (on_ground || transit_time_s <= 0.0) {
+        settle_time_s = 0.0;
+    } else if (step.actionType() == ActionType::GO_TO_POSITION) {
+        settle_time_s = min_jerk ? timing_.trajectory_leg_settle_time_s : timing_.leg_settle_time_s;
+    }
+    double step_time_s = step.duration_s;
+    if (step.advanceMode() == AdvanceMode::COMPLETION_BASED) {
+        step_time_s = transit_time_s + settle_time_s + step.completion_criteria.hold_duration_s;
+    }
+    const bool timed_out = step_time_s > step.timeout_s;
+    step_time_s = std::min(step_time_s, step.timeout_s);
+    phases[2] = Phase{std::max(0.0, step_time_s - transit_time_s), hold_thrust_n, false};
+
+    double remaining_s = step_time_s;
+    double transit_flown_s = 0.0;
+    for (const Phase& phase : phases) {
+        const double duration_s = std::min(phase.duration_s, remaining_s);
+        fly(state, duration_s, phase.thrust_n);
+        remaining_s -= duration_s;
+        if (phase.transit) {
+            transit_flown_s += duration_s;
+        }
+    }
+
+    const double progress = transit_time_s > 0.0 ? std::min(1.0, transit_flown_s / transit_time_s) : 1.0;
+    state.x_m += (target_x_m - state.x_m) * progress;
+    state.y_m += (target_y_m - state.y_m) * progress;
+    state.altitude_m += (target_altitude_m - state.altitude_m) * progress;
+    return timed_out;
+}
+
+MissionEnergyEstimate MissionEnergyEstimator::estimate(const drone::mission::MissionImage& image) const {
+    using drone::mission::MissionTriggerAction;
+    using drone::mission::MissionVmState;
+
+    MissionEnergyEstimate result;
+    if (!valid()) {
+        result.outcome = MissionEnergyOutcome::INVALID_VEHICLE;
+        return result;
+    }
+    State state;
+    const auto initial = image.initialConditions();
+    state.soc_percent = std::min(vehicle_.initial_soc_percent, initial.battery_soc_percent);
+    state.x_m = initial.position_enu_m.x;
+    state.y_m = initial.position_enu_m.y;
+    state.altitude_m = initial.altitude_m;
+
+    const auto frame_of = [this](const State& s) {
+        drone::runtime::SensorFrame frame;
+        frame.altitude_m = s.altitude_m;
+        frame.altitude_agl_m = s.altitude_m;
+        frame.position_enu_x_m = s.x_m;
+        frame.position_enu_y_m = s.y_m;
+        frame.position_enu_z_m = s.altitude_m;
+        frame.gps_altitude_m = s.altitude_m;
+        frame.battery_soc_percent = s.soc_percent;
+        frame.battery_voltage_v = vehicle_.series_cells * vehicle_.ocv_table.voltageV(s.soc_percent);
+        return frame;
+    };
+
+    const bool has_program = image.instructionCount() > 0;
+    drone::mission::MissionVm vm;
+    vm.reset();
+    bool program_running = has_program;
+
+    drone::mission::MissionTriggerMonitor trigger_monitor;
+    const bool has_triggers = image.triggerCount() > 0;
+    if (has_triggers) {
+        trigger_monitor.reset(image.triggerTable());
+    }
+
+    std::size_t next_index = 0;
+    bool done = false;
+    // triggers are checked once before the first step and then after every step
+    bool check_triggers = has_triggers;
+    while (!done) {
+        if (check_triggers) {
+            const int fired = drone::mission::selectMissionTrigger(
+                image.triggerTable(), trigger_monitor.update(image.triggerTable(), frame_of(state)));
+            if (fired >= 0) {
+                const auto& trigger = image.triggers()[fired];
+                if (static_cast<MissionTriggerAction>(trigger.action) == MissionTriggerAction::ABORT) {
+                    result.outcome = MissionEnergyOutcome::ABORTED;
+                    break;
+                }
+                program_running = false;
+                next_index = trigger.step_index;
+            }
+        }
+        check_triggers = has_triggers;
+
+        std::size_t step_index = next_index;
+        if (program_running) {
+            drone::mission::MissionVmResult vm_result;
+            std::size_t yields = 0;
+            do {
+                vm_result = vm.run(image.instructions(), image.instructionCount(), frame_of(state),
+                                   drone::mission::kDefaultMissionVmBudget);
+            } while (vm_result.state == MissionVmState::YIELD && ++yields < timing_.max_steps);
+            if (vm_result.state == MissionVmState::DONE) {
+                break;
+            }
+            if (vm_result.state != MissionVmState::STEP) {
+                result.outcome = vm_result.state == MissionVmState::ABORTED ? MissionEnergyOutcome::ABORTED
+                                                                           : MissionEnergyOutcome::STEP_LIMIT;
+                break;
+            }
+            step_index = vm_result.step_index;
+        } else if (step_index >= image.stepCount()) {
+            break;
+        }
+        if (result.steps.size() >= timing_.max_steps) {
+            result.outcome = MissionEnergyOutcome::STEP_LIMIT;
+            break;
+        }
+
+        const FlatMissionStep& step = image.step(step_index);
+        const int attempts = step.timeoutBehavior() == TimeoutBehavior::RETRY ? step.retry_count + 1 : 1;
+        for (int attempt = 0; attempt < attempts; ++attempt) {
+            StepEnergyEstimate entry;
+            entry.step_id = step.step_id;
+            entry.start_time_s = state.time_s;
+            const double energy_before_wh = state.energy_wh;
+            entry.timed_out = flyStep(state, step);
+            entry.duration_s = state.time_s - entry.start_time_s;
+            entry.energy_wh = state.energy_wh - energy_before_wh;
+            entry.end_soc_percent = state.soc_percent;
+            result.steps.push_back(entry);
+            if (result.reserve_step_index < 0 && state.reserve_time_s >= 0.0) {
+                result.reserve_step_index = static_cast<int>(result.steps.size()) - 1;
+                result.reserve_while_landing = step.actionType() == ActionType::LAND;
+            }
+            if (!entry.timed_out) {
+                break;
+            }
+        }
+
+        if (state.soc_percent <= 0.0) {
+            break;  // motors stop; nothing after this point is flown
+        }
+        if (result.steps.back().timed_out && step.timeoutBehavior() != TimeoutBehavior::PROCEED) {
+            result.outcome = MissionEnergyOutcome::ABORTED;
+            break;
+        }
+        next_index = step_index + 1;
+    }
+
+    if (result.outcome == MissionEnergyOutcome::COMPLETED && state.reserve_time_s >= 0.0) {
+        result.outcome = MissionEnergyOutcome::BATTERY_EMPTY;
+    }
+    result.duration_s = state.time_s;
+    result.energy_wh = state.energy_wh;
+    result.final_soc_percent = state.soc_percent;
+    result.reserve_time_s = state.reserve_time_s;
+    const double charge_ah = (std::min(vehicle_.initial_soc_percent, initial.battery_soc_percent) - state.soc_percent) /
+                             100.0 * vehicle_.cell_capacity_mah * vehicle_.parallel_cells / 1000.0;
+    result.average_current_a = state.time_s > 0.0 ? charge_ah * 3600.0 / state.time_s : 0.0;
+    return result;
+}
+
+}  // namespace drone::simulator::runtime
@@ -0,0 +1,196 @@
+#include "simulator/runtime/separable_cma_es.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <thread>
+
+namespace drone::simulator::runtime {
+
+namespace {
+
+struct Candidate {
+    std::vector<double> point;
+    double cost = 0.0;
+    bool aborted = false;
+};
+
+void evaluateAll(std::vector<Candidate>& candidates, const BoundedCostFunction& cost, double abort_above,
+                 std::size_t threads) {
+    std::atomic<std::size_t> next{0};
+    const auto worker = [&] {
+        for (std::size_t i = next++; i < candidates.size(); i = next++) {
+            bool aborted = false;
+            candidates[i].cost = cost(candidates[i].point, abort_above, &aborted);
+            candidates[i].aborted = aborted;
+        }
+    };
+    const std::size_t worker_count = std::min(threads, candidates.size());
+    std::vector<std::thread> pool;
+    pool.reserve(worker_count > 0 ? worker_count - 1 : 0);
+    for (std::size_t i = 1; i < worker_count; ++i) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+}
+
+}  // namespace
+
+SeparableCmaEsResult minimizeSeparableCmaEs(
+    const std::vector<double>& start_point,
+    const BoundedCostFunction& cost,
+    const SeparableCmaEsOptions& options,
+    const std::function<void(const SeparableCmaEsGeneration&)>& on_generation) {
+    const std::size_t n = start_point.size();
+    const double dimension = static_cast<double>(n);
+    SeparableCmaEsResult result;
+    result.best_point = start_point;
+    for (double& value : result.best_point) {
+        value = std::clamp(value, 0.0, 1.0);
+    }
+    bool start_aborted = false;
+    result.start_cost = cost(result.best_point, std::numeric_limits<double>::infinity(), &start_aborted);
+    result.best_cost = result.start_cost;
+    result.evaluations = 1;
+    if (n == 0) {
+        return result;
+    }
+
+    std::size_t threads = options.threads;
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // strategy parameters (Hansen's defaults, learning rates scaled by (n + 2) / 3 for the diagonal model)
+    const std::size_t lambda =
+        options.population > 0 ? std::max<std::size_t>(options.population, 2)
+                               : 4 + static_cast<std::size_t>(std::floor(3.0 * std::log(dimension)));
+    const std::size_t mu = lambda / 2;
+    std::vector<double> weights(mu);
+    for (std::size_t i = 0; i < mu; ++i) {
+        weights[i] = std::log(static_cast<double>(mu) + 0.5) - std::log(static_cast<double>(i + 1));
+    }
+    const double weight_sum = std::accumulate(weights.begin(), weights.end(), 0.0);
+    double weight_square_sum = 0.0;
+    for (double& weight : weights) {
+        weight /= weight_sum;
+        weight_square_sum += weight * weight;
+    }
+    const double mu_eff = 1.0 / weight_square_sum;
+    const double c_sigma = (mu_eff + 2.0) / (dimension + mu_eff + 5.0);
+    const double d_sigma =
+        1.0 + 2.0 * std::max(0.0, std::sqrt((mu_eff - 1.0) / (dimension + 1.0)) - 1.0) + c_sigma;
+    const double c_c = (4.0 + mu_eff / dimension) / (dimension + 4.0 + 2.0 * mu_eff / dimension);
+    const double separable_scale = (dimension + 2.0) / 3.0;
+    double c_1 = separable_scale * 2.0 / ((dimension + 1.3) * (dimension + 1.3) + mu_eff);
+    double c_mu = separable_scale * 2.0 * (mu_eff - 2.0 + 1.0 / mu_eff) /
+                  ((dimension + 2.0) * (dimension + 2.0) + mu_eff);
+    c_1 = std::min(c_1, 1.0);
+    c_mu = std::clamp(c_mu, 0.0, 1.0 - c_1);
+    const double expected_norm =
+        std::sqrt(dimension) * (1.0 - 1.0 / (4.0 * dimension) + 1.0 / (21.0 * dimension * dimension));
+
+    std::vector<double> mean = result.best_point;
+    std::vector<double> variance(n, 1.0);  // diagonal of C
+    std::vector<double> path_sigma(n, 0.0);
+    std::vector<double> path_c(n, 0.0);
+    double sigma = options.initial_step;
+
+    std::mt19937 rng(options.seed);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::vector<Candidate> candidates(lambda);
+    std::vector<std::size_t> order(lambda);
+    std::vector<double> step(n);
+
+    for (std::size_t generation = 0; generation < options.generations; ++generation) {
+        for (auto& candidate : candidates) {
+            candidate.point.resize(n);
+            for (std::size_t j = 0; j < n; ++j) {
+                const double sample = mean[j] + sigma * std::sqrt(variance[j]) * normal(rng);
+                candidate.point[j] = std::clamp(sample, 0.0, 1.0);
+            }
+        }
+        const double abort_above = options.abort_ratio > 0.0 && std::isfinite(result.best_cost)
+                                       ? options.abort_ratio * result.best_cost
+                                       : std::numeric_limits<double>::infinity();
+        evaluateAll(candidates, cost, abort_above, threads);
+        result.evaluations += lambda;
+
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) {
+            return candidates[lhs].cost < candidates[rhs].cost;
+        });
+        std::size_t aborted = 0;
+        for (const auto& candidate : candidates) {
+            aborted += candidate.aborted ? 1 : 0;
+        }
+        result.aborted_evaluations += aborted;
+        const Candidate& generation_best = candidates[order.front()];
+        if (!generation_best.aborted && generation_best.cost < result.best_cost) {
+            result.best_cost = generation_best.cost;
+            result.best_point = generation_best.point;
+        }
+
+        // recombination; step is the weighted mean displacement in units of sigma
+        std::vector<double> new_mean(n, 0.0);
+        for (std::size_t i = 0; i < mu; ++i) {
+            const auto& point = candidates[order[i]].point;
+            for (std::size_t j = 0; j < n; ++j) {
+                new_mean[j] += weights[i] * point[j];
+            }
+        }
+        double path_sigma_norm_sq = 0.0;
+        const double sigma_gain = std::sqrt(c_sigma * (2.0 - c_sigma) * mu_eff);
+        for (std::size_t j = 0; j < n; ++j) {
+            step[j] = (new_mean[j] - mean[j]) / sigma;
+            path_sigma[j] = (1.0 - c_sigma) * path_sigma[j] + sigma_gain * step[j] / std::sqrt(variance[j]);
+            path_sigma_norm_sq += path_sigma[j] * path_sigma[j];
+        }
+        const double path_sigma_norm = std::sqrt(path_sigma_norm_sq);
+        const double sigma_decay = 1.0 - std::pow(1.0 - c_sigma, 2.0 * static_cast<double>(generation + 1));
+        const bool h_sigma =
+            path_sigma_norm / std::sqrt(sigma_decay) < (1.4 + 2.0 / (dimension + 1.0)) * expected_norm;
+        const double c_gain = h_sigma ? std::sqrt(c_c * (2.0 - c_c) * mu_eff) : 0.0;
+
+        double max_scale = 0.0;
+        for (std::size_t j = 0; j < n; ++j) {
+            path_c[j] = (1.0 - c_c) * path_c[j] + c_gain * step[j];
+            double rank_mu = 0.0;
+            for (std::size_t i = 0; i < mu; ++i) {
+                const double y = (candidates[order[i]].point[j] - mean[j]) / sigma;
+                rank_mu += weights[i] * y * y;
+            }
+            const double stall_correction = h_sigma ? 0.0 : c_c * (2.0 - c_c) * variance[j];
+            variance[j] = (1.0 - c_1 - c_mu) * variance[j] + c_1 * (path_c[j] * path_c[j] + stall_correction) +
+                          c_mu * rank_mu;
+            variance[j] = std::max(variance[j], 1e-20);
+            max_scale = std::max(max_scale, std::sqrt(variance[j]));
+        }
+        mean = std::move(new_mean);
+        sigma *= std::exp((c_sigma / d_sigma) * (path_sigma_norm / expected_norm - 1.0));
+        sigma = std::min(sigma, 1.0);  // the whole box is one unit wide
+        result.generations = generation + 1;
+
+        if (on_generation) {
+            SeparableCmaEsGeneration report;
+            report.generation = generation;
+            report.best_cost = result.best_cost;
+            report.generation_best_cost = generation_best.cost;
+            report.aborted = aborted;
+            report.step_size = sigma;
+            on_generation(report);
+        }
+        if (sigma * max_scale < options.min_step) {
+            break;
+        }
+    }
+    return result;
+}
+
+}  // namespace drone::simulator::runtime
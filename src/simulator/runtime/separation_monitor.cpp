@@ -0,0 +1,160 @@
+#include "simulator/runtime/separation_monitor.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace drone::simulator::runtime {
+
+namespace {
+
+std::uint32_t hashCell(std::int64_t x, std::int64_t y, std::int64_t z) {
+    // Teschner et al. spatial hash primes
+    const auto h = static_cast<std::uint64_t>(x) * 73856093ULL ^
+                   static_cast<std::uint64_t>(y) * 19349663ULL ^
+                   static_cast<std::uint64_t>(z) * 83492791ULL;
+    return static_cast<std::uint32_t>(h ^ (h >> 32));
+}
+
+// the 13 neighbour cells lexicographically after (0, 0, 0), as {dx, dy, dz}
+constexpr int kForwardNeighbours[13][3] = {
+    {1, 0, 0},
+    {-1, 1, 0}, {0, 1, 0}, {1, 1, 0},
+    {-1, -1, 1}, {0, -1, 1}, {1, -1, 1},
+    {-1, 0, 1}, {0, 0, 1}, {1, 0, 1},
+    {-1, 1, 1}, {0, 1, 1}, {1, 1, 1},
+};
+
+std::uint64_t pairKey(std::uint32_t a, std::uint32_t b) {
+    return (static_cast<std::uint64_t>(a) << 32) | b;
+}
+
+}  // namespace
+
+SeparationMonitor::SeparationMonitor(const SeparationConfig& config) : config_(config) {
+    config_.collision_distance_m = std::max(0.0, config_.collision_distance_m);
+    config_.near_miss_distance_m = std::max(config_.near_miss_distance_m, config_.collision_distance_m);
+    const double cell_size_m = config_.near_miss_distance_m > 0.0 ? config_.near_miss_distance_m : 1.0;
+    inverse_cell_size_ = 1.0 / cell_size_m;
+}
+
+std::uint32_t SeparationMonitor::addVehicle(const drone::Vector3* position_enu_m) {
+    positions_.push_back(position_enu_m);
+    return static_cast<std::uint32_t>(positions_.size() - 1);
+}
+
+void SeparationMonitor::rebuildGrid() {
+    const std::size_t count = positions_.size();
+    std::uint32_t bucket_count = 1;
+    while (bucket_count < 2 * count) {
+        bucket_count <<= 1;
+    }
+    bucket_mask_ = bucket_count - 1;
+
+    snapshot_.resize(count);
+    cell_x_.resize(count);
+    cell_y_.resize(count);
+    cell_z_.resize(count);
+    bucket_of_.resize(count);
+    sorted_.resize(count);
+    bucket_start_.assign(bucket_count + 1, 0);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        snapshot_[i] = *positions_[i];
+        cell_x_[i] = static_cast<std::int64_t>(std::floor(snapshot_[i].x * inverse_cell_size_));
+        cell_y_[i] = static_cast<std::int64_t>(std::floor(snapshot_[i].y * inverse_cell_size_));
+        cell_z_[i] = static_cast<std::int64_t>(std::floor(snapshot_[i].z * inverse_cell_size_));
+        bucket_of_[i] = hashCell(cell_x_[i], cell_y_[i], cell_z_[i]) & bucket_mask_;
+        ++bucket_start_[bucket_of_[i] + 1];
+    }
+    for (std::uint32_t b = 0; b < bucket_count; ++b) {
+        bucket_start_[b + 1] += bucket_start_[b];
+    }
+    bucket_fill_.assign(bucket_start_.begin(), bucket_start_.end() - 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        sorted_[bucket_fill_[bucket_of_[i]]++] = static_cast<std::uint32_t>(i);
+    }
+}
+
+void SeparationMonitor::testPair(std::uint32_t i, std::uint32_t j) {
+    ++last_pairs_tested_;
+    const drone::Vector3& p = snapshot_[i];
+    const drone::Vector3& q = snapshot_[j];
+    const double ex = q.x - p.x;
+    const double ey = q.y - p.y;
+    const double ez = q.z - p.z;
+    const double distance_sq = ex * ex + ey * ey + ez * ez;
+    if (distance_sq > near_miss_sq_) {
+        return;
+    }
+
+    const std::uint32_t a = std::min(i, j);
+    const std::uint32_t b = std::max(i, j);
+    const std::uint8_t level = distance_sq <= collision_sq_ ? 2 : 1;
+    const std::uint64_t key = pairKey(a, b);
+    const auto previous = active_pairs_.find(key);
+    const std::uint8_t previous_level = previous == active_pairs_.end() ? 0 : previous->second;
+    next_active_pairs_[key] = std::max(level, previous_level);
+    if (level > previous_level) {
+        SeparationEvent event;
+        event.type = level == 2 ? SeparationEventType::COLLISION : SeparationEventType::NEAR_MISS;
+        event.vehicle_a = a;
+        event.vehicle_b = b;
+        event.distance_m = std::sqrt(distance_sq);
+        events_.push_back(event);
+    }
+}
+
+const std::vector<SeparationEvent>& SeparationMonitor::update() {
+    events_.clear();
+    next_active_pairs_.clear();
+    last_pairs_tested_ = 0;
+    if (positions_.size() < 2) {
+        active_pairs_.clear();
+        return events_;
+    }
+
+    rebuildGrid();
+
+    near_miss_sq_ = config_.near_miss_distance_m * config_.near_miss_distance_m;
+    collision_sq_ = config_.collision_distance_m * config_.collision_distance_m;
+
+    for (std::uint32_t i = 0; i < positions_.size(); ++i) {
+        // own cell: later vehicles only; forward half of the neighbours: every vehicle.
+        // Each pair in adjacent cells is then visited from exactly one side.
+        const std::uint32_t own_bucket = bucket_of_[i];
+        for (std::uint32_t k = bucket_start_[own_bucket]; k < bucket_start_[own_bucket + 1]; ++k) {
+            const std::uint32_t j = sorted_[k];
+            if (j > i && cell_x_[j] == cell_x_[i] && cell_y_[j] == cell_y_[i] && cell_z_[j] == cell_z_[i]) {
+                testPair(i, j);
+            }
+        }
+        for (const auto& offset : kForwardNeighbours) {
+            const std::int64_t cx = cell_x_[i] + offset[0];
+            const std::int64_t cy = cell_y_[i] + offset[1];
+            const std::int64_t cz = cell_z_[i] + offset[2];
+            const std::uint32_t bucket = hashCell(cx, cy, cz) & bucket_mask_;
+            for (std::uint32_t k = bucket_start_[bucket]; k < bucket_start_[bucket + 1]; ++k) {
+                const std::uint32_t j = sorted_[k];
+                // a bucket can also hold unrelated cells that hash to it
+                if (cell_x_[j] == cx && cell_y_[j] == cy && cell_z_[j] == cz) {
+                    testPair(i, j);
+                }
+            }
+        }
+    }
+
+    active_pairs_.swap(next_active_pairs_);
+    return events_;
+}
+
+std::string separationEventTypeToString(SeparationEventType type) {
+    switch (type) {
+        case SeparationEventType::NEAR_MISS:
+            return "NEAR_MISS";
+        case SeparationEventType::COLLISION:
+            return "COLLISION";
+    }
+    return "UNKNOWN";
+}
+
+}  // namespace drone::simulator::runtime
@@ -0,0 +1,197 @@
+#include "simulator/runtime/surrogate_vehicle.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace drone::simulator::runtime {
+
+namespace {
+
+constexpr std::size_t kN = kSurrogateStateCount;
+constexpr std::size_t kM = kSurrogateInputCount;
+constexpr std::size_t kAugmented = kN + kM;
+
+using AugmentedMatrix = std::vector<double>;  // kAugmented x kAugmented, row-major
+
+AugmentedMatrix multiply(const AugmentedMatrix& lhs, const AugmentedMatrix& rhs) {
+    AugmentedMatrix out(kAugmented * kAugmented, 0.0);
+    for (std::size_t i = 0; i < kAugmented; ++i) {
+        for (std::size_t k = 0; k < kAugmented; ++k) {
+            const double lhs_ik = lhs[i * kAugmented + k];
+            if (lhs_ik == 0.0) {
+                continue;
+            }
+            for (std::size_t j = 0; j < kAugmented; ++j) {
+                out[i * kAugmented + j] += lhs_ik * rhs[k * kAugmented + j];
+            }
+        }
+    }
+    return out;
+}
+
+// exp(M) by scaling and squaring with a Taylor series; M is small and the call is one-off
+AugmentedMatrix exponential(AugmentedMatrix m) {
+    double norm = 0.0;
+    for (std::size_t i = 0; i < kAugmented; ++i) {
+        double row_sum = 0.0;
+        for (std::size_t j = 0; j < kAugmented; ++j) {
+            row_sum += std::abs(m[i * kAugmented + j]);
+        }
+        norm = std::max(norm, row_sum);
+    }
+    int squarings = 0;
+    while (norm > 0.5) {
+        norm *= 0.5;
+        ++squarings;
+    }
+    const double scale = std::ldexp(1.0, -squarings);
+    for (double& value : m) {
+        value *= scale;
+    }
+
+    AugmentedMatrix result(kAugmented * kAugmented, 0.0);
+    AugmentedMatrix term(kAugmented * kAugmented, 0.0);
+    for (std::size_t i = 0; i < kAugmented; ++i) {
+        result[i * kAugmented + i] = 1.0;
+        term[i * kAugmented + i] = 1.0;
+    }
+    for (int order = 1; order <= 16; ++order) {
+        term = multiply(term, m);
+        for (std::size_t i = 0; i < term.size(); ++i) {
+            term[i] /= order;
+            result[i] += term[i];
+        }
+    }
+    for (int i = 0; i < squarings; ++i) {
+        result = multiply(result, result);
+    }
+    return result;
+}
+
+}  // namespace
+
+SurrogateVehicle::SurrogateVehicle(const SurrogateModel& model, double dt_s)
+    : model_(model), dt_s_(dt_s) {
+    // zero-order hold: exp([[A, B], [0, 0]] dt) = [[Ad, Bd], [0, I]]
+    AugmentedMatrix augmented(kAugmented * kAugmented, 0.0);
+    for (std::size_t i = 0; i < kN; ++i) {
+        for (std::size_t j = 0; j < kN; ++j) {
+            augmented[i * kAugmented + j] = model_.a[i * kN + j] * dt_s_;
+        }
+        for (std::size_t j = 0; j < kM; ++j) {
+            augmented[i * kAugmented + kN + j] = model_.b[i * kM + j] * dt_s_;
+        }
+    }
+    const AugmentedMatrix discrete = exponential(std::move(augmented));
+    for (std::size_t i = 0; i < kN; ++i) {
+        for (std::size_t j = 0; j < kN; ++j) {
+            ad_[i * kN + j] = discrete[i * kAugmented + j];
+        }
+        for (std::size_t j = 0; j < kM; ++j) {
+            bd_[i * kM + j] = discrete[i * kAugmented + kN + j];
+        }
+    }
+    reset(drone::Vector3());
+}
+
+void SurrogateVehicle::reset(const drone::Vector3& position_enu_m) {
+    position_enu_m_ = drone::Vector3(position_enu_m.x, position_enu_m.y, std::max(0.0, position_enu_m.z));
+    velocity_enu_mps_ = drone::Vector3();
+    disturbance_acceleration_enu_ms2_ = drone::Vector3();
+    attitude_ypr_rad_ = drone::AttitudeYPR();
+    rotor_rpm_.fill(position_enu_m_.z > 0.0 ? model_.hover_rpm : 0.0);
+    rotor_rpm_ref_ = rotor_rpm_;
+    updateAttitudeTerms();
+}
+
+drone::runtime::SensorFrame SurrogateVehicle::readSensors() const {
+    drone::runtime::SensorFrame sensor_frame;
+    sensor_frame.altitude_m = position_enu_m_.z;
+    sensor_frame.altitude_agl_m = position_enu_m_.z;
+    sensor_frame.position_enu_x_m = position_enu_m_.x;
+    sensor_frame.position_enu_y_m = position_enu_m_.y;
+    sensor_frame.position_enu_z_m = position_enu_m_.z;
+    sensor_frame.gps_altitude_m = position_enu_m_.z;
+    sensor_frame.gps_velocity_north_mps = velocity_enu_mps_.y;
+    sensor_frame.gps_velocity_east_mps = velocity_enu_mps_.x;
+    sensor_frame.gps_velocity_down_mps = -velocity_enu_mps_.z;
+    sensor_frame.battery_voltage_v = model_.battery_voltage_v;
+    sensor_frame.battery_soc_percent = 100.0;
+    sensor_frame.yaw_rad = attitude_ypr_rad_.yaw_rad;
+    sensor_frame.pitch_rad = attitude_ypr_rad_.pitch_rad;
+    sensor_frame.roll_rad = attitude_ypr_rad_.roll_rad;
+    sensor_frame.motor_rpm = rotor_rpm_[0];
+    sensor_frame.motor_rpm_each = rotor_rpm_;
+    return sensor_frame;
+}
+
+void SurrogateVehicle::applyActuators(const drone::runtime::ActuatorFrame& actuator_frame) {
+    // same reference selection as QuaroSimulation::onStep
+    const bool has_per_motor_refs = std::any_of(actuator_frame.desired_motor_rpm_each.begin(),
+                                                actuator_frame.desired_motor_rpm_each.end(),
+                                                [](double rpm) { return rpm > 0.0; });
+    for (std::size_t i = 0; i < rotor_rpm_ref_.size(); ++i) {
+        const double rpm_ref =
+            has_per_motor_refs ? actuator_frame.desired_motor_rpm_each[i] : actuator_frame.desired_motor_rpm;
+        rotor_rpm_ref_[i] = std::clamp(rpm_ref, 0.0, model_.motor_max_speed_rpm);
+    }
+    attitude_ypr_rad_.yaw_rad = actuator_frame.desired_yaw_rad;
+    attitude_ypr_rad_.pitch_rad = actuator_frame.desired_pitch_rad;
+    attitude_ypr_rad_.roll_rad = actuator_frame.desired_roll_rad;
+    updateAttitudeTerms();
+}
+
+void SurrogateVehicle::updateAttitudeTerms() {
+    yaw_cos_ = std::cos(attitude_ypr_rad_.yaw_rad);
+    yaw_sin_ = std::sin(attitude_ypr_rad_.yaw_rad);
+    tilt_loss_mps2_ = model_.hover_thrust_accel_mps2 *
+                      (std::cos(attitude_ypr_rad_.pitch_rad) * std::cos(attitude_ypr_rad_.roll_rad) - 1.0);
+}
+
+void SurrogateVehicle::step() {
+    const double yaw_c = yaw_cos_;
+    const double yaw_s = yaw_sin_;
+
+    // deviations from hover, velocity turned into the yaw-aligned frame of the linearization
+    std::array<double, kN> x{};
+    x[0] = yaw_c * velocity_enu_mps_.x + yaw_s * velocity_enu_mps_.y;
+    x[1] = -yaw_s * velocity_enu_mps_.x + yaw_c * velocity_enu_mps_.y;
+    x[2] = velocity_enu_mps_.z;
+    std::array<double, kM> u{};
+    for (std::size_t i = 0; i < drone::runtime::kMotorCount; ++i) {
+        x[3 + i] = rotor_rpm_[i] - model_.hover_rpm;
+        u[i] = rotor_rpm_ref_[i] - model_.hover_rpm;
+    }
+    u[drone::runtime::kMotorCount] = attitude_ypr_rad_.pitch_rad;
+    u[drone::runtime::kMotorCount + 1] = attitude_ypr_rad_.roll_rad;
+
+    std::array<double, kN> next{};
+    for (std::size_t i = 0; i < kN; ++i) {
+        double value = 0.0;
+        for (std::size_t j = 0; j < kN; ++j) {
+            value += ad_[i * kN + j] * x[j];
+        }
+        for (std::size_t j = 0; j < kM; ++j) {
+            value += bd_[i * kM + j] * u[j];
+        }
+        next[i] = value;
+    }
+    next[2] += tilt_loss_mps2_ * dt_s_;
+
+    for (std::size_t i = 0; i < drone::runtime::kMotorCount; ++i) {
+        rotor_rpm_[i] = std::clamp(model_.hover_rpm + next[3 + i], 0.0, model_.motor_max_speed_rpm);
+    }
+    velocity_enu_mps_ = drone::Vector3(yaw_c * next[0] - yaw_s * next[1], yaw_s * next[0] + yaw_c * next[1], next[2]);
+    velocity_enu_mps_ += disturbance_acceleration_enu_ms2_ * dt_s_;
+
+    // semi-implicit position update and ground lock, as QuaroSimulation::onStep
+    const drone::Vector3 prev_position_enu_m = position_enu_m_;
+    position_enu_m_ += velocity_enu_mps_ * dt_s_;
+    if (position_enu_m_.z <= 0.0) {
+        position_enu_m_ = drone::Vector3(prev_position_enu_m.x, prev_position_enu_m.y, 0.0);
+        velocity_enu_mps_ = drone::Vector3();
+    }
+}
+
+}  // namespace drone::simulator::runtime
@@ -0,0 +1,267 @@
+// Tunes altitude, position-hold and attitude gains against flown missions: each candidate
+// flies every mission under several weather seeds and is scored on position-error ISE,
+// overshoot, settling time and rotor energy. Candidates come from separable CMA-ES, a
+// population at a time on a thread pool; clearly bad ones are cut off mid-flight. The best
+// gains are written over copies of the input configs.
+//
+// Usage: gain_tuner <altitude_config.yaml> <attitude_config.yaml> <weather_config.yaml> <battery_config.yaml>
+//                   <out_dir> <mission> [mission ...] [--gains altitude,position,attitude] [--seeds N]
+//                   [--generations N] [--population N] [--threads N] [--seed N] [--abort-ratio R]
+//                   [--max-duration-s S] [--dt S] [--weights I,O,S,E] [--surrogate model.yaml]
+
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "drone/config/altitude_controller_config.h"
+#include "drone/config/attitude_controller_config.h"
+#include "drone/mission/mission_image.h"
+#include "drone/mission/mission_loader.h"
+#include "simulator/config/battery_config.h"
+#include "simulator/config/surrogate_model_config.h"
+#include "simulator/config/weather_config.h"
+#include "simulator/runtime/gain_tuning.h"
+#include "simulator/runtime/separable_cma_es.h"
+
+namespace {
+
+using namespace drone::simulator::runtime;
+
+struct TunerArgs {
+    std::vector<std::string> positional;
+    std::uint32_t groups = kAltitudeGains | kPositionGains;
+    std::size_t seeds = 2;
+    SeparableCmaEsOptions search;
+    TuningFlightOptions flight;
+    std::string surrogate_file;
+    TuningCostWeights weights;
+};
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program
+              << " <altitude_config.yaml> <attitude_config.yaml> <weather_config.yaml> <battery_config.yaml>"
+                 " <out_dir> <mission> [mission ...]\n"
+                 "  --gains altitude,position,attitude   gain groups to tune (default: altitude,position)\n"
+                 "  --seeds N            weather seeds per mission (default: 2)\n"
+                 "  --generations N      CMA-ES generations (default: 40)\n"
+                 "  --population N       candidates per generation (default: 4 + 3 ln n)\n"
+                 "  --threads N          worker threads (default: all cores)\n"
+                 "  --seed N             sampling seed (default: 1)\n"
+                 "  --abort-ratio R      cut candidates off at R x best cost, 0 disables (default: 3)\n"
+                 "  --max-duration-s S   per-flight time limit (default: 180)\n"
+                 "  --dt S               control step (default: 0.01)\n"
+                 "  --weights I,O,S,E    cost weights for ISE, overshoot, settling, energy (default: 0.01,5,0.5,0.05)\n"
+                 "  --surrogate FILE     fly a surrogate_linearize model instead of the full simulation"
+              << std::endl;
+}
+
+bool parseGroups(const std::string& text, std::uint32_t& groups) {
+    groups = 0;
+    std::stringstream stream(text);
+    std::string name;
+    while (std::getline(stream, name, ',')) {
+        if (name == "altitude") {
+            groups |= kAltitudeGains;
+        } else if (name == "position") {
+            groups |= kPositionGains;
+        } else if (name == "attitude") {
+            groups |= kAttitudeGains;
+        } else {
+            return false;
+        }
+    }
+    return groups != 0;
+}
+
+bool parseWeights(const std::string& text, TuningCostWeights& weights) {
+    std::vector<double> values;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        values.push_back(std::stod(item));
+    }
+    if (values.size() != 4) {
+        return false;
+    }
+    weights.ise = values[0];
+    weights.overshoot = values[1];
+    weights.settling = values[2];
+    weights.energy = values[3];
+    return true;
+}
+
+bool parseArgs(int argc, char** argv, TunerArgs& args) {
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg.rfind("--", 0) != 0) {
+                args.positional.push_back(arg);
+                continue;
+            }
+            if (i + 1 >= argc) {
+                return false;
+            }
+            const std::string value = argv[++i];
+            if (arg == "--gains") {
+                if (!parseGroups(value, args.groups)) {
+                    return false;
+                }
+            } else if (arg == "--seeds") {
+                args.seeds = std::stoul(value);
+            } else if (arg == "--generations") {
+                args.search.generations = std::stoul(value);
+            } else if (arg == "--population") {
+                args.search.population = std::stoul(value);
+            } else if (arg == "--threads") {
+                args.search.threads = std::stoul(value);
+            } else if (arg == "--seed") {
+                args.search.seed = static_cast<std::uint32_t>(std::stoul(value));
+            } else if (arg == "--abort-ratio") {
+                args.search.abort_ratio = std::stod(value);
+            } else if (arg == "--max-duration-s") {
+                args.flight.max_duration_s = std::stod(value);
+            } else if (arg == "--dt") {
+                args.flight.dt_s = std::stod(value);
+            } else if (arg == "--weights") {
+                if (!parseWeights(value, args.weights)) {
+                    return false;
+                }
+            } else if (arg == "--surrogate") {
+                args.surrogate_file = value;
+            } else {
+                return false;
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return args.positional.size() >= 6 && args.seeds > 0 && args.flight.dt_s > 0.0;
+}
+
+std::shared_ptr<const drone::mission::MissionImage> loadMission(const std::string& file, std::string* error) {
+    if (drone::mission::MissionImage::isImageFile(file)) {
+        return drone::mission::MissionImage::open(file, error);
+    }
+    drone::mission::Mission mission;
+    if (!drone::mission::MissionLoader().loadFromFile(file, mission, error)) {
+        return nullptr;
+    }
+    return drone::mission::MissionImage::fromMission(mission);
+}
+
+void printCost(const char* label, const TuningCost& cost) {
+    std::cout << std::fixed << std::setprecision(3) << label << ": total=" << cost.total
+              << " ise_m2s=" << cost.ise_m2s << " overshoot_m=" << cost.overshoot_m
+              << " settling_s=" << cost.settling_s << " energy_hover_s=" << cost.energy_hover_s
+              << " failures=" << cost.failures << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    TunerArgs args;
+    if (!parseArgs(argc, argv, args)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    const std::string& alt_file = args.positional[0];
+    const std::string& att_file = args.positional[1];
+    const std::filesystem::path out_dir = args.positional[4];
+
+    drone::config::AltitudeControllerConfig alt_config;
+    drone::config::AttitudeControllerConfig att_config;
+    TuningPlant plant;
+    if (!alt_config.loadFromFile(alt_file) || !att_config.loadFromFile(att_file) ||
+        !plant.weather.loadFromFile(args.positional[2]) || !plant.battery.loadFromFile(args.positional[3])) {
+        std::cerr << "Failed to load controller, weather or battery config" << std::endl;
+        return 1;
+    }
+    if (!args.surrogate_file.empty()) {
+        drone::simulator::config::SurrogateModelConfig surrogate_config;
+        if (!surrogate_config.loadFromFile(args.surrogate_file)) {
+            std::cerr << "Failed to load surrogate model: " << args.surrogate_file << std::endl;
+            return 1;
+        }
+        plant.surrogate = std::make_shared<const SurrogateModel>(surrogate_config.model);
+    }
+    args.flight.energy_reference_rpm = alt_config.neutral_rpm;
+
+    std::vector<TuningScenario> scenarios;
+    for (std::size_t i = 5; i < args.positional.size(); ++i) {
+        std::string error;
+        const auto mission = loadMission(args.positional[i], &error);
+        if (!mission) {
+            std::cerr << "Failed to load mission '" << args.positional[i] << "': " << error << std::endl;
+            return 1;
+        }
+        for (std::size_t seed = 0; seed < args.seeds; ++seed) {
+            TuningScenario scenario;
+            scenario.name = std::filesystem::path(args.positional[i]).stem().string() + "#" + std::to_string(seed);
+            scenario.mission = mission;
+            scenario.weather_seed = plant.weather.random_seed + static_cast<std::uint32_t>(seed);
+            scenarios.push_back(std::move(scenario));
+        }
+    }
+
+    const auto gains = tunableGains(args.groups);
+    const TuningCostWeights& weights = args.weights;
+    const auto cost = [&](const std::vector<double>& unit_point, double abort_above, bool* aborted) {
+        drone::config::AltitudeControllerConfig candidate_alt = alt_config;
+        drone::config::AttitudeControllerConfig candidate_att = att_config;
+        applyNormalizedGains(gains, unit_point, candidate_alt, candidate_att);
+        const TuningCost result =
+            evaluateScenarios(plant, candidate_alt, candidate_att, scenarios, args.flight, weights, abort_above);
+        *aborted = result.aborted;
+        return result.total;
+    };
+
+    std::cout << "Tuning " << gains.size() << " gains over " << scenarios.size() << " flights ("
+              << (plant.surrogate ? "surrogate" : "full simulation") << ")" << std::endl;
+    const auto start = std::chrono::steady_clock::now();
+    const SeparableCmaEsResult result = minimizeSeparableCmaEs(
+        normalizeGains(gains, alt_config, att_config), cost, args.search,
+        [](const SeparableCmaEsGeneration& generation) {
+            std::cout << std::fixed << std::setprecision(3) << "generation " << generation.generation
+                      << ": best=" << generation.best_cost << " generation_best=" << generation.generation_best_cost
+                      << " aborted=" << generation.aborted << " sigma=" << generation.step_size << std::endl;
+        });
+    const double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    drone::config::AltitudeControllerConfig tuned_alt = alt_config;
+    drone::config::AttitudeControllerConfig tuned_att = att_config;
+    applyNormalizedGains(gains, result.best_point, tuned_alt, tuned_att);
+    const double no_abort = std::numeric_limits<double>::infinity();
+    printCost("initial", evaluateScenarios(plant, alt_config, att_config, scenarios, args.flight, weights, no_abort));
+    printCost("tuned", evaluateScenarios(plant, tuned_alt, tuned_att, scenarios, args.flight, weights, no_abort));
+    std::cout << result.evaluations << " candidates (" << result.aborted_evaluations << " cut off) in "
+              << std::setprecision(1) << elapsed_s << " s" << std::endl;
+    {
+        drone::config::AltitudeControllerConfig before_alt = alt_config;
+        drone::config::AttitudeControllerConfig before_att = att_config;
+        for (const auto& gain : gains) {
+            std::cout << "  " << gain.key << ": " << std::setprecision(4) << gain.access(before_alt, before_att)
+                      << " -> " << gain.access(tuned_alt, tuned_att) << std::endl;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(out_dir, error);
+    std::ostringstream header;
+    header << "Tuned by gain_tuner over " << scenarios.size() << " flights: cost " << std::fixed << std::setprecision(3)
+           << result.start_cost << " -> " << result.best_cost;
+    const auto alt_out = (out_dir / std::filesystem::path(alt_file).filename()).string();
+    const auto att_out = (out_dir / std::filesystem::path(att_file).filename()).string();
+    if (!writeTunedGains(gains, tuned_alt, tuned_att, "altitude_controller", alt_file, alt_out, header.str()) ||
+        !writeTunedGains(gains, tuned_alt, tuned_att, "attitude_controller", att_file, att_out, header.str())) {
+        std::cerr << "Failed to write tuned configs to " << out_dir << std::endl;
+        return 1;
+    }
+    std::cout << "Wrote " << alt_out << " and " << att_out << std::endl;
+    return 0;
+}
@@ -0,0 +1,102 @@
+// Validates a YAML mission once on the ground and writes it as a binary mission
+// image that RealDrone maps and executes in place, with no parsing at load time.
+//
+// Usage: mission_compile <mission.yaml> <out.vdm>
+
+#include <filesystem>
+#include <iostream>
+#include <set>
+#include <string>
+
+#include "drone/mission/airspace.h"
+#include "drone/mission/airspace_loader.h"
+#include "drone/mission/mission_image.h"
+#include "drone/mission/mission_loader.h"
+
+namespace {
+
+using namespace drone::mission;
+
+bool validateSteps(const Mission& mission) {
+    std::set<int> step_ids;
+    for (const auto& step : mission.steps) {
+        if (!step_ids.insert(step.step_id).second) {
+            std::cerr << "Duplicate step_id=" << step.step_id << std::endl;
+            return false;
+        }
+    }
+    for (const auto& step : mission.steps) {
+        if (step.fallback_step_id >= 0 && step_ids.count(step.fallback_step_id) == 0) {
+            std::cerr << "step_id=" << step.step_id << " has unknown fallback_step_id="
+                      << step.fallback_step_id << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool validateAirspace(const MissionImage& image) {
+    if (image.airspaceFile().empty()) {
+        return true;
+    }
+    std::vector<AirspaceVolume> volumes;
+    std::string error;
+    if (!AirspaceLoader().loadFromFile(image.airspaceFile(), volumes, &error)) {
+        std::cerr << "Failed to load airspace: " << error << std::endl;
+        return false;
+    }
+    const AirspaceIndex index(std::move(volumes));
+    const auto conflicts = checkMissionLegs(image, index);
+    for (const auto& conflict : conflicts) {
+        const auto& volume = index.volume(conflict.hit.volume_index);
+        std::cerr << "go_to_position step_id=" << conflict.step_id << " enters "
+                  << airspaceVolumeKindToString(volume.kind) << " '" << volume.name << "'" << std::endl;
+    }
+    return conflicts.empty();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <mission.yaml> <out.vdm>" << std::endl;
+        return 1;
+    }
+    const std::filesystem::path output_path(argv[2]);
+
+    Mission mission;
+    std::string error;
+    if (!MissionLoader().loadFromFile(argv[1], mission, &error)) {
+        std::cerr << "Failed to load mission: " << error << std::endl;
+        return 1;
+    }
+    if (mission.pattern) {
+        std::cerr << "Mission has a pattern section; generated legs are streamed and cannot be compiled" << std::endl;
+        return 1;
+    }
+    if (!validateSteps(mission)) {
+        return 1;
+    }
+
+    const auto checked_image = MissionImage::fromMission(mission);
+    if (!checked_image || !validateAirspace(*checked_image)) {
+        return 1;
+    }
+
+    // the loader resolved airspace_file against the YAML; store it relative to the image instead
+    if (!mission.airspace_file.empty()) {
+        const auto output_dir = std::filesystem::absolute(output_path).parent_path();
+        mission.airspace_file =
+            std::filesystem::absolute(mission.airspace_file).lexically_normal().lexically_relative(output_dir).string();
+    }
+    const auto image = MissionImage::fromMission(mission);
+    if (!image || !image->write(output_path.string(), &error)) {
+        std::cerr << error << std::endl;
+        return 1;
+    }
+
+    std::cout << output_path.string() << ": " << image->stepCount() << " steps, " << image->instructionCount()
+              << " program instructions, " << image->triggerCount() << " triggers, " << image->sizeBytes()
+              << " bytes, format version " << kMissionImageVersion << std::endl;
+    return 0;
+}
@@ -0,0 +1,136 @@
+// Re-derives the surrogate vehicle model from the full simulation by numerical Jacobians
+// around hover, writes it as YAML and compares the two in closed loop with RealDrone.
+//
+// Usage: surrogate_linearize <altitude_config.yaml> <attitude_config.yaml> <battery_config.yaml> <out.yaml> [dt_s]
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "drone/config/altitude_controller_config.h"
+#include "drone/config/attitude_controller_config.h"
+#include "drone/runtime/controller_setup.h"
+#include "simulator/config/battery_config.h"
+#include "simulator/config/surrogate_model_config.h"
+#include "simulator/quadrosimulator.h"
+#include "simulator/runtime/surrogate_vehicle.h"
+
+namespace {
+
+constexpr double kFlightTimeS = 40.0;
+constexpr double kMoveTimeS = 20.0;  // lateral move after the climb
+constexpr double kClimbAltitudeM = 10.0;
+constexpr double kMoveXM = 15.0;
+constexpr double kMoveYM = 10.0;
+
+struct FlightTrace {
+    std::vector<drone::Vector3> positions_enu_m;
+    double wall_time_s = 0.0;
+};
+
+// Takeoff to kClimbAltitudeM, then a lateral move; the same script for both vehicles
+template <typename Vehicle, typename StepFn>
+FlightTrace fly(const drone::config::AltitudeControllerConfig& alt_config,
+                const drone::config::AttitudeControllerConfig& att_config,
+                Vehicle& vehicle,
+                StepFn step,
+                double dt_s) {
+    drone::runtime::RealDrone real_drone(drone::runtime::makeAltitudeController(alt_config));
+    drone::runtime::applyControllerConfig(real_drone, alt_config, att_config);
+    real_drone.setTargetAltitude(kClimbAltitudeM);
+
+    FlightTrace trace;
+    const auto steps = static_cast<std::size_t>(kFlightTimeS / dt_s);
+    const auto move_step = static_cast<std::size_t>(kMoveTimeS / dt_s);
+    trace.positions_enu_m.reserve(steps);
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < steps; ++i) {
+        if (i == move_step) {
+            real_drone.setTargetPosition(kMoveXM, kMoveYM);
+        }
+        real_drone.update(dt_s, vehicle, vehicle);
+        step();
+        const auto sensors = vehicle.readSensors();
+        trace.positions_enu_m.emplace_back(sensors.position_enu_x_m, sensors.position_enu_y_m,
+                                           sensors.position_enu_z_m);
+    }
+    trace.wall_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return trace;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 5 && argc != 6) {
+        std::cerr << "Usage: " << argv[0]
+                  << " <altitude_config.yaml> <attitude_config.yaml> <battery_config.yaml> <out.yaml> [dt_s]"
+                  << std::endl;
+        return 1;
+    }
+    drone::config::AltitudeControllerConfig alt_config;
+    drone::config::AttitudeControllerConfig att_config;
+    drone::simulator::config::BatteryConfig battery_config;
+    if (!alt_config.loadFromFile(argv[1]) || !att_config.loadFromFile(argv[2]) ||
+        !battery_config.loadFromFile(argv[3])) {
+        std::cerr << "Failed to load controller or battery config" << std::endl;
+        return 1;
+    }
+    double dt_s = 0.01;
+    if (argc == 6) {
+        try {
+            dt_s = std::stod(argv[5]);
+        } catch (...) {
+            std::cerr << "dt_s must be a number" << std::endl;
+            return 1;
+        }
+    }
+
+    auto sim = drone::simulator::QuadroSimulationFactory(0, dt_s);
+    sim->setBatteryConfig(battery_config);
+    sim->setTelemetryLogFile("");  // an empty name leaves the telemetry CSV closed
+    drone::simulator::runtime::SurrogateLinearization options;
+    options.dt_s = dt_s;
+    drone::simulator::config::SurrogateModelConfig surrogate_config;
+    surrogate_config.model = sim->linearizeHover(options);
+    const auto& model = surrogate_config.model;
+    if (model.hover_rpm <= 0.0 || model.motor_time_constant_s <= 0.0) {
+        std::cerr << "Vehicle cannot hover; no linearization" << std::endl;
+        return 1;
+    }
+    if (!surrogate_config.saveToFile(argv[4])) {
+        std::cerr << "Failed to write: " << argv[4] << std::endl;
+        return 1;
+    }
+    using drone::simulator::runtime::kSurrogateInputCount;
+    using drone::simulator::runtime::kSurrogateStateCount;
+    std::cout << argv[4] << ": hover_rpm=" << model.hover_rpm
+              << " motor_time_constant_s=" << model.motor_time_constant_s
+              << " dvz/drpm=" << model.a[2 * kSurrogateStateCount + 3]
+              << " dvz/dvz=" << model.a[2 * kSurrogateStateCount + 2]
+              << " dvy/droll=" << model.b[1 * kSurrogateInputCount + drone::runtime::kMotorCount + 1] << std::endl;
+
+    // closed-loop check: the same flight on both vehicles
+    sim->start();
+    const FlightTrace full = fly(alt_config, att_config, *sim, [&] { sim->step(dt_s); }, dt_s);
+    sim->stop();
+    drone::simulator::runtime::SurrogateVehicle surrogate(model, dt_s);
+    const FlightTrace reduced = fly(alt_config, att_config, surrogate, [&] { surrogate.step(); }, dt_s);
+
+    double squared_error_sum = 0.0;
+    double max_error_m = 0.0;
+    for (std::size_t i = 0; i < full.positions_enu_m.size(); ++i) {
+        const drone::Vector3 error = full.positions_enu_m[i] - reduced.positions_enu_m[i];
+        const double error_m = std::sqrt(error.x * error.x + error.y * error.y + error.z * error.z);
+        squared_error_sum += error_m * error_m;
+        max_error_m = std::max(max_error_m, error_m);
+    }
+    const double steps = static_cast<double>(full.positions_enu_m.size());
+    std::cout << std::fixed << std::setprecision(3) << "closed loop " << kFlightTimeS
+              << " s: rms_position_error_m=" << std::sqrt(squared_error_sum / steps)
+              << " max_position_error_m=" << max_error_m << " full_us_per_step=" << full.wall_time_s / steps * 1e6
+              << " surrogate_us_per_step=" << reduced.wall_time_s / steps * 1e6
+              << " speedup=" << full.wall_time_s / std::max(reduced.wall_time_s, 1e-12) << std::endl;
+    return 0;
+}
@@ -0,0 +1,43 @@
+// Precomputes the weather tape for a (weather config, dt, duration) key so batch
+// workers can map it read-only instead of generating weather themselves.
+//
+// Usage: weather_tape <weather_config_file> <dt_s> <duration_s> <tape_dir>
+
+#include <iostream>
+#include <string>
+
+#include "simulator/config/weather_config.h"
+#include "simulator/environment/weather_tape.h"
+
+int main(int argc, char** argv) {
+    if (argc != 5) {
+        std::cerr << "Usage: " << argv[0] << " <weather_config_file> <dt_s> <duration_s> <tape_dir>" << std::endl;
+        return 1;
+    }
+
+    drone::simulator::config::WeatherConfig config;
+    if (!config.loadFromFile(argv[1])) {
+        std::cerr << "Failed to load weather config: " << argv[1] << std::endl;
+        return 1;
+    }
+
+    double dt_s = 0.0;
+    double duration_s = 0.0;
+    try {
+        dt_s = std::stod(argv[2]);
+        duration_s = std::stod(argv[3]);
+    } catch (...) {
+        std::cerr << "dt_s and duration_s must be numbers" << std::endl;
+        return 1;
+    }
+
+    const auto tape = drone::simulator::environment::WeatherTape::loadOrGenerate(config, dt_s, duration_s, argv[4]);
+    if (!tape) {
+        std::cerr << "Failed to generate weather tape in: " << argv[4] << std::endl;
+        return 1;
+    }
+
+    std::cout << std::string(argv[4]) + "/" + drone::simulator::environment::WeatherTape::fileNameForKey(tape->key())
+              << " samples=" << tape->size() << " dt_s=" << tape->dtS() << std::endl;
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <vector>
+
+#include "drone/mission/fleet_scheduler.h"
+#include "drone/model/components/altitude_controler.h"
+#include "drone/runtime/real_drone.h"
+
+namespace {
+
+std::shared_ptr<const drone::mission::Mission> makeGoToMission() {
+    using namespace drone::mission;
+
+    auto mission = std::make_shared<Mission>();
+    mission->name = "fleet_test";
+
+    MissionStep step;
+    step.step_id = 1;
+    step.name = "go_to";
+    auto goto_action = std::make_unique<GoToPositionAction>();
+    goto_action->target_position_enu_m = drone::Vector3(10.0, -4.0, 0.0);
+    goto_action->target_altitude_m = 12.0;
+    step.action = std::move(goto_action);
+    step.advance_mode = AdvanceMode::COMPLETION_BASED;
+    step.completion_criteria.condition_type = CompletionConditionType::POSITION_REACHED;
+    step.completion_criteria.target_position_enu_m = drone::Vector3(10.0, -4.0, 0.0);
+    step.completion_criteria.position_tolerance_m = 0.5;
+    step.completion_criteria.target_altitude_m = 12.0;
+    step.completion_criteria.altitude_tolerance_m = 0.3;
+    step.timeout_s = 30.0;
+    mission->steps.emplace_back(std::move(step));
+    return mission;
+}
+
+}  // namespace
+
+TEST_CASE("FleetMissionScheduler shares one mission and applies per-vehicle offsets", "[FleetMissionScheduler]") {
+    using namespace drone::mission;
+
+    const auto mission = makeGoToMission();
+    drone::model::components::AltitudeController altitude_controller;
+    std::vector<std::unique_ptr<drone::runtime::RealDrone>> drones;
+    for (int i = 0; i < 3; ++i) {
+        drones.push_back(std::make_unique<drone::runtime::RealDrone>(altitude_controller));
+    }
+
+    FleetMissionScheduler scheduler(mission);
+    MissionOverrides shifted;
+    shifted.position_offset_enu_m = drone::Vector3(100.0, 0.0, 0.0);
+    shifted.altitude_offset_m = 5.0;
+    scheduler.addVehicle(*drones[0]);
+    scheduler.addVehicle(*drones[1], shifted);
+    scheduler.addVehicle(*drones[2], shifted);
+    // compiled once: scheduler + three executors share one image, no step copies
+    REQUIRE(scheduler.getMissionImage().use_count() == 4);
+    REQUIRE(scheduler.executor(2).getMissionImage() == scheduler.getMissionImage());
+
+    REQUIRE(scheduler.start());
+    REQUIRE(scheduler.activeCount() == 3);
+
+    // vehicle 0 at the nominal target, vehicle 1 at the shifted target, vehicle 2 still en route
+    std::vector<drone::runtime::SensorFrame> frames(3);
+    frames[0].position_enu_x_m = 10.0;
+    frames[0].position_enu_y_m = -4.0;
+    frames[0].position_enu_z_m = 12.0;
+    frames[1].position_enu_x_m = 110.0;
+    frames[1].position_enu_y_m = -4.0;
+    frames[1].position_enu_z_m = 17.0;
+    frames[2].position_enu_x_m = 10.0;
+    frames[2].position_enu_y_m = -4.0;
+    frames[2].position_enu_z_m = 12.0;
+
+    scheduler.update(frames.data(), 0.05);
+    REQUIRE(scheduler.executor(0).getStatus() == MissionStatus::COMPLETED);
+    REQUIRE(scheduler.executor(1).getStatus() == MissionStatus::COMPLETED);
+    REQUIRE(scheduler.executor(2).getStatus() == MissionStatus::RUNNING);
+    REQUIRE(scheduler.activeCount() == 1);
+    REQUIRE_FALSE(scheduler.isFinished());
+
+    frames[2] = frames[1];
+    scheduler.update(frames.data(), 0.05);
+    REQUIRE(scheduler.isFinished());
+}
+
+TEST_CASE("FleetMissionScheduler holds vehicles until their start delay", "[FleetMissionScheduler]") {
+    using namespace drone::mission;
+
+    const auto mission = makeGoToMission();
+    drone::model::components::AltitudeController altitude_controller;
+    drone::runtime::RealDrone first(altitude_controller);
+    drone::runtime::RealDrone second(altitude_controller);
+
+    FleetMissionScheduler scheduler(mission);
+    MissionOverrides delayed;
+    delayed.start_delay_s = 0.1;
+    scheduler.addVehicle(first);
+    scheduler.addVehicle(second, delayed);
+    REQUIRE(scheduler.start());
+
+    std::vector<drone::runtime::SensorFrame> frames(2);
+    scheduler.update(frames.data(), 0.05);
+    REQUIRE(scheduler.executor(0).getStatus() == MissionStatus::RUNNING);
+    REQUIRE(scheduler.executor(1).getStatus() == MissionStatus::IDLE);
+
+    scheduler.update(frames.data(), 0.05);
+    REQUIRE(scheduler.executor(1).getStatus() == MissionStatus::RUNNING);
+    REQUIRE(scheduler.executor(1).getTotalElapsedTime() > 0.0);
+}
+
+TEST_CASE("RealDrone runs a shared mission with overrides", "[FleetMissionScheduler]") {
+    using namespace drone::mission;
+
+    const auto image = MissionImage::fromMission(*makeGoToMission());
+    drone::model::components::AltitudeController altitude_controller;
+    drone::runtime::RealDrone real_drone(altitude_controller);
+    drone::runtime::RealDrone other_drone(altitude_controller);
+
+    MissionOverrides overrides;
+    overrides.position_offset_enu_m = drone::Vector3(-20.0, 5.0, 0.0);
+    REQUIRE(real_drone.loadMission(image, overrides));
+    REQUIRE(other_drone.loadMission(image));
+    // both vehicles run the one compiled image
+    REQUIRE(image.use_count() == 3);
+    real_drone.startMission();
+
+    drone::runtime::SensorFrame frame;
+    frame.position_enu_x_m = -10.0;
+    frame.position_enu_y_m = 1.0;
+    frame.position_enu_z_m = 12.0;
+    real_drone.updateMission(frame, 0.05);
+    REQUIRE(real_drone.getMissionStatus() == MissionStatus::COMPLETED);
+}
@@ -108,3 +108,124 @@ TEST_CASE("MissionExecutor completes step on position_reached criteria", "[Missi
     executor.update(real_drone, sensor, 0.05);
     REQUIRE(executor.getStatus() == MissionStatus::COMPLETED);
 }
+
+TEST_CASE("MissionExecutor applies step setpoints on entry only", "[MissionExecutor]") {
+    using namespace drone::mission;
+
+    drone::model::components::AltitudeController altitude_controller;
+    drone::runtime::RealDrone real_drone(altitude_controller);
+    drone::runtime::SensorFrame sensor{};
+    sensor.altitude_m = 100.0;
+    sensor.altitude_agl_m = 100.0;
+
+    Mission mission;
+    mission.name = "edge_trigger_test";
+
+    MissionStep hover_step;
+    hover_step.step_id = 1;
+    auto hover = std::make_unique<HoverAction>();
+    hover->target_altitude_m = 5.0;
+    hover_step.action = std::move(hover);
+    hover_step.duration_s = 0.2;
+
+    MissionStep follow_step;
+    follow_step.step_id = 2;
+    auto follow = std::make_unique<GoToPositionAction>();
+    follow->target_altitude_m = 10.0;
+    follow->altitude_mode = "agl";
+    follow_step.action = std::move(follow);
+    follow_step.duration_s = 0.2;
+
+    MissionStep climb_step;
+    climb_step.step_id = 3;
+    auto climb = std::make_unique<ChangeAltitudeAction>();
+    climb->target_altitude_m = 7.0;
+    climb_step.action = std::move(climb);
+    climb_step.advance_mode = AdvanceMode::COMPLETION_BASED;
+    climb_step.completion_criteria.condition_type = CompletionConditionType::ALTITUDE_REACHED;
+    climb_step.completion_criteria.target_altitude_m = 7.0;
+    climb_step.timeout_s = 0.1;
+    climb_step.timeout_behavior = TimeoutBehavior::RETRY;
+    climb_step.retry_count = 1;
+
+    mission.steps.emplace_back(std::move(hover_step));
+    mission.steps.emplace_back(std::move(follow_step));
+    mission.steps.emplace_back(std::move(climb_step));
+
+    MissionExecutor executor;
+    executor.loadMission(mission);
+    executor.start();
+
+    executor.update(real_drone, sensor, 0.05);
+    executor.update(real_drone, sensor, 0.05);
+    REQUIRE(executor.getSetpointUpdateCount() == 1);
+    REQUIRE(real_drone.getTargetAltitude() == 5.0);
+
+    // an external setpoint is left alone until the step is explicitly re-applied
+    real_drone.setTargetAltitude(3.0);
+    executor.update(real_drone, sensor, 0.05);
+    REQUIRE(real_drone.getTargetAltitude() == 3.0);
+    executor.reapplyCurrentStep();
+    executor.update(real_drone, sensor, 0.05);
+    REQUIRE(real_drone.getTargetAltitude() == 5.0);
+    REQUIRE(executor.getSetpointUpdateCount() == 2);
+    REQUIRE(executor.getCurrentStepId() == 2);
+
+    // terrain following sends altitude-only updates, and only when the ground moves
+    executor.update(real_drone, sensor, 0.05);
+    REQUIRE(executor.getSetpointUpdateCount() == 3);
+    REQUIRE(real_drone.getTargetAltitude() == 10.0);
+    executor.update(real_drone, sensor, 0.05);
+    REQUIRE(executor.getSetpointUpdateCount() == 3);
+    sensor.altitude_agl_m = 90.0;
+    executor.update(real_drone, sensor, 0.05);
+    REQUIRE(executor.getSetpointUpdateCount() == 4);
+    REQUIRE(real_drone.getTargetAltitude() == 20.0);
+    executor.update(real_drone, sensor, 0.05);
+    REQUIRE(executor.getCurrentStepId() == 3);
+
+    // a retry is a fresh entry into the step
+    std::uint64_t updates_before_retry = 0;
+    while (executor.getStatus() == MissionStatus::RUNNING && executor.getCurrentStepId() == 3) {
+        executor.update(real_drone, sensor, 0.05);
+        if (updates_before_retry == 0) {
+            updates_before_retry = executor.getSetpointUpdateCount();
+        }
+    }
+    REQUIRE(executor.getStatus() == MissionStatus::ABORTED);
+    REQUIRE(updates_before_retry == 5);
+    REQUIRE(executor.getSetpointUpdateCount() == 6);
+}
+
+TEST_CASE("MissionExecutor plans a minimum-jerk leg on go_to entry", "[MissionExecutor]") {
+    using namespace drone::mission;
+
+    drone::model::components::AltitudeController altitude_controller;
+    drone::runtime::RealDrone real_drone(altitude_controller);
+    drone::runtime::SensorFrame sensor{};
+
+    Mission mission;
+    for (int step_id : {1, 2}) {
+        MissionStep step;
+        step.step_id = step_id;
+        auto go_to = std::make_unique<GoToPositionAction>();
+        go_to->target_position_enu_m = drone::Vector3(30.0, 0.0, 0.0);
+        go_to->target_altitude_m = 10.0;
+        go_to->trajectory = step_id == 1 ? "min_jerk" : "direct";
+        step.action = std::move(go_to);
+        step.duration_s = 0.1;
+        mission.steps.emplace_back(std::move(step));
+    }
+
+    MissionExecutor executor;
+    executor.loadMission(mission);
+    executor.start();
+
+    executor.update(real_drone, sensor, 0.05);
+    REQUIRE(real_drone.isFollowingTrajectory());
+    while (executor.getCurrentStepId() == 1) {
+        executor.update(real_drone, sensor, 0.05);
+    }
+    executor.update(real_drone, sensor, 0.05);
+    REQUIRE_FALSE(real_drone.isFollowingTrajectory());  // a plain position target replaces it
+}
@@ -0,0 +1,94 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "drone/control/trajectory.h"
+
+using drone::Vector3;
+using drone::control::MinimumJerkTrajectory;
+using drone::control::TrajectoryLimits;
+using drone::control::TrajectorySample;
+
+namespace {
+
+double horizontalSpeed(const Vector3& v) {
+    return std::hypot(v.x, v.y);
+}
+
+}  // namespace
+
+TEST_CASE("Minimum-jerk trajectory meets its boundary conditions", "[Trajectory]") {
+    TrajectoryLimits limits;
+    limits.max_velocity_mps = 5.0;
+    limits.max_acceleration_mps2 = 1.5;
+    const auto trajectory =
+        MinimumJerkTrajectory::plan({Vector3(2.0, -1.0, 0.0), Vector3(32.0, 19.0, 0.0)}, Vector3(1.0, 0.0, 0.0), limits);
+    REQUIRE(trajectory.segmentCount() == 1);
+    REQUIRE(trajectory.duration() > 0.0);
+
+    const TrajectorySample start = trajectory.sample(0.0);
+    REQUIRE(start.position_enu_m.x == Catch::Approx(2.0));
+    REQUIRE(start.position_enu_m.y == Catch::Approx(-1.0));
+    REQUIRE(start.velocity_enu_mps.x == Catch::Approx(1.0));
+    REQUIRE(start.acceleration_enu_mps2.x == Catch::Approx(0.0).margin(1e-12));
+
+    const TrajectorySample end = trajectory.sample(trajectory.duration() - 1e-9);
+    REQUIRE(end.position_enu_m.x == Catch::Approx(32.0));
+    REQUIRE(end.position_enu_m.y == Catch::Approx(19.0));
+    REQUIRE(horizontalSpeed(end.velocity_enu_mps) == Catch::Approx(0.0).margin(1e-6));
+    REQUIRE(horizontalSpeed(end.acceleration_enu_mps2) == Catch::Approx(0.0).margin(1e-6));
+
+    const TrajectorySample after = trajectory.sample(trajectory.duration() + 5.0);
+    REQUIRE(after.finished);
+    REQUIRE(after.position_enu_m.x == Catch::Approx(32.0));
+    REQUIRE(horizontalSpeed(after.velocity_enu_mps) == 0.0);
+}
+
+TEST_CASE("Minimum-jerk trajectory respects velocity and acceleration limits", "[Trajectory]") {
+    TrajectoryLimits limits;
+    limits.max_velocity_mps = 4.0;
+    limits.max_acceleration_mps2 = 1.0;
+    const std::vector<Vector3> waypoints{Vector3(0.0, 0.0, 0.0), Vector3(40.0, 0.0, 0.0), Vector3(40.0, 25.0, 0.0),
+                                         Vector3(0.0, 25.0, 0.0)};
+    const auto trajectory = MinimumJerkTrajectory::plan(waypoints, Vector3(0.0, 0.0, 0.0), limits);
+    REQUIRE(trajectory.segmentCount() == 3);
+
+    // velocity is continuous through the interior waypoints, so the corners are cut but passed nearby
+    double peak_speed = 0.0;
+    double peak_acceleration = 0.0;
+    double closest_to_corner_m = 1e9;
+    for (double t = 0.0; t < trajectory.duration(); t += 0.01) {
+        const TrajectorySample sample = trajectory.sample(t);
+        peak_speed = std::max(peak_speed, horizontalSpeed(sample.velocity_enu_mps));
+        peak_acceleration = std::max(peak_acceleration, horizontalSpeed(sample.acceleration_enu_mps2));
+        closest_to_corner_m = std::min(closest_to_corner_m,
+                                       std::hypot(sample.position_enu_m.x - 40.0, sample.position_enu_m.y));
+    }
+    REQUIRE(peak_speed <= limits.max_velocity_mps * 1.02);
+    REQUIRE(peak_acceleration <= limits.max_acceleration_mps2 * 1.02);
+    REQUIRE(closest_to_corner_m < 0.05);
+    REQUIRE(trajectory.endPosition().y == Catch::Approx(25.0));
+}
+
+TEST_CASE("Cursor sampling matches direct evaluation", "[Trajectory]") {
+    TrajectoryLimits limits;
+    const std::vector<Vector3> waypoints{Vector3(0.0, 0.0, 0.0), Vector3(10.0, 5.0, 0.0), Vector3(20.0, 0.0, 0.0),
+                                         Vector3(30.0, 5.0, 0.0)};
+    const auto trajectory = MinimumJerkTrajectory::plan(waypoints, Vector3(0.0, 0.0, 0.0), limits);
+
+    std::size_t cursor = 0;
+    for (double t = 0.0; t < trajectory.duration() + 1.0; t += 0.05) {
+        const TrajectorySample streamed = trajectory.sample(t, cursor);
+        const TrajectorySample direct = trajectory.sample(t);
+        REQUIRE(streamed.position_enu_m.x == direct.position_enu_m.x);
+        REQUIRE(streamed.position_enu_m.y == direct.position_enu_m.y);
+        REQUIRE(streamed.velocity_enu_mps.x == direct.velocity_enu_mps.x);
+    }
+
+    // going back in time restarts the cursor search
+    const TrajectorySample rewound = trajectory.sample(0.0, cursor);
+    REQUIRE(rewound.position_enu_m.x == Catch::Approx(0.0).margin(1e-12));
+}
@@ -0,0 +1,299 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+
+#include "drone/mission/airspace.h"
+#include "drone/mission/airspace_loader.h"
+#include "drone/mission/fleet_scheduler.h"
+#include "drone/mission/mission_loader.h"
+#include "drone/runtime/real_drone.h"
+
+namespace {
+
+using drone::Vector3;
+using drone::mission::AirspaceVolume;
+
+std::filesystem::path writeTestYaml(const std::string& filename, const std::string& content) {
+    const auto path = std::filesystem::temp_directory_path() / filename;
+    std::ofstream out(path.string(), std::ios::trunc);
+    out << content;
+    out.close();
+    return path;
+}
+
+AirspaceVolume box(const std::string& name, double x0, double y0, double x1, double y1, double z0, double z1) {
+    AirspaceVolume volume;
+    volume.name = name;
+    volume.kind = drone::mission::AirspaceVolumeKind::OBSTACLE;
+    volume.footprint_enu_m = {Vector3(x0, y0, 0.0), Vector3(x1, y0, 0.0), Vector3(x1, y1, 0.0), Vector3(x0, y1, 0.0)};
+    volume.floor_m = z0;
+    volume.ceiling_m = z1;
+    return volume;
+}
+
+// L-shaped zone: the notch at x, y in (10, 20] is outside
+AirspaceVolume lShape() {
+    AirspaceVolume volume;
+    volume.name = "L";
+    volume.footprint_enu_m = {Vector3(0.0, 0.0, 0.0), Vector3(20.0, 0.0, 0.0), Vector3(20.0, 10.0, 0.0),
+                              Vector3(10.0, 10.0, 0.0), Vector3(10.0, 20.0, 0.0), Vector3(0.0, 20.0, 0.0)};
+    volume.floor_m = 0.0;
+    volume.ceiling_m = 50.0;
+    return volume;
+}
+
+}  // namespace
+
+TEST_CASE("AirspaceIndex containment respects concave footprints and floor/ceiling", "[Airspace]") {
+    const drone::mission::AirspaceIndex index({lShape()});
+
+    REQUIRE(index.findContaining(Vector3(5.0, 15.0, 10.0)) != nullptr);
+    REQUIRE(index.findContaining(Vector3(15.0, 5.0, 10.0)) != nullptr);
+    REQUIRE(index.findContaining(Vector3(15.0, 15.0, 10.0)) == nullptr);  // notch
+    REQUIRE(index.findContaining(Vector3(5.0, 5.0, 60.0)) == nullptr);    // above ceiling
+}
+
+TEST_CASE("AirspaceIndex reports the earliest entry along a segment", "[Airspace]") {
+    const drone::mission::AirspaceIndex index({box("near", 10.0, -1.0, 11.0, 1.0, 0.0, 30.0),
+                                               box("far", 20.0, -1.0, 21.0, 1.0, 0.0, 30.0)});
+
+    drone::mission::AirspaceHit hit;
+    REQUIRE(index.findFirstHit(Vector3(0.0, 0.0, 10.0), Vector3(30.0, 0.0, 10.0), hit));
+    REQUIRE(index.volume(hit.volume_index).name == "near");
+    REQUIRE(hit.point_enu_m.x == Catch::Approx(10.0));
+    REQUIRE(hit.segment_t == Catch::Approx(1.0 / 3.0));
+
+    // both endpoints clear, but the thin wall is crossed between them
+    REQUIRE(index.findFirstHit(Vector3(9.0, 0.0, 10.0), Vector3(12.0, 0.0, 10.0), hit));
+    REQUIRE(index.volume(hit.volume_index).name == "near");
+
+    // passes over the ceiling, then descends into the far obstacle's roof
+    REQUIRE_FALSE(index.findFirstHit(Vector3(0.0, 0.0, 40.0), Vector3(15.0, 0.0, 40.0), hit));
+    REQUIRE(index.findFirstHit(Vector3(20.5, 0.0, 40.0), Vector3(20.5, 0.0, 20.0), hit));
+    REQUIRE(hit.point_enu_m.z == Catch::Approx(30.0));
+}
+
+TEST_CASE("AirspaceIndex keeps invalid volumes in place but never hits them", "[Airspace]") {
+    AirspaceVolume inverted = box("inverted", 0.0, -1.0, 30.0, 1.0, 0.0, 30.0);
+    inverted.ceiling_m = -1.0;
+    REQUIRE(drone::mission::airspaceVolumeProblem(inverted) != nullptr);
+    REQUIRE(drone::mission::airspaceVolumeProblem(box("ok", 0.0, 0.0, 1.0, 1.0, 0.0, 1.0)) == nullptr);
+
+    const drone::mission::AirspaceIndex index({inverted, box("far", 20.0, -1.0, 21.0, 1.0, 0.0, 30.0)});
+    REQUIRE(index.volumeCount() == 2);
+
+    drone::mission::AirspaceHit hit;
+    REQUIRE(index.findFirstHit(Vector3(0.0, 0.0, 10.0), Vector3(30.0, 0.0, 10.0), hit));
+    REQUIRE(hit.volume_index == 1);
+    REQUIRE(index.volume(hit.volume_index).name == "far");
+}
+
+TEST_CASE("AirspaceIndex matches brute force on a large obstacle set", "[Airspace]") {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> position(-2000.0, 2000.0);
+    std::uniform_real_distribution<double> size(2.0, 40.0);
+    std::uniform_real_distribution<double> height(5.0, 150.0);
+
+    std::vector<AirspaceVolume> volumes;
+    for (int i = 0; i < 3000; ++i) {
+        const double x = position(rng);
+        const double y = position(rng);
+        volumes.push_back(box("b" + std::to_string(i), x, y, x + size(rng), y + size(rng), 0.0, height(rng)));
+    }
+    const drone::mission::AirspaceIndex index(volumes);
+    std::vector<drone::mission::AirspaceIndex> singles;
+    singles.reserve(volumes.size());
+    for (const auto& volume : volumes) {
+        singles.emplace_back(std::vector<AirspaceVolume>{volume});
+    }
+    REQUIRE(index.volumeCount() == volumes.size());
+
+    std::uniform_real_distribution<double> altitude(0.0, 160.0);
+    std::uniform_real_distribution<double> step(-300.0, 300.0);
+    drone::mission::AirspaceQueryStats stats;
+    for (int query = 0; query < 400; ++query) {
+        const Vector3 start(position(rng), position(rng), altitude(rng));
+        const Vector3 end(start.x + step(rng), start.y + step(rng), altitude(rng));
+
+        double expected_t = std::numeric_limits<double>::infinity();
+        for (const auto& one : singles) {
+            drone::mission::AirspaceHit brute_hit;
+            if (one.findFirstHit(start, end, brute_hit) && brute_hit.segment_t < expected_t) {
+                expected_t = brute_hit.segment_t;
+            }
+        }
+
+        drone::mission::AirspaceHit hit;
+        const bool found = index.findFirstHit(start, end, hit, &stats);
+        REQUIRE(found == std::isfinite(expected_t));
+        if (found) {
+            REQUIRE(hit.segment_t == Catch::Approx(expected_t));
+        }
+    }
+    // the hierarchy must prune: far fewer exact tests than volumes per query
+    REQUIRE(stats.queries == 400);
+    REQUIRE(stats.volumes_tested < 400 * volumes.size() / 20);
+}
+
+TEST_CASE("AirspaceLoader reads prisms and boxes", "[Airspace]") {
+    const auto yaml_path = writeTestYaml(
+        "airspace_loader_valid.yaml",
+        "airspace:\n"
+        "  no_fly_zones:\n"
+        "    - name: 'Zone'\n"
+        "      floor_m: 5.0\n"
+        "      ceiling_m: 100.0\n"
+        "      polygon:\n"
+        "        - { x: 0.0, y: 0.0 }\n"
+        "        - { x: 10.0, y: 0.0 }\n"
+        "        - { x: 5.0, y: 8.0 }\n"
+        "  obstacles:\n"
+        "    - name: 'Box'\n"
+        "      min_enu_m: { x: 1.0, y: 2.0, z: 0.0 }\n"
+        "      max_enu_m: { x: 3.0, y: 4.0, z: 20.0 }\n");
+
+    drone::mission::AirspaceLoader loader;
+    std::vector<AirspaceVolume> volumes;
+    std::string error;
+    REQUIRE(loader.loadFromFile(yaml_path.string(), volumes, &error));
+    REQUIRE(volumes.size() == 2);
+    REQUIRE(volumes[0].kind == drone::mission::AirspaceVolumeKind::NO_FLY_ZONE);
+    REQUIRE(volumes[0].footprint_enu_m.size() == 3);
+    REQUIRE(volumes[0].floor_m == 5.0);
+    REQUIRE(volumes[1].kind == drone::mission::AirspaceVolumeKind::OBSTACLE);
+    REQUIRE(volumes[1].footprint_enu_m.size() == 4);
+    REQUIRE(volumes[1].ceiling_m == 20.0);
+
+    std::filesystem::remove(yaml_path);
+}
+
+TEST_CASE("AirspaceLoader names the invalid volume", "[Airspace]") {
+    const auto yaml_path = writeTestYaml(
+        "airspace_loader_invalid.yaml",
+        "airspace:\n"
+        "  obstacles:\n"
+        "    - name: 'Box'\n"
+        "      min_enu_m: { x: 1.0, y: 2.0, z: 0.0 }\n"
+        "      max_enu_m: { x: 3.0, y: 4.0, z: 20.0 }\n"
+        "    - name: 'Mast'\n"
+        "      floor_m: 30.0\n"
+        "      ceiling_m: 10.0\n"
+        "      polygon:\n"
+        "        - { x: 0.0, y: 0.0 }\n"
+        "        - { x: 1.0, y: 0.0 }\n"
+        "        - { x: 0.0, y: 1.0 }\n");
+
+    drone::mission::AirspaceLoader loader;
+    std::vector<AirspaceVolume> volumes;
+    std::string error;
+    REQUIRE_FALSE(loader.loadFromFile(yaml_path.string(), volumes, &error));
+    REQUIRE(error.find("obstacles entry 1 'Mast'") != std::string::npos);
+    REQUIRE(error.find("ceiling") != std::string::npos);
+
+    std::filesystem::remove(yaml_path);
+}
+
+TEST_CASE("RealDrone rejects a mission whose go_to_position leg crosses an obstacle", "[Airspace]") {
+    const auto airspace_path = writeTestYaml(
+        "airspace_mission_check.yaml",
+        "airspace:\n"
+        "  obstacles:\n"
+        "    - name: 'Wall'\n"
+        "      min_enu_m: { x: 10.0, y: -5.0, z: 0.0 }\n"
+        "      max_enu_m: { x: 11.0, y: 5.0, z: 20.0 }\n");
+
+    auto missionYaml = [](double altitude_m) {
+        const std::string altitude = std::to_string(altitude_m);
+        return std::string(
+                   "mission:\n"
+                   "  name: 'Airspace Check'\n"
+                   "  airspace_file: 'airspace_mission_check.yaml'\n"
+                   "  steps:\n"
+                   "    - step_id: 1\n"
+                   "      action: 'hover'\n"
+                   "      target_altitude_m: ") + altitude + "\n"
+               "    - step_id: 2\n"
+               "      action: 'go_to_position'\n"
+               "      target_position_enu_m: { x: 20.0, y: 0.0 }\n"
+               "      target_altitude_m: " + altitude + "\n";
+    };
+
+    drone::model::components::AltitudeController alt_ctrl;
+    drone::runtime::RealDrone real_drone(alt_ctrl);
+    std::string error;
+
+    const auto low_path = writeTestYaml("airspace_mission_low.yaml", missionYaml(10.0));
+    REQUIRE_FALSE(real_drone.loadMissionFromFile(low_path.string(), &error));
+    REQUIRE(error.find("step_id=2") != std::string::npos);
+    REQUIRE(error.find("Wall") != std::string::npos);
+
+    const auto high_path = writeTestYaml("airspace_mission_high.yaml", missionYaml(25.0));
+    error.clear();
+    REQUIRE(real_drone.loadMissionFromFile(high_path.string(), &error));
+    REQUIRE(real_drone.getAirspace() != nullptr);
+    REQUIRE(real_drone.getAirspaceLoadProfile().legs_checked == 1);
+
+    // parsed missions handed to RealDrone or a fleet are checked the same way
+    drone::mission::MissionLoader loader;
+    drone::mission::Mission low_mission;
+    REQUIRE(loader.loadFromFile(low_path.string(), low_mission, &error));
+    const auto low_image = drone::mission::MissionImage::fromMission(low_mission);
+    error.clear();
+    REQUIRE_FALSE(real_drone.loadMission(low_image, {}, &error));
+    REQUIRE(error.find("Wall") != std::string::npos);
+    REQUIRE_FALSE(real_drone.hasMissionLoaded());
+
+    error.clear();
+    const drone::mission::FleetMissionScheduler fleet(low_image);
+    REQUIRE_FALSE(fleet.checkAirspace(&error));
+    REQUIRE(error.find("step_id=2") != std::string::npos);
+
+    // a vehicle shifted down into the wall is refused although the nominal legs clear it
+    drone::mission::Mission high_mission;
+    REQUIRE(loader.loadFromFile(high_path.string(), high_mission, &error));
+    const auto high_image = drone::mission::MissionImage::fromMission(high_mission);
+    drone::mission::MissionOverrides lowered;
+    lowered.altitude_offset_m = -15.0;
+    error.clear();
+    REQUIRE_FALSE(real_drone.loadMission(high_image, lowered, &error));
+    REQUIRE(error.find("Wall") != std::string::npos);
+    REQUIRE(real_drone.loadMission(high_image, {}, &error));
+
+    drone::runtime::RealDrone wingman(alt_ctrl);
+    drone::mission::FleetMissionScheduler shifted_fleet(high_image);
+    shifted_fleet.addVehicle(real_drone);
+    REQUIRE(shifted_fleet.start(&error));
+    shifted_fleet.addVehicle(wingman, lowered);
+    error.clear();
+    REQUIRE_FALSE(shifted_fleet.start(&error));
+    REQUIRE(error.find("vehicle 1") != std::string::npos);
+    REQUIRE(shifted_fleet.activeCount() == 0);
+
+    std::filesystem::remove(airspace_path);
+    std::filesystem::remove(low_path);
+    std::filesystem::remove(high_path);
+}
+
+TEST_CASE("AirspaceMonitor reports entry and clearance from swept segments", "[Airspace]") {
+    auto index = std::make_shared<const drone::mission::AirspaceIndex>(
+        std::vector<AirspaceVolume>{box("wall", 10.0, -5.0, 10.5, 5.0, 0.0, 20.0)});
+    drone::mission::AirspaceMonitor monitor(index);
+
+    REQUIRE_FALSE(monitor.update(Vector3(0.0, 0.0, 10.0)).hit);
+    REQUIRE_FALSE(monitor.update(Vector3(8.0, 0.0, 10.0)).hit);
+
+    // one tick jumps over the wall entirely
+    const auto crossing = monitor.update(Vector3(13.0, 0.0, 10.0));
+    REQUIRE(crossing.entered);
+    REQUIRE(crossing.first_hit.point_enu_m.x == Catch::Approx(10.0));
+
+    const auto after = monitor.update(Vector3(16.0, 0.0, 10.0));
+    REQUIRE(after.cleared);
+    REQUIRE(monitor.stats().queries == 4);
+}
@@ -0,0 +1,140 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "drone/mission/completion_evaluator.h"
+#include "drone/mission/completion_predicate.h"
+#include "drone/runtime/real_drone.h"
+
+using namespace drone::mission;
+
+namespace {
+
+CompletionCriteria makeCriteria(CompletionConditionType type) {
+    CompletionCriteria criteria;
+    criteria.condition_type = type;
+    criteria.target_altitude_m = 20.0;
+    criteria.altitude_tolerance_m = 1.0;
+    criteria.target_position_enu_m = drone::Vector3(5.0, -5.0, 0.0);
+    criteria.position_tolerance_m = 2.0;
+    criteria.max_velocity_mps = 1.5;
+    criteria.target_yaw_rad = 3.0;
+    criteria.yaw_tolerance_rad = 0.3;
+    criteria.target_pitch_rad = 0.1;
+    criteria.pitch_tolerance_rad = 0.05;
+    criteria.target_roll_rad = -0.1;
+    criteria.roll_tolerance_rad = 0.05;
+    return criteria;
+}
+
+}  // namespace
+
+TEST_CASE("Compiled completion predicates test each condition type", "[CompletionPredicate]") {
+    drone::runtime::SensorFrame frame{};
+
+    const auto position = compileCompletionCriteria(makeCriteria(CompletionConditionType::POSITION_REACHED));
+    frame.position_enu_x_m = 6.0;
+    frame.position_enu_y_m = -6.0;  // 1.41 m off
+    frame.position_enu_z_m = 20.5;
+    REQUIRE(testCompletionPredicate(position, frame));
+    frame.position_enu_x_m = 7.0;  // 2.24 m off
+    REQUIRE_FALSE(testCompletionPredicate(position, frame));
+    frame.position_enu_x_m = 5.0;
+    frame.altitude_m = 100.0;  // position_reached reads position_enu_z_m, not altitude_m
+    REQUIRE(testCompletionPredicate(position, frame));
+
+    const auto hover = compileCompletionCriteria(makeCriteria(CompletionConditionType::ALTITUDE_AND_VELOCITY));
+    frame.altitude_m = 19.2;
+    frame.gps_velocity_north_mps = 1.0;
+    frame.gps_velocity_east_mps = 1.0;
+    REQUIRE(testCompletionPredicate(hover, frame));
+    frame.gps_velocity_down_mps = 1.0;  // 1.73 m/s
+    REQUIRE_FALSE(testCompletionPredicate(hover, frame));
+
+    // yaw error wraps the short way round: 3.0 rad to -3.1 rad is 0.18 rad
+    const auto yaw = compileCompletionCriteria(makeCriteria(CompletionConditionType::YAW_REACHED));
+    frame.yaw_rad = -3.1;
+    REQUIRE(testCompletionPredicate(yaw, frame));
+    frame.yaw_rad = 2.6;
+    REQUIRE_FALSE(testCompletionPredicate(yaw, frame));
+
+    const auto landed = compileCompletionCriteria(makeCriteria(CompletionConditionType::LANDED));
+    frame.altitude_agl_m = -0.5;  // below the terrain estimate still counts as landed
+    REQUIRE(testCompletionPredicate(landed, frame));
+    frame.altitude_agl_m = 1.5;
+    REQUIRE_FALSE(testCompletionPredicate(landed, frame));
+
+    const auto timed = compileCompletionCriteria(makeCriteria(CompletionConditionType::TIME_ELAPSED));
+    REQUIRE(testCompletionPredicate(timed, frame));
+}
+
+TEST_CASE("Batch predicate evaluation matches the per-frame test", "[CompletionPredicate]") {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> position(-3.0, 13.0);
+    std::uniform_real_distribution<double> altitude(17.0, 23.0);
+    std::uniform_real_distribution<double> agl(-1.0, 22.0);  // covers landed and agl_reached
+    std::uniform_real_distribution<double> velocity(-1.5, 1.5);
+    std::uniform_real_distribution<double> angle(-M_PI, M_PI);
+    std::uniform_real_distribution<double> tilt(-0.12, 0.12);
+
+    constexpr std::size_t kVehicles = 1025;
+    std::vector<drone::runtime::SensorFrame> frames(kVehicles);
+    CompletionFrameBatch batch;
+    batch.resize(kVehicles);
+    for (std::size_t i = 0; i < kVehicles; ++i) {
+        auto& frame = frames[i];
+        frame.altitude_m = altitude(rng);
+        frame.altitude_agl_m = agl(rng);
+        frame.position_enu_x_m = position(rng);
+        frame.position_enu_y_m = -position(rng);
+        frame.position_enu_z_m = altitude(rng);
+        frame.gps_velocity_north_mps = velocity(rng);
+        frame.gps_velocity_east_mps = velocity(rng);
+        frame.gps_velocity_down_mps = velocity(rng);
+        frame.yaw_rad = angle(rng);
+        frame.pitch_rad = tilt(rng);
+        frame.roll_rad = tilt(rng);
+        batch.set(i, frame);
+    }
+
+    std::vector<std::uint8_t> met(kVehicles);
+    for (int type = static_cast<int>(CompletionConditionType::TIME_ELAPSED);
+         type <= static_cast<int>(CompletionConditionType::AGL_REACHED); ++type) {
+        const auto predicate = compileCompletionCriteria(makeCriteria(static_cast<CompletionConditionType>(type)));
+        testCompletionPredicateBatch(predicate, batch, met.data());
+        std::size_t met_count = 0;
+        for (std::size_t i = 0; i < kVehicles; ++i) {
+            REQUIRE(static_cast<bool>(met[i]) == testCompletionPredicate(predicate, frames[i]));
+            met_count += met[i];
+        }
+        CAPTURE(type);
+        REQUIRE(met_count > 0);
+    }
+}
+
+TEST_CASE("CompletionEvaluator holds a batched result over time", "[CompletionPredicate]") {
+    CompletionCriteria criteria = makeCriteria(CompletionConditionType::ALTITUDE_REACHED);
+    criteria.hold_duration_s = 0.2;
+    const auto predicate = compileCompletionCriteria(criteria);
+
+    CompletionFrameBatch batch;
+    batch.resize(2);
+    drone::runtime::SensorFrame frame{};
+    frame.altitude_m = 20.0;
+    batch.set(0, frame);
+    frame.altitude_m = 25.0;
+    batch.set(1, frame);
+
+    std::vector<CompletionEvaluator> evaluators(2);
+    std::uint8_t met[2] = {};
+    testCompletionPredicateBatch(predicate, batch, met);
+    bool done = false;
+    for (int tick = 0; tick < 3; ++tick) {
+        done = evaluators[0].accumulate(met[0] != 0, predicate.hold_duration_s, 0.1);
+        REQUIRE_FALSE(evaluators[1].accumulate(met[1] != 0, predicate.hold_duration_s, 0.1));
+    }
+    REQUIRE(done);
+}
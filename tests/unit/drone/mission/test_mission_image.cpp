@@ -0,0 +1,179 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "drone/mission/mission_executor.h"
+#include "drone/mission/mission_image.h"
+#include "drone/model/components/altitude_controler.h"
+#include "drone/runtime/real_drone.h"
+
+using namespace drone::mission;
+
+namespace {
+
+Mission makeMission() {
+    Mission mission;
+    mission.name = "image_test";
+    mission.version = "1.0";
+    mission.airspace_file = "airspace/blocks.yaml";
+    mission.initial_conditions.altitude_m = 2.0;
+
+    MissionStep climb;
+    climb.step_id = 1;
+    climb.name = "climb";
+    auto hover = std::make_unique<HoverAction>();
+    hover->target_altitude_m = 5.0;
+    climb.action = std::move(hover);
+    climb.advance_mode = AdvanceMode::TIME_BASED;
+    climb.duration_s = 0.1;
+
+    MissionStep leg;
+    leg.step_id = 2;
+    leg.name = "leg";
+    auto go_to = std::make_unique<GoToPositionAction>();
+    go_to->target_position_enu_m = drone::Vector3(10.0, -4.0, 0.0);
+    go_to->target_altitude_m = 12.0;
+    go_to->altitude_mode = "agl";
+    go_to->max_velocity_mps = 4.0;
+    leg.action = std::move(go_to);
+    leg.advance_mode = AdvanceMode::COMPLETION_BASED;
+    leg.completion_criteria.condition_type = CompletionConditionType::POSITION_REACHED;
+    leg.completion_criteria.target_position_enu_m = drone::Vector3(10.0, -4.0, 0.0);
+    leg.completion_criteria.position_tolerance_m = 0.5;
+    leg.timeout_behavior = TimeoutBehavior::RETRY;
+    leg.retry_count = 2;
+
+    mission.steps.emplace_back(std::move(climb));
+    mission.steps.emplace_back(std::move(leg));
+    return mission;
+}
+
+std::vector<char> readBytes(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void writeBytes(const std::filesystem::path& path, const std::vector<char>& bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+}  // namespace
+
+TEST_CASE("MissionImage round-trips a mission through a mapped file", "[MissionImage]") {
+    const auto path = std::filesystem::temp_directory_path() / "mission_image_roundtrip.vdm";
+    const auto compiled = MissionImage::fromMission(makeMission());
+    REQUIRE(compiled);
+    REQUIRE(compiled->write(path.string()));
+    REQUIRE(MissionImage::isImageFile(path.string()));
+
+    std::string error;
+    const auto image = MissionImage::open(path.string(), &error);
+    REQUIRE(image);
+    REQUIRE(image->name() == "image_test");
+    REQUIRE(image->stepCount() == 2);
+    REQUIRE(image->initialConditions().altitude_m == 2.0);
+    REQUIRE(image->airspaceFile() ==
+            (path.parent_path() / "airspace/blocks.yaml").lexically_normal().string());
+
+    const FlatMissionStep& leg = image->step(1);
+    REQUIRE(leg.step_id == 2);
+    REQUIRE(std::string(image->string(leg.name_offset)) == "leg");
+    REQUIRE(leg.actionType() == ActionType::GO_TO_POSITION);
+    REQUIRE(leg.altitude_agl == 1);
+    REQUIRE(leg.action.target_x_m == 10.0);
+    REQUIRE(leg.action.target_y_m == -4.0);
+    REQUIRE(leg.action.max_velocity_mps == 4.0);
+    REQUIRE(leg.timeoutBehavior() == TimeoutBehavior::RETRY);
+    REQUIRE(leg.retry_count == 2);
+    REQUIRE(leg.completion_criteria.position_tolerance_m == 0.5);
+    REQUIRE(describeFlatAction(leg) == "Fly to (10.000000, -4.000000) at 12.000000m");
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("MissionImage rejects foreign, stale and corrupt files", "[MissionImage]") {
+    const auto dir = std::filesystem::temp_directory_path();
+    const auto good_path = dir / "mission_image_good.vdm";
+    REQUIRE(MissionImage::fromMission(makeMission())->write(good_path.string()));
+    const std::vector<char> good = readBytes(good_path);
+
+    const auto yaml_path = dir / "mission_image_not_an_image.yaml";
+    writeBytes(yaml_path, std::vector<char>{'m', 'i', 's', 's', 'i', 'o', 'n', ':', '\n'});
+    REQUIRE_FALSE(MissionImage::isImageFile(yaml_path.string()));
+    REQUIRE_FALSE(MissionImage::open(yaml_path.string()));
+
+    std::string error;
+    auto stale = good;
+    const std::uint32_t old_version = kMissionImageVersion + 1;
+    std::memcpy(stale.data() + offsetof(MissionImageHeader, version), &old_version, sizeof(old_version));
+    const auto stale_path = dir / "mission_image_stale.vdm";
+    writeBytes(stale_path, stale);
+    REQUIRE_FALSE(MissionImage::open(stale_path.string(), &error));
+    REQUIRE(error.find("recompile") != std::string::npos);
+
+    auto truncated = good;
+    truncated.resize(truncated.size() - 8);
+    const auto truncated_path = dir / "mission_image_truncated.vdm";
+    writeBytes(truncated_path, truncated);
+    REQUIRE_FALSE(MissionImage::open(truncated_path.string()));
+
+    auto bad_enum = good;
+    MissionImageHeader header;
+    std::memcpy(&header, good.data(), sizeof(header));
+    const std::int32_t bogus_action = 99;
+    std::memcpy(bad_enum.data() + header.steps_offset + offsetof(FlatMissionStep, action_type),
+                &bogus_action, sizeof(bogus_action));
+    const auto bad_enum_path = dir / "mission_image_bad_enum.vdm";
+    writeBytes(bad_enum_path, bad_enum);
+    REQUIRE_FALSE(MissionImage::open(bad_enum_path.string()));
+
+    // a strings offset whose end wraps past 2^64 back inside the file
+    auto wrapped = good;
+    const std::uint64_t wrapping_offset = ~std::uint64_t{0} - header.string_table_size + 2;
+    std::memcpy(wrapped.data() + offsetof(MissionImageHeader, strings_offset), &wrapping_offset,
+                sizeof(wrapping_offset));
+    const auto wrapped_path = dir / "mission_image_wrapped.vdm";
+    writeBytes(wrapped_path, wrapped);
+    error.clear();
+    REQUIRE_FALSE(MissionImage::open(wrapped_path.string(), &error));
+    REQUIRE(error.find("layout") != std::string::npos);
+
+    for (const auto& path : {good_path, yaml_path, stale_path, truncated_path, bad_enum_path, wrapped_path}) {
+        std::filesystem::remove(path);
+    }
+}
+
+TEST_CASE("MissionExecutor runs a mapped image without the source mission", "[MissionImage]") {
+    const auto path = std::filesystem::temp_directory_path() / "mission_image_execute.vdm";
+    {
+        Mission mission = makeMission();
+        mission.airspace_file.clear();
+        REQUIRE(MissionImage::fromMission(mission)->write(path.string()));
+    }
+
+    drone::model::components::AltitudeController altitude_controller;
+    drone::runtime::RealDrone real_drone(altitude_controller);
+    REQUIRE(real_drone.loadMissionFromFile(path.string()));
+    real_drone.startMission();
+
+    drone::runtime::SensorFrame sensor{};
+    real_drone.updateMission(sensor, 0.1);
+    REQUIRE(real_drone.getCurrentMissionStepId() == 2);
+    REQUIRE(real_drone.getCurrentMissionStepName() == "leg");
+
+    sensor.position_enu_x_m = 10.0;
+    sensor.position_enu_y_m = -4.0;
+    real_drone.updateMission(sensor, 0.01);
+    REQUIRE(real_drone.getMissionStatus() == MissionStatus::COMPLETED);
+
+    std::filesystem::remove(path);
+}
@@ -130,3 +130,29 @@ TEST_CASE("MissionLoader falls back to TIME_ELAPSED for unknown condition_type",
 
     std::filesystem::remove(yaml_path);
 }
+
+TEST_CASE("MissionLoader rejects unknown go_to_position modes", "[MissionLoader]") {
+    const auto loadError = [](const std::string& mode_line) {
+        const auto yaml_path = writeTestYaml(
+            "mission_loader_go_to_mode.yaml",
+            "mission:\n"
+            "  steps:\n"
+            "    - step_id: 3\n"
+            "      action: 'go_to_position'\n"
+            "      target_position_enu_m: { x: 10.0, y: 0.0 }\n"
+            "      target_altitude_m: 5.0\n" +
+                mode_line);
+        drone::mission::MissionLoader loader;
+        drone::mission::Mission mission;
+        std::string error;
+        const bool ok = loader.loadFromFile(yaml_path.string(), mission, &error);
+        std::filesystem::remove(yaml_path);
+        return ok ? std::string() : error;
+    };
+
+    REQUIRE(loadError("      trajectory: 'min_jerk'\n      altitude_mode: 'agl'\n").empty());
+    REQUIRE(loadError("      trajectory: 'minjerk'\n") ==
+            "step_id=3 has unknown trajectory 'minjerk' (expected direct or min_jerk)");
+    REQUIRE(loadError("      altitude_mode: 'AGL'\n") ==
+            "step_id=3 has unknown altitude_mode 'AGL' (expected absolute or agl)");
+}
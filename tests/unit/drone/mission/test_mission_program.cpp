@@ -0,0 +1,209 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "drone/mission/mission_executor.h"
+#include "drone/mission/mission_image.h"
+#include "drone/mission/mission_loader.h"
+#include "drone/mission/mission_program.h"
+#include "drone/model/components/altitude_controler.h"
+#include "drone/runtime/real_drone.h"
+
+using namespace drone::mission;
+
+namespace {
+
+std::filesystem::path writeTestYaml(const std::string& filename, const std::string& content) {
+    const auto path = std::filesystem::temp_directory_path() / filename;
+    std::ofstream out(path.string(), std::ios::trunc);
+    out << content;
+    out.close();
+    return path;
+}
+
+std::string compileError(const std::string& source) {
+    std::vector<MissionInstruction> code;
+    std::string error;
+    REQUIRE_FALSE(compileMissionProgram(source, {1, 2}, code, &error));
+    return error;
+}
+
+// Runs the VM with a default sensor frame and collects the step indices it emits
+std::vector<std::size_t> emittedSteps(const std::vector<MissionInstruction>& code, MissionVm& vm,
+                                      const drone::runtime::SensorFrame& sensor) {
+    std::vector<std::size_t> steps;
+    for (;;) {
+        const MissionVmResult result = vm.run(code.data(), code.size(), sensor, kDefaultMissionVmBudget);
+        if (result.state != MissionVmState::STEP) {
+            REQUIRE(result.state == MissionVmState::DONE);
+            return steps;
+        }
+        steps.push_back(result.step_index);
+    }
+}
+
+}  // namespace
+
+TEST_CASE("Mission programs compile loops, branches and variables", "[MissionProgram]") {
+    std::vector<MissionInstruction> code;
+    std::string error;
+    REQUIRE(compileMissionProgram(
+        "run 10            # takeoff\n"
+        "set laps 0\n"
+        "repeat 2\n"
+        "  repeat 3\n"
+        "    run 20\n"
+        "  end\n"
+        "  add laps 1\n"
+        "  if laps >= 2 goto home\n"
+        "end\n"
+        "run 20\n"
+        "home:\n"
+        "run 30\n",
+        {10, 20, 30}, code, &error));
+
+    MissionVm vm;
+    vm.reset();
+    drone::runtime::SensorFrame sensor{};
+    REQUIRE(emittedSteps(code, vm, sensor) == std::vector<std::size_t>{0, 1, 1, 1, 1, 1, 1, 2});
+    REQUIRE(vm.variable(0) == 2.0);
+    REQUIRE(validateMissionProgram(code.data(), code.size(), 3));
+    REQUIRE_FALSE(validateMissionProgram(code.data(), code.size(), 2));  // run 30 has no step
+}
+
+TEST_CASE("Mission programs branch on SensorFrame fields", "[MissionProgram]") {
+    std::vector<MissionInstruction> code;
+    REQUIRE(compileMissionProgram(
+        "loop:\n"
+        "if battery_soc_percent < 30 goto home\n"
+        "run 1\n"
+        "goto loop\n"
+        "home:\n"
+        "run 2\n"
+        "done\n",
+        {1, 2}, code));
+
+    MissionVm vm;
+    vm.reset();
+    drone::runtime::SensorFrame sensor{};
+    sensor.battery_soc_percent = 80.0;
+    for (int lap = 0; lap < 5; ++lap) {
+        const auto result = vm.run(code.data(), code.size(), sensor, kDefaultMissionVmBudget);
+        REQUIRE(result.state == MissionVmState::STEP);
+        REQUIRE(result.step_index == 0);
+    }
+    sensor.battery_soc_percent = 25.0;
+    const auto home = vm.run(code.data(), code.size(), sensor, kDefaultMissionVmBudget);
+    REQUIRE(home.state == MissionVmState::STEP);
+    REQUIRE(home.step_index == 1);
+    REQUIRE(vm.run(code.data(), code.size(), sensor, kDefaultMissionVmBudget).state == MissionVmState::DONE);
+}
+
+TEST_CASE("MissionVm bounds the instructions executed per run", "[MissionProgram]") {
+    std::vector<MissionInstruction> code;
+    REQUIRE(compileMissionProgram("set n 0\nspin:\nadd n 1\ngoto spin\n", {}, code));
+
+    MissionVm vm;
+    vm.reset();
+    drone::runtime::SensorFrame sensor{};
+    for (int tick = 0; tick < 100; ++tick) {
+        REQUIRE(vm.run(code.data(), code.size(), sensor, 10).state == MissionVmState::YIELD);
+    }
+    REQUIRE(vm.instructionsExecuted() == 1000);
+}
+
+TEST_CASE("Mission program compile errors name the line", "[MissionProgram]") {
+    REQUIRE(compileError("run 1\nrun 7\n") == "program line 2: run references unknown step_id=7");
+    REQUIRE(compileError("goto nowhere\n") == "program line 1: unknown label 'nowhere'");
+    REQUIRE(compileError("add laps 1\n") == "program line 1: variable 'laps' is used before 'set'");
+    REQUIRE(compileError("if speed > 3 goto x\nx:\n") ==
+            "program line 1: unknown variable or sensor field 'speed'");
+    REQUIRE(compileError("repeat 2\nrun 1\n") == "program: 'repeat' opened on line 1 has no 'end'");
+    REQUIRE(compileError("end\n") == "program line 1: 'end' without 'repeat'");
+    REQUIRE(compileError("fly 1\n") == "program line 1: cannot parse 'fly' statement");
+
+    std::string too_many;
+    for (int i = 0; i <= static_cast<int>(kMaxMissionVariables); ++i) {
+        too_many += "set v" + std::to_string(i) + " 0\n";
+    }
+    REQUIRE(compileError(too_many).find("more than 16 variables") != std::string::npos);
+}
+
+TEST_CASE("MissionExecutor runs a YAML program from a compiled image", "[MissionProgram]") {
+    const auto yaml_path = writeTestYaml(
+        "mission_program_patrol.yaml",
+        "mission:\n"
+        "  name: 'Program Test'\n"
+        "  program: |\n"
+        "    repeat 3\n"
+        "      run 2\n"
+        "      run 1\n"
+        "    end\n"
+        "  steps:\n"
+        "    - step_id: 1\n"
+        "      name: 'A'\n"
+        "      action: 'hover'\n"
+        "      target_altitude_m: 5.0\n"
+        "      duration_s: 0.1\n"
+        "    - step_id: 2\n"
+        "      name: 'B'\n"
+        "      action: 'change_altitude'\n"
+        "      target_altitude_m: 8.0\n"
+        "      duration_s: 0.1\n");
+
+    Mission mission;
+    std::string error;
+    REQUIRE(MissionLoader().loadFromFile(yaml_path.string(), mission, &error));
+    REQUIRE(mission.program.size() == 6);
+
+    const auto image_path = std::filesystem::temp_directory_path() / "mission_program_patrol.vdm";
+    REQUIRE(MissionImage::fromMission(mission)->write(image_path.string()));
+    const auto image = MissionImage::open(image_path.string(), &error);
+    REQUIRE(image);
+    REQUIRE(image->instructionCount() == 6);
+
+    drone::model::components::AltitudeController altitude_controller;
+    drone::runtime::RealDrone real_drone(altitude_controller);
+    MissionExecutor executor;
+    executor.loadMission(image);
+    REQUIRE(executor.hasProgram());
+    executor.start();
+
+    drone::runtime::SensorFrame sensor{};
+    std::vector<int> step_ids;
+    while (executor.getStatus() == MissionStatus::RUNNING) {
+        executor.update(real_drone, sensor, 0.05);
+        const int step_id = executor.getCurrentStepId();
+        if (step_id >= 0 && (step_ids.empty() || step_ids.back() != step_id)) {
+            step_ids.push_back(step_id);
+        }
+    }
+    REQUIRE(executor.getStatus() == MissionStatus::COMPLETED);
+    REQUIRE(step_ids == std::vector<int>{2, 1, 2, 1, 2, 1});
+
+    std::filesystem::remove(yaml_path);
+    std::filesystem::remove(image_path);
+}
+
+TEST_CASE("MissionLoader reports program errors", "[MissionProgram]") {
+    const auto yaml_path = writeTestYaml(
+        "mission_program_invalid.yaml",
+        "mission:\n"
+        "  program: |\n"
+        "    run 1\n"
+        "    run 9\n"
+        "  steps:\n"
+        "    - step_id: 1\n"
+        "      action: 'hover'\n"
+        "      target_altitude_m: 5.0\n");
+
+    Mission mission;
+    std::string error;
+    REQUIRE_FALSE(MissionLoader().loadFromFile(yaml_path.string(), mission, &error));
+    REQUIRE(error == "program line 2: run references unknown step_id=9");
+
+    std::filesystem::remove(yaml_path);
+}
@@ -0,0 +1,230 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "drone/mission/mission_executor.h"
+#include "drone/mission/mission_loader.h"
+#include "drone/mission/mission_patterns.h"
+#include "drone/mission/mission_stream.h"
+#include "drone/model/components/altitude_controler.h"
+#include "drone/runtime/real_drone.h"
+
+using namespace drone::mission;
+
+namespace {
+
+std::shared_ptr<const MissionImage> makeSingleStepImage(int step_id, const std::string& name,
+                                                        std::unique_ptr<MissionAction> action) {
+    Mission mission;
+    MissionStep step;
+    step.step_id = step_id;
+    step.name = name;
+    step.action = std::move(action);
+    step.advance_mode = AdvanceMode::TIME_BASED;
+    step.duration_s = 0.1;
+    mission.steps.emplace_back(std::move(step));
+    return MissionImage::fromMission(mission);
+}
+
+// Puts the vehicle on the current step's target and ticks once
+void flyCurrentLeg(MissionExecutor& executor, drone::runtime::RealDrone& real_drone,
+                   drone::runtime::SensorFrame& sensor) {
+    const FlatMissionStep* step = executor.peekStep(0);
+    sensor.position_enu_x_m = step->action.target_x_m;
+    sensor.position_enu_y_m = step->action.target_y_m;
+    sensor.position_enu_z_m = step->action.target_altitude_m;
+    executor.update(real_drone, sensor, 0.1);
+}
+
+}  // namespace
+
+TEST_CASE("Pattern generators expand waypoints from their index", "[MissionStream]") {
+    PatternLegConfig leg;
+
+    LawnmowerConfig lawnmower;
+    lawnmower.origin_enu_m = drone::Vector3(10.0, 20.0, 0.0);
+    lawnmower.length_m = 100.0;
+    lawnmower.width_m = 30.0;
+    lawnmower.lane_spacing_m = 10.0;
+    LawnmowerPattern grid(lawnmower, leg);
+    REQUIRE(grid.waypointCount() == 8);
+    REQUIRE(grid.waypoint(0).x == Catch::Approx(10.0));
+    REQUIRE(grid.waypoint(1).x == Catch::Approx(110.0));
+    REQUIRE(grid.waypoint(2).x == Catch::Approx(110.0));  // second lane runs back
+    REQUIRE(grid.waypoint(2).y == Catch::Approx(30.0));
+    REQUIRE(grid.waypoint(3).x == Catch::Approx(10.0));
+    REQUIRE(grid.waypoint(7).y == Catch::Approx(50.0));
+
+    lawnmower.heading_rad = M_PI / 2.0;  // lanes along +y, stepping towards -x
+    LawnmowerPattern rotated(lawnmower, leg);
+    REQUIRE(rotated.waypoint(1).y == Catch::Approx(120.0));
+    REQUIRE(rotated.waypoint(2).x == Catch::Approx(0.0).margin(1e-9));
+
+    SpiralConfig spiral;
+    spiral.start_radius_m = 5.0;
+    spiral.end_radius_m = 25.0;
+    spiral.radius_step_per_turn_m = 10.0;
+    spiral.points_per_turn = 8;
+    SpiralPattern outwards(spiral, leg);
+    REQUIRE(outwards.waypointCount() == 17);
+    REQUIRE(outwards.waypoint(0).x == Catch::Approx(5.0));
+    REQUIRE(outwards.waypoint(16).x == Catch::Approx(25.0));
+
+    OrbitConfig orbit;
+    orbit.center_enu_m = drone::Vector3(-5.0, 0.0, 0.0);
+    orbit.radius_m = 10.0;
+    orbit.turns = 2.0;
+    orbit.points_per_turn = 12;
+    OrbitPattern circle(orbit, leg);
+    REQUIRE(circle.waypointCount() == 25);
+    for (std::size_t i = 0; i < circle.waypointCount(); ++i) {
+        const drone::Vector3 point = circle.waypoint(i);
+        REQUIRE(std::hypot(point.x + 5.0, point.y) == Catch::Approx(10.0));
+    }
+    REQUIRE(circle.waypoint(24).x == Catch::Approx(circle.waypoint(0).x));
+}
+
+TEST_CASE("MissionExecutor streams a large survey through a bounded window", "[MissionStream]") {
+    PatternLegConfig leg;
+    leg.first_step_id = 100;
+    leg.altitude_m = 30.0;
+    LawnmowerConfig lawnmower;
+    lawnmower.length_m = 2000.0;
+    lawnmower.width_m = 2000.0;
+    lawnmower.lane_spacing_m = 0.1;  // 20001 lanes, 40002 legs
+    const std::size_t leg_count = LawnmowerPattern(lawnmower, leg).waypointCount();
+    REQUIRE(leg_count == 40002);
+
+    drone::model::components::AltitudeController altitude_controller;
+    drone::runtime::RealDrone real_drone(altitude_controller);
+    drone::runtime::SensorFrame sensor{};
+
+    MissionExecutor executor;
+    executor.loadMission(std::make_unique<LawnmowerPattern>(lawnmower, leg), 8);
+    REQUIRE(executor.isStreaming());
+    REQUIRE(executor.getStreamWindowSize() == 8);
+    REQUIRE(executor.getStreamedStepCount() == 8);
+    REQUIRE(executor.peekStep(7) != nullptr);
+    REQUIRE(executor.peekStep(8) == nullptr);  // beyond the window
+
+    executor.start();
+    REQUIRE(executor.getCurrentStepId() == 100);
+    REQUIRE(executor.getCurrentStepName() == "lawnmower #0");
+
+    std::size_t legs_flown = 0;
+    while (executor.getStatus() == MissionStatus::RUNNING) {
+        REQUIRE(executor.getStreamWindowSize() <= 8);
+        REQUIRE(executor.getCurrentStepId() == 100 + static_cast<int>(legs_flown));
+        flyCurrentLeg(executor, real_drone, sensor);
+        ++legs_flown;
+    }
+    REQUIRE(executor.getStatus() == MissionStatus::COMPLETED);
+    REQUIRE(legs_flown == leg_count);
+    REQUIRE(executor.getStreamedStepCount() == leg_count);
+
+    // single-pass: a finished stream does not restart
+    executor.start();
+    REQUIRE(executor.getStatus() == MissionStatus::FAILED);
+}
+
+TEST_CASE("SequenceStepSource chains fixed steps around a generated pattern", "[MissionStream]") {
+    auto takeoff = std::make_unique<HoverAction>();
+    takeoff->target_altitude_m = 15.0;
+    auto land = std::make_unique<LandAction>();
+
+    PatternLegConfig leg;
+    leg.first_step_id = 10;
+    leg.altitude_m = 15.0;
+    OrbitConfig orbit;
+    orbit.radius_m = 20.0;
+    orbit.turns = 1.0;
+    orbit.points_per_turn = 4;
+
+    auto sequence = std::make_unique<SequenceStepSource>();
+    sequence->append(std::make_unique<ImageStepSource>(makeSingleStepImage(1, "takeoff", std::move(takeoff))));
+    sequence->append(std::make_unique<OrbitPattern>(orbit, leg));
+    sequence->append(std::make_unique<ImageStepSource>(makeSingleStepImage(99, "land", std::move(land))));
+
+    drone::model::components::AltitudeController altitude_controller;
+    drone::runtime::RealDrone real_drone(altitude_controller);
+    real_drone.loadMissionStream(std::move(sequence), 4);
+    REQUIRE(real_drone.hasMissionLoaded());
+    real_drone.startMission();
+
+    drone::runtime::SensorFrame sensor{};
+    std::vector<int> step_ids{real_drone.getCurrentMissionStepId()};
+    REQUIRE(real_drone.getCurrentMissionStepName() == "takeoff");
+    real_drone.updateMission(sensor, 0.1);
+
+    sensor.position_enu_z_m = 15.0;
+    while (real_drone.getMissionStatus() == MissionStatus::RUNNING) {
+        step_ids.push_back(real_drone.getCurrentMissionStepId());
+        if (real_drone.getCurrentMissionStepName() == "land") {
+            real_drone.updateMission(sensor, 0.1);
+            continue;
+        }
+        const double angle_rad = 0.5 * M_PI * (step_ids.back() - 10);
+        sensor.position_enu_x_m = 20.0 * std::cos(angle_rad);
+        sensor.position_enu_y_m = 20.0 * std::sin(angle_rad);
+        real_drone.updateMission(sensor, 0.1);
+    }
+
+    REQUIRE(real_drone.getMissionStatus() == MissionStatus::COMPLETED);
+    REQUIRE(step_ids == std::vector<int>{1, 10, 11, 12, 13, 14, 99});
+}
+
+TEST_CASE("Mission files stream a pattern section between their fixed steps", "[MissionStream]") {
+    const auto path = std::filesystem::temp_directory_path() / "mission_stream_pattern.yaml";
+    const std::string fixed_steps =
+        "mission:\n"
+        "  steps:\n"
+        "    - { step_id: 1, action: 'hover', target_altitude_m: 15.0, duration_s: 0.1 }\n"
+        "    - { step_id: 2, action: 'land', duration_s: 0.1 }\n";
+    std::ofstream(path) << fixed_steps
+                        << "  pattern:\n"
+                           "    type: 'orbit'\n"
+                           "    after_step_id: 1\n"
+                           "    window_steps: 3\n"
+                           "    radius_m: 20.0\n"
+                           "    points_per_turn: 4\n"
+                           "    altitude_m: 15.0\n";
+
+    Mission mission;
+    std::string error;
+    REQUIRE(MissionLoader().loadFromFile(path.string(), mission, &error));
+    REQUIRE(mission.pattern);
+    REQUIRE(mission.pattern->type == PatternType::ORBIT);
+    REQUIRE(mission.pattern->leg.first_step_id == 3);  // after the highest fixed step_id
+
+    auto stream = makeMissionPatternStream(MissionImage::fromMission(mission), *mission.pattern);
+    std::vector<int> step_ids;
+    FlatMissionStep step;
+    std::string name;
+    while (stream->next(step, name)) {
+        step_ids.push_back(step.step_id);
+    }
+    REQUIRE(step_ids == std::vector<int>{1, 3, 4, 5, 6, 7, 2});
+
+    drone::model::components::AltitudeController altitude_controller;
+    drone::runtime::RealDrone real_drone(altitude_controller);
+    REQUIRE(real_drone.loadMissionFromFile(path.string(), &error));
+    REQUIRE(real_drone.getMissionImage() == nullptr);
+    real_drone.startMission();
+    REQUIRE(real_drone.getCurrentMissionStepId() == 1);
+
+    std::ofstream(path) << fixed_steps << "  pattern: { type: 'zigzag' }\n";
+    REQUIRE_FALSE(MissionLoader().loadFromFile(path.string(), mission, &error));
+    REQUIRE(error.find("zigzag") != std::string::npos);
+
+    std::ofstream(path) << fixed_steps << "  program: |\n    run 1\n    run 2\n  pattern: { type: 'orbit' }\n";
+    REQUIRE_FALSE(MissionLoader().loadFromFile(path.string(), mission, &error));
+    REQUIRE(error.find("cannot be combined") != std::string::npos);
+
+    std::filesystem::remove(path);
+}
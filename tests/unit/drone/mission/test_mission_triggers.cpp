@@ -0,0 +1,345 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "drone/mission/mission_executor.h"
+#include "drone/mission/mission_image.h"
+#include "drone/mission/mission_loader.h"
+#include "drone/mission/mission_triggers.h"
+#include "drone/model/components/altitude_controler.h"
+#include "drone/runtime/real_drone.h"
+
+using namespace drone::mission;
+
+namespace {
+
+using Fired = std::vector<std::uint32_t>;
+
+std::filesystem::path writeTestYaml(const std::string& filename, const std::string& content) {
+    const auto path = std::filesystem::temp_directory_path() / filename;
+    std::ofstream out(path.string(), std::ios::trunc);
+    out << content;
+    out.close();
+    return path;
+}
+
+FlatMissionTrigger makeTrigger(MissionSensorField field, MissionTriggerDirection direction,
+                               double threshold, double hysteresis) {
+    FlatMissionTrigger trigger;
+    trigger.field = static_cast<std::uint8_t>(field);
+    trigger.direction = static_cast<std::uint8_t>(direction);
+    trigger.action = static_cast<std::uint8_t>(MissionTriggerAction::ABORT);
+    trigger.threshold = threshold;
+    trigger.hysteresis = hysteresis;
+    return trigger;
+}
+
+const std::string kTriggerSteps =
+    "  steps:\n"
+    "    - step_id: 1\n"
+    "      name: 'Survey'\n"
+    "      action: 'hover'\n"
+    "      target_altitude_m: 20.0\n"
+    "      duration_s: 100.0\n"
+    "      timeout_s: 200.0\n"
+    "    - step_id: 2\n"
+    "      name: 'Land'\n"
+    "      action: 'land'\n"
+    "      advance_mode: 'completion_based'\n"
+    "      completion_criteria:\n"
+    "        condition_type: 'landed'\n"
+    "        altitude_tolerance_m: 0.2\n";
+
+}  // namespace
+
+TEST_CASE("Mission triggers fire once and re-arm past their hysteresis", "[MissionTriggers]") {
+    const std::vector<FlatMissionTrigger> triggers{
+        makeTrigger(MissionSensorField::BATTERY_SOC_PERCENT, MissionTriggerDirection::BELOW, 25.0, 5.0),
+        makeTrigger(MissionSensorField::MOTOR_TEMPERATURE_C, MissionTriggerDirection::ABOVE, 80.0, 10.0),
+        makeTrigger(MissionSensorField::BATTERY_SOC_PERCENT, MissionTriggerDirection::BELOW, 10.0, 0.0),
+    };
+    const MissionTriggerTable table(triggers.data(), triggers.size());
+    REQUIRE(table.groupCount() == 2);
+
+    MissionTriggerMonitor monitor;
+    monitor.reset(table);
+    drone::runtime::SensorFrame frame{};
+    frame.battery_soc_percent = 50.0;
+    frame.motor_temperature_c = 40.0;
+    REQUIRE(monitor.update(table, frame).empty());
+
+    frame.battery_soc_percent = 24.0;
+    REQUIRE(monitor.update(table, frame) == Fired{0});
+    REQUIRE(monitor.update(table, frame).empty());  // still low, already fired
+    frame.battery_soc_percent = 28.0;              // inside the hysteresis band
+    REQUIRE(monitor.update(table, frame).empty());
+    frame.battery_soc_percent = 24.0;
+    REQUIRE(monitor.update(table, frame).empty());
+    frame.battery_soc_percent = 30.0;  // recovered: re-arms
+    REQUIRE(monitor.update(table, frame).empty());
+    frame.battery_soc_percent = 5.0;  // crosses both thresholds at once: both fire
+    REQUIRE(monitor.update(table, frame) == Fired{0, 2});
+    REQUIRE(selectMissionTrigger(table, Fired{0, 2}) == 0);
+    frame.battery_soc_percent = 12.0;  // trigger 2 has no hysteresis
+    REQUIRE(monitor.update(table, frame).empty());
+    frame.battery_soc_percent = 9.0;
+    REQUIRE(monitor.update(table, frame) == Fired{2});
+
+    frame.motor_temperature_c = 81.0;
+    REQUIRE(monitor.update(table, frame) == Fired{1});
+    frame.motor_temperature_c = 75.0;
+    REQUIRE(monitor.update(table, frame).empty());
+    frame.motor_temperature_c = 85.0;
+    REQUIRE(monitor.update(table, frame).empty());
+    frame.motor_temperature_c = 70.0;
+    REQUIRE(monitor.update(table, frame).empty());
+    frame.motor_temperature_c = 85.0;
+    REQUIRE(monitor.update(table, frame) == Fired{1});
+}
+
+TEST_CASE("Indexed trigger monitoring matches a per-trigger scan", "[MissionTriggers]") {
+    std::mt19937 rng(21);
+    std::uniform_real_distribution<double> threshold(0.0, 100.0);
+    std::uniform_real_distribution<double> hysteresis(0.0, 8.0);
+    const MissionSensorField fields[] = {
+        MissionSensorField::BATTERY_SOC_PERCENT,
+        MissionSensorField::MOTOR_TEMPERATURE_C,
+        MissionSensorField::ALTITUDE_M,
+    };
+
+    std::vector<FlatMissionTrigger> triggers;
+    for (int i = 0; i < 300; ++i) {
+        triggers.push_back(makeTrigger(fields[i % 3],
+                                       i % 2 == 0 ? MissionTriggerDirection::BELOW : MissionTriggerDirection::ABOVE,
+                                       threshold(rng), hysteresis(rng)));
+    }
+    const MissionTriggerTable table(triggers.data(), triggers.size());
+    REQUIRE(table.groupCount() == 6);
+
+    MissionTriggerMonitor monitor;
+    monitor.reset(table);
+    std::vector<bool> armed(triggers.size(), true);
+    std::normal_distribution<double> walk(0.0, 6.0);
+    drone::runtime::SensorFrame frame{};
+    frame.battery_soc_percent = frame.motor_temperature_c = frame.altitude_m = 50.0;
+
+    int fired_total = 0;
+    for (int tick = 0; tick < 2000; ++tick) {
+        frame.battery_soc_percent += walk(rng);
+        frame.motor_temperature_c += walk(rng);
+        frame.altitude_m += walk(rng);
+
+        Fired expected;
+        for (std::size_t i = 0; i < triggers.size(); ++i) {
+            const auto& trigger = triggers[i];
+            const double value = readMissionSensorField(frame, static_cast<MissionSensorField>(trigger.field));
+            const bool below = trigger.direction == static_cast<std::uint8_t>(MissionTriggerDirection::BELOW);
+            const bool active = below ? value < trigger.threshold : value > trigger.threshold;
+            const bool recovered = below ? value >= trigger.threshold + trigger.hysteresis
+                                         : value <= trigger.threshold - trigger.hysteresis;
+            if (active && armed[i]) {
+                armed[i] = false;
+                expected.push_back(static_cast<std::uint32_t>(i));
+            } else if (recovered) {
+                armed[i] = true;
+            }
+        }
+        REQUIRE(monitor.update(table, frame) == expected);
+        fired_total += static_cast<int>(expected.size());
+    }
+    REQUIRE(fired_total > 50);
+}
+
+TEST_CASE("MissionExecutor jumps to a step when a trigger fires", "[MissionTriggers]") {
+    const auto yaml_path = writeTestYaml(
+        "mission_triggers_goto.yaml",
+        "mission:\n"
+        "  name: 'Trigger Test'\n"
+        "  triggers:\n"
+        "    - name: 'low battery'\n"
+        "      field: battery_soc_percent\n"
+        "      below: 25.0\n"
+        "      hysteresis: 5.0\n"
+        "      action: 'goto_step'\n"
+        "      step_id: 2\n"
+        "    - name: 'ceiling'\n"
+        "      field: altitude_m\n"
+        "      above: 120.0\n"
+        "      action: 'abort'\n" +
+            kTriggerSteps);
+
+    Mission mission;
+    std::string error;
+    REQUIRE(MissionLoader().loadFromFile(yaml_path.string(), mission, &error));
+    REQUIRE(mission.triggers.size() == 2);
+
+    const auto image_path = std::filesystem::temp_directory_path() / "mission_triggers_goto.vdm";
+    REQUIRE(MissionImage::fromMission(mission)->write(image_path.string()));
+    const auto image = MissionImage::open(image_path.string(), &error);
+    REQUIRE(image);
+    REQUIRE(image->triggerCount() == 2);
+
+    drone::model::components::AltitudeController altitude_controller;
+    drone::runtime::RealDrone real_drone(altitude_controller);
+    MissionExecutor executor;
+    executor.loadMission(image);
+    executor.start();
+
+    drone::runtime::SensorFrame sensor{};
+    sensor.altitude_m = 20.0;
+    sensor.altitude_agl_m = 20.0;
+    sensor.battery_soc_percent = 60.0;
+    executor.update(real_drone, sensor, 0.1);
+    REQUIRE(executor.getCurrentStepId() == 1);
+
+    sensor.battery_soc_percent = 24.0;
+    executor.update(real_drone, sensor, 0.1);
+    REQUIRE(executor.getCurrentStepId() == 2);
+    REQUIRE(executor.getFiredTriggerCount() == 1);
+    REQUIRE(executor.getLastTriggerName() == "low battery");
+    REQUIRE(real_drone.getTargetAltitude() == 0.0);
+
+    sensor.altitude_m = 0.0;
+    sensor.altitude_agl_m = 0.0;
+    executor.update(real_drone, sensor, 0.1);
+    REQUIRE(executor.getStatus() == MissionStatus::COMPLETED);
+
+    // the abort trigger ends the mission from any step
+    executor.start();
+    sensor.battery_soc_percent = 60.0;
+    sensor.altitude_m = 130.0;
+    executor.update(real_drone, sensor, 0.1);
+    REQUIRE(executor.getStatus() == MissionStatus::ABORTED);
+    REQUIRE(executor.getLastTriggerName() == "ceiling");
+
+    std::filesystem::remove(yaml_path);
+    std::filesystem::remove(image_path);
+}
+
+TEST_CASE("Triggers crossing on the same frame all count and the abort wins", "[MissionTriggers]") {
+    const auto yaml_path = writeTestYaml(
+        "mission_triggers_same_frame.yaml",
+        "mission:\n"
+        "  triggers:\n"
+        "    - name: 'low battery'\n"
+        "      field: battery_soc_percent\n"
+        "      below: 25.0\n"
+        "      action: 'goto_step'\n"
+        "      step_id: 2\n"
+        "    - name: 'hot motor'\n"
+        "      field: motor_temperature_c\n"
+        "      above: 90.0\n"
+        "      action: 'goto_step'\n"
+        "      step_id: 1\n"
+        "    - name: 'geofence'\n"
+        "      field: airspace_breach\n"
+        "      above: 0.5\n"
+        "      action: 'abort'\n" +
+            kTriggerSteps);
+
+    Mission mission;
+    std::string error;
+    REQUIRE(MissionLoader().loadFromFile(yaml_path.string(), mission, &error));
+
+    drone::model::components::AltitudeController altitude_controller;
+    drone::runtime::RealDrone real_drone(altitude_controller);
+    MissionExecutor executor;
+    executor.loadMission(mission);
+    executor.start();
+
+    drone::runtime::SensorFrame sensor{};
+    sensor.altitude_agl_m = 20.0;
+    sensor.battery_soc_percent = 60.0;
+    executor.update(real_drone, sensor, 0.1);
+
+    // two jumps at once: both are consumed, the first listed is taken
+    sensor.battery_soc_percent = 20.0;
+    sensor.motor_temperature_c = 95.0;
+    executor.update(real_drone, sensor, 0.1);
+    REQUIRE(executor.getFiredTriggerCount() == 2);
+    REQUIRE(executor.getLastTriggerName() == "low battery");
+    REQUIRE(executor.getCurrentStepId() == 2);
+
+    // a jump and an abort at once: the abort wins whatever the order
+    executor.start();
+    sensor.battery_soc_percent = 60.0;
+    sensor.motor_temperature_c = 40.0;
+    executor.update(real_drone, sensor, 0.1);
+    sensor.battery_soc_percent = 20.0;
+    sensor.airspace_breach = 1.0;
+    executor.update(real_drone, sensor, 0.1);
+    REQUIRE(executor.getStatus() == MissionStatus::ABORTED);
+    REQUIRE(executor.getFiredTriggerCount() == 2);
+    REQUIRE(executor.getLastTriggerName() == "geofence");
+
+    std::filesystem::remove(yaml_path);
+}
+
+TEST_CASE("A trigger jump leaves the mission program", "[MissionTriggers]") {
+    const auto yaml_path = writeTestYaml(
+        "mission_triggers_program.yaml",
+        "mission:\n"
+        "  program: |\n"
+        "    loop:\n"
+        "    run 1\n"
+        "    goto loop\n"
+        "  triggers:\n"
+        "    - field: motor_temperature_c\n"
+        "      above: 90.0\n"
+        "      action: 'goto_step'\n"
+        "      step_id: 2\n" +
+            kTriggerSteps);
+
+    Mission mission;
+    std::string error;
+    REQUIRE(MissionLoader().loadFromFile(yaml_path.string(), mission, &error));
+    REQUIRE(mission.triggers.front().name == "trigger 1");
+
+    drone::model::components::AltitudeController altitude_controller;
+    drone::runtime::RealDrone real_drone(altitude_controller);
+    MissionExecutor executor;
+    executor.loadMission(mission);
+    executor.start();
+
+    drone::runtime::SensorFrame sensor{};
+    sensor.altitude_agl_m = 20.0;
+    executor.update(real_drone, sensor, 0.1);
+    REQUIRE(executor.getCurrentStepId() == 1);
+    sensor.motor_temperature_c = 95.0;
+    executor.update(real_drone, sensor, 0.1);
+    REQUIRE(executor.getCurrentStepId() == 2);
+    sensor.altitude_agl_m = 0.0;
+    executor.update(real_drone, sensor, 0.1);
+    REQUIRE(executor.getStatus() == MissionStatus::COMPLETED);  // the program does not resume
+
+    std::filesystem::remove(yaml_path);
+}
+
+TEST_CASE("MissionLoader reports trigger errors", "[MissionTriggers]") {
+    const auto loadError = [](const std::string& name, const std::string& trigger) {
+        const auto path = writeTestYaml(name, "mission:\n  triggers:\n" + trigger + kTriggerSteps);
+        Mission mission;
+        std::string error;
+        REQUIRE_FALSE(MissionLoader().loadFromFile(path.string(), mission, &error));
+        std::filesystem::remove(path);
+        return error;
+    };
+
+    REQUIRE(loadError("mission_triggers_field.yaml",
+                      "    - name: 'hot'\n      field: motor_temp\n      above: 90\n      action: 'abort'\n") ==
+            "trigger 'hot' has unknown field 'motor_temp'");
+    REQUIRE(loadError("mission_triggers_bounds.yaml",
+                      "    - field: altitude_m\n      above: 90\n      below: 1\n      action: 'abort'\n") ==
+            "trigger 'trigger 1' needs exactly one of 'below' or 'above'");
+    REQUIRE(loadError("mission_triggers_step.yaml",
+                      "    - field: altitude_m\n      above: 90\n      action: 'goto_step'\n      step_id: 7\n") ==
+            "trigger 'trigger 1' references unknown step_id=7");
+    REQUIRE(loadError("mission_triggers_action.yaml",
+                      "    - field: altitude_m\n      above: 90\n      action: 'land'\n") ==
+            "trigger 'trigger 1' has unknown action 'land'");
+}
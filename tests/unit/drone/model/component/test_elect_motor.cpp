@@ -26,4 +26,40 @@ TEST_CASE("ElecMotor initializes correctly", "[ElecMotor]") {
     REQUIRE(motor.getCurrentA() == 0.0);
     REQUIRE(motor.getTemperatureC() == 25.0); // Initial temperature
     REQUIRE(motor.getEfficiency() == specs.efficiency);
-}
\ No newline at end of file
+}
+
+TEST_CASE("ElecMotor shares interned specs between identical motors", "[ElecMotor]") {
+    ElecMotor motor_a("MotorA", io_spec, specs);
+    ElecMotor motor_b("MotorB", io_spec, specs);
+
+    ElecMotorSpecs other_specs = specs;
+    other_specs.blade_diameter_m = 0.3;
+    ElecMotor motor_c("MotorC", io_spec, other_specs);
+
+    REQUIRE(motor_a.getSharedSpecs() == motor_b.getSharedSpecs());
+    REQUIRE(motor_a.getSharedSpecs() != motor_c.getSharedSpecs());
+    REQUIRE(motor_c.getSpecs().blade_diameter_m == 0.3);
+}
+
+TEST_CASE("ElecMotor views external state storage", "[ElecMotor]") {
+    ElecMotor motor("TestMotor", io_spec, specs);
+    motor.setSpeedRPM(1200.0);
+
+    ElecMotorState external;
+    motor.bindState(&external);
+    REQUIRE(external.speed_rpm == 1200.0);
+
+    motor.setCurrentA(3.5);
+    REQUIRE(external.current_a == 3.5);
+
+    // moving the motor keeps the binding
+    ElecMotor moved(std::move(motor));
+    moved.setSpeedRPM(1500.0);
+    REQUIRE(external.speed_rpm == 1500.0);
+
+    moved.bindState(nullptr);
+    moved.setSpeedRPM(900.0);
+    REQUIRE(external.speed_rpm == 1500.0);
+    REQUIRE(moved.getSpeedRPM() == 900.0);
+    REQUIRE(moved.getCurrentA() == 3.5);
+}
@@ -146,4 +146,82 @@ TEST_CASE("Battery_Cell calculates voltage drop correctly, 4 cells", "[Battery_C
     battery.setStateOfChargePercent(0.0);
     REQUIRE(battery.getStateOfChargePercent() == 0.0);
     REQUIRE(battery.getVoltageV() == Approx(12.8).margin(0.1));
-}
\ No newline at end of file
+}
+
+// Constant-current discharge across the plateau/bottom-knee boundary in one step
+TEST_CASE("Battery_Cell discharge energy integrates OCV across segments", "[Battery_Cell]") {
+    Battery_Cell cell("Cell_1", 1000.0, 4.2);
+    BatteryCellPhysics::setStateOfChargePercent(cell, 50.0);
+    BatteryCellPhysics::setCurrentA(cell, 1.0);
+
+    // 1 A for 30 min draws 500 mAh: 50% -> 0%, crossing the 30% knee
+    const double energy_wh = BatteryCellPhysics::discharge(cell, 1800.0);
+    REQUIRE(cell.getStateOfChargePercent() == Approx(0.0).margin(1e-9));
+    REQUIRE(cell.getVoltageV() == Approx(3.2));
+
+    // 0-30%: mean 3.35 V over 300 mAh, 30-50%: mean ~3.5727 V over 200 mAh
+    const double v50 = 3.5 + (20.0 / 55.0) * 0.4;
+    const double expected_wh = 0.3 * 3.35 + 0.2 * 0.5 * (3.5 + v50);
+    REQUIRE(energy_wh == Approx(expected_wh).epsilon(1e-9));
+}
+
+TEST_CASE("Battery_Cell discharge stops at empty within a long step", "[Battery_Cell]") {
+    Battery_Cell cell("Cell_1", 1500.0, 4.2);
+    BatteryCellPhysics::setCurrentA(cell, 3.0);
+
+    // 3 A for 1 h would draw 3000 mAh; only 1500 mAh is available
+    const double energy_wh = BatteryCellPhysics::discharge(cell, 3600.0);
+    REQUIRE(cell.getRemainingCapacityMah() == Approx(0.0));
+    REQUIRE(energy_wh == Approx(1.5 * BatteryCellPhysics::integrateOpenCircuitVoltage(0.0, 100.0) / 100.0));
+}
+
+TEST_CASE("BatterySim advance matches many small updates", "[Battery_base]") {
+    BatterySim battery_big("Big", BatterySpecs(4, *cellSpecs, 0.35));
+    BatterySim battery_small("Small", BatterySpecs(4, *cellSpecs, 0.35));
+    battery_big.setCurrentA(10.0);
+    battery_small.setCurrentA(10.0);
+
+    battery_big.advance(120.0);
+    for (int i = 0; i < 12000; ++i) {
+        battery_small.advance(0.01);
+    }
+
+    REQUIRE(battery_big.getRemainingCapacityMah() == Approx(battery_small.getRemainingCapacityMah()));
+    REQUIRE(battery_big.getVoltageV() == Approx(battery_small.getVoltageV()));
+    REQUIRE(battery_big.getConsumedEnergyWh() == Approx(battery_small.getConsumedEnergyWh()).epsilon(1e-6));
+}
+
+TEST_CASE("BatterySim series-parallel pack aggregates", "[Battery_base]") {
+    BatterySim pack("Pack12S4P", BatterySpecs(12, *cellSpecs, 2.0, 4));
+    REQUIRE(pack.getCellCount() == 48);
+
+    pack.setStateOfChargePercent(100.0);
+    REQUIRE(pack.getVoltageV() == Approx(12 * 4.2));
+    REQUIRE(pack.getRemainingCapacityMah() == Approx(4 * cellSpecs->capacity_mah));
+
+    // 4 parallel cells share the pack current: 4 A for 1 h draws 1000 mAh per cell
+    pack.setCurrentA(4.0);
+    pack.advance(3600.0);
+    const double cell_soc = 100.0 * (1.0 - 1000.0 / cellSpecs->capacity_mah);
+    REQUIRE(pack.getStateOfChargePercent() == Approx(cell_soc));
+    REQUIRE(pack.getRemainingCapacityMah() == Approx(4 * (cellSpecs->capacity_mah - 1000.0)));
+    REQUIRE(pack.getVoltageV() == Approx(12 * BatteryCellPhysics::openCircuitVoltageV(cell_soc)));
+    REQUIRE(pack.getCurrentA() == 4.0);
+}
+
+TEST_CASE("BatterySim voltage at full depletion", "[Battery_base]") {
+    // drained to empty the pack rests at the 0% OCV of every cell
+    BatterySim pack("Pack4S", BatterySpecs(4, *cellSpecs, 0.35));
+    pack.setCurrentA(10.0);
+    pack.advance(2.0 * 3600.0);
+    REQUIRE(pack.getRemainingCapacityMah() == Approx(0.0));
+    REQUIRE(pack.getStateOfChargePercent() == Approx(0.0));
+    REQUIRE(pack.getVoltageV() == Approx(4 * 3.2));
+
+    // cells without capacity are cut off
+    BatterySim dead("Dead4S", BatterySpecs(4, CellSpecs(0.0, 4.2), 0.35));
+    REQUIRE(dead.getVoltageV() == 0.0);
+    dead.setCurrentA(10.0);
+    dead.advance(60.0);
+    REQUIRE(dead.getVoltageV() == 0.0);
+}
@@ -115,3 +115,29 @@ TEST_CASE("DroneBase allows component updates", "[DroneBase]") {
     REQUIRE(drone.getTemperatureSensor()->getName() == "TempB");
     REQUIRE(drone.getGPS() != nullptr);
 }
+
+TEST_CASE("DroneBase stores motor state contiguously", "[DroneBase]") {
+    ElecMotorSpecs motor_specs(15000.0, 14.8, 20.0, 0.9, 0.4, 0.12);
+    AnalogIOSpec motor_io_spec(
+        AnalogIOSpec::IODirection::OUTPUT,
+        AnalogIOSpec::CurrentRange::ZERO_TO_10V,
+        0, 10000
+    );
+
+    std::vector<ElecMotor> motors;
+    for (int i = 0; i < 4; ++i) {
+        motors.emplace_back("Motor" + std::to_string(i + 1), motor_io_spec, motor_specs);
+    }
+    motors[2].setSpeedRPM(2500.0);
+
+    DroneBase drone("TestDrone", std::move(motors), nullptr, nullptr, nullptr, 1.2);
+    DroneBase moved_drone(std::move(drone));
+
+    const auto& states = moved_drone.getMotorStates();
+    REQUIRE(states.size() == 4);
+    REQUIRE(states[2].speed_rpm == 2500.0);
+
+    moved_drone.getMotors()[1].setDesiredSpeedRPM(4000.0);
+    REQUIRE(states[1].desired_speed_rpm == 4000.0);
+    REQUIRE(moved_drone.getMotors()[0].getSharedSpecs() == moved_drone.getMotors()[3].getSharedSpecs());
+}
@@ -0,0 +1,135 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "simulator/environment/dryden_turbulence.h"
+#include "simulator/environment/weather_model.h"
+#include "simulator/random/gaussian_block.h"
+
+namespace {
+
+struct AxisStats {
+    double std = 0.0;
+    double lag_correlation = 0.0;
+};
+
+AxisStats statsFor(const std::vector<double>& values, std::size_t lag) {
+    double mean = 0.0;
+    for (const double v : values) {
+        mean += v;
+    }
+    mean /= static_cast<double>(values.size());
+    double variance = 0.0;
+    double covariance = 0.0;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        variance += (values[i] - mean) * (values[i] - mean);
+        if (i + lag < values.size()) {
+            covariance += (values[i] - mean) * (values[i + lag] - mean);
+        }
+    }
+    variance /= static_cast<double>(values.size());
+    covariance /= static_cast<double>(values.size() - lag);
+    return {std::sqrt(variance), covariance / variance};
+}
+
+std::vector<std::vector<double>> run(double dt_s, double duration_s, std::size_t block_size = 256) {
+    drone::simulator::environment::DrydenTurbulence dryden;
+    dryden.configure(drone::Vector3(0.5, 0.3, 0.2), drone::Vector3(10.0, 10.0, 10.0), 10.0, 7, block_size);
+    const auto steps = static_cast<std::size_t>(duration_s / dt_s);
+    std::vector<std::vector<double>> axes(3, std::vector<double>(steps));
+    for (std::size_t i = 0; i < steps; ++i) {
+        const auto sample = dryden.next(dt_s);
+        axes[0][i] = sample.x;
+        axes[1][i] = sample.y;
+        axes[2][i] = sample.z;
+    }
+    return axes;
+}
+
+}  // namespace
+
+TEST_CASE("GaussianBlockGenerator produces standard normal samples reproducibly", "[Random]") {
+    drone::simulator::random::GaussianBlockGenerator generator(11);
+    std::vector<double> samples(100001);
+    generator.fill(samples.data(), samples.size());
+
+    double mean = 0.0;
+    for (const double v : samples) {
+        mean += v;
+    }
+    mean /= static_cast<double>(samples.size());
+    double variance = 0.0;
+    for (const double v : samples) {
+        variance += (v - mean) * (v - mean);
+    }
+    variance /= static_cast<double>(samples.size());
+
+    REQUIRE(mean == Catch::Approx(0.0).margin(0.02));
+    REQUIRE(std::sqrt(variance) == Catch::Approx(1.0).margin(0.02));
+
+    drone::simulator::random::GaussianBlockGenerator replay(11);
+    std::vector<double> first(8);
+    replay.fill(first.data(), first.size());
+    for (std::size_t i = 0; i < first.size(); ++i) {
+        REQUIRE(first[i] == samples[i]);
+    }
+}
+
+TEST_CASE("DrydenTurbulence keeps configured std and correlation time across dt", "[DrydenTurbulence]") {
+    // tau = L / V = 1 s on every axis
+    for (const double dt_s : {0.01, 0.05}) {
+        const auto axes = run(dt_s, 4000.0);
+        const auto lag = static_cast<std::size_t>(std::lround(1.0 / dt_s));
+
+        const AxisStats x = statsFor(axes[0], lag);
+        const AxisStats y = statsFor(axes[1], lag);
+        const AxisStats z = statsFor(axes[2], lag);
+
+        REQUIRE(x.std == Catch::Approx(0.5).epsilon(0.08));
+        REQUIRE(y.std == Catch::Approx(0.3).epsilon(0.08));
+        REQUIRE(z.std == Catch::Approx(0.2).epsilon(0.08));
+
+        // normalized autocorrelation at one tau: e^{-1} longitudinal, e^{-1} (1 - 1/2) lateral/vertical
+        REQUIRE(x.lag_correlation == Catch::Approx(std::exp(-1.0)).margin(0.06));
+        const double lateral = 0.5 * std::exp(-1.0);
+        REQUIRE(y.lag_correlation == Catch::Approx(lateral).margin(0.06));
+        REQUIRE(z.lag_correlation == Catch::Approx(lateral).margin(0.06));
+    }
+}
+
+TEST_CASE("DrydenTurbulence stays continuous when dt changes", "[DrydenTurbulence]") {
+    drone::simulator::environment::DrydenTurbulence dryden;
+    dryden.configure(drone::Vector3(1.0, 1.0, 1.0), drone::Vector3(5.0, 5.0, 5.0), 5.0, 3, 16);
+
+    REQUIRE(dryden.next(0.0).x == 0.0);
+    double previous = dryden.next(0.01).x;
+    for (int i = 0; i < 40; ++i) {
+        const double dt_s = (i % 2 == 0) ? 0.01 : 0.011;
+        const double current = dryden.next(dt_s).x;
+        // tau = 1 s: consecutive samples stay strongly correlated when dt flips
+        REQUIRE(std::abs(current - previous) < 0.6);
+        previous = current;
+    }
+}
+
+TEST_CASE("WeatherModel uses Dryden turbulence when configured", "[WeatherModel]") {
+    drone::simulator::config::WeatherConfig config;
+    config.enabled = true;
+    config.turbulence_std_enu_ms2 = drone::Vector3(0.4, 0.4, 0.4);
+    config.turbulence_model = "dryden";
+    config.dryden_length_scale_m = drone::Vector3(20.0, 20.0, 20.0);
+    config.dryden_airspeed_mps = 10.0;
+
+    drone::simulator::environment::WeatherModel model;
+    model.setConfig(config);
+
+    std::vector<double> x;
+    for (int i = 1; i <= 100000; ++i) {
+        x.push_back(model.sample(i * 0.01).turbulence_accel_enu_ms2.x);
+    }
+    const AxisStats stats = statsFor(x, 200);
+    REQUIRE(stats.std == Catch::Approx(0.4).epsilon(0.1));
+    REQUIRE(stats.lag_correlation == Catch::Approx(std::exp(-1.0)).margin(0.08));
+}
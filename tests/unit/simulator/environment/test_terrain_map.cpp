@@ -0,0 +1,122 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "drone/runtime/real_drone.h"
+#include "drone/mission/completion_evaluator.h"
+#include "simulator/environment/terrain_map.h"
+
+using drone::simulator::environment::TerrainGridSpec;
+using drone::simulator::environment::TerrainMap;
+
+namespace {
+
+std::string makeTerrainDir(const std::string& name) {
+    const auto dir = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(dir);
+    return dir.string();
+}
+
+// plane h = 0.5 x + 0.25 y + 10 on a 2 x 3 tile grid
+TerrainGridSpec writePlane(const std::string& dir) {
+    TerrainGridSpec spec;
+    spec.tile_cells = 4;
+    spec.tiles_x = 2;
+    spec.tiles_y = 3;
+    spec.origin_x_m = -10.0;
+    spec.origin_y_m = 5.0;
+    spec.spacing_m = 2.0;
+    spec.default_height_m = -1.0;
+
+    const std::size_t width = spec.tiles_x * spec.tile_cells + 1;
+    const std::size_t height = spec.tiles_y * spec.tile_cells + 1;
+    std::vector<float> heights(width * height);
+    for (std::size_t j = 0; j < height; ++j) {
+        for (std::size_t i = 0; i < width; ++i) {
+            const double x = spec.origin_x_m + i * spec.spacing_m;
+            const double y = spec.origin_y_m + j * spec.spacing_m;
+            heights[j * width + i] = static_cast<float>(0.5 * x + 0.25 * y + 10.0);
+        }
+    }
+    REQUIRE(TerrainMap::write(dir, spec, heights));
+    return spec;
+}
+
+}  // namespace
+
+TEST_CASE("TerrainMap bilinear height is exact on a plane across tiles", "[TerrainMap]") {
+    const std::string dir = makeTerrainDir("virtd_terrain_plane");
+    writePlane(dir);
+    const auto terrain = TerrainMap::open(dir);
+    REQUIRE(terrain);
+
+    for (const double x : {-10.0, -7.3, -2.0, 0.0, 1.1, 5.9}) {
+        for (const double y : {5.0, 8.7, 13.0, 20.2, 28.9}) {
+            REQUIRE(terrain->heightAtM(x, y) == Catch::Approx(0.5 * x + 0.25 * y + 10.0).margin(1e-4));
+        }
+    }
+    // far edge of the grid and outside it
+    REQUIRE(terrain->heightAtM(6.0, 29.0) == Catch::Approx(0.5 * 6.0 + 0.25 * 29.0 + 10.0).margin(1e-4));
+    REQUIRE(terrain->heightAtM(-50.0, 10.0) == Catch::Approx(-1.0));
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("TerrainMap keeps at most cache_tiles tiles mapped with LRU eviction", "[TerrainMap]") {
+    const std::string dir = makeTerrainDir("virtd_terrain_lru");
+    writePlane(dir);
+    const auto terrain = TerrainMap::open(dir, 2);
+    REQUIRE(terrain);
+
+    terrain->heightAtM(-9.0, 6.0);   // tile (0, 0)
+    terrain->heightAtM(-1.0, 6.0);   // tile (1, 0)
+    REQUIRE(terrain->residentTiles() == 2);
+    REQUIRE(terrain->tileLoads() == 2);
+
+    terrain->heightAtM(-9.0, 6.5);   // (0, 0) again: hit, becomes most recent
+    REQUIRE(terrain->tileLoads() == 2);
+
+    terrain->heightAtM(-9.0, 14.0);  // tile (0, 1) evicts (1, 0)
+    REQUIRE(terrain->residentTiles() == 2);
+    REQUIRE(terrain->tileLoads() == 3);
+    terrain->heightAtM(-9.0, 6.0);
+    REQUIRE(terrain->tileLoads() == 3);
+    terrain->heightAtM(-1.0, 6.0);
+    REQUIRE(terrain->tileLoads() == 4);
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("TerrainMap reads missing tiles as default height", "[TerrainMap]") {
+    const std::string dir = makeTerrainDir("virtd_terrain_sparse");
+    writePlane(dir);
+    std::filesystem::remove(std::filesystem::path(dir) / "tile_1_2.dem");
+    const auto terrain = TerrainMap::open(dir);
+    REQUIRE(terrain);
+    REQUIRE(terrain->heightAtM(2.0, 26.0) == Catch::Approx(-1.0));
+    REQUIRE(terrain->heightAtM(-8.0, 26.0) == Catch::Approx(0.5 * -8.0 + 0.25 * 26.0 + 10.0).margin(1e-4));
+    REQUIRE_FALSE(TerrainMap::open(dir + "_missing"));
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Landed and AGL completion use height above terrain", "[TerrainMap][CompletionEvaluator]") {
+    drone::mission::CompletionEvaluator evaluator;
+    drone::runtime::SensorFrame frame;
+    frame.altitude_m = 120.0;
+    frame.altitude_agl_m = 0.2;
+
+    drone::mission::CompletionCriteria landed;
+    landed.condition_type = drone::mission::CompletionConditionType::LANDED;
+    landed.altitude_tolerance_m = 0.5;
+    REQUIRE(evaluator.isMet(landed, frame, 0.01));
+
+    drone::mission::CompletionCriteria agl;
+    agl.condition_type = drone::mission::CompletionConditionType::AGL_REACHED;
+    agl.target_altitude_m = 15.0;
+    agl.altitude_tolerance_m = 1.0;
+    evaluator.reset();
+    REQUIRE_FALSE(evaluator.isMet(agl, frame, 0.01));
+    frame.altitude_agl_m = 14.5;
+    REQUIRE(evaluator.isMet(agl, frame, 0.01));
+}
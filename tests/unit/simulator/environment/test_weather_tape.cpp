@@ -0,0 +1,68 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+
+#include "simulator/environment/weather_model.h"
+#include "simulator/environment/weather_tape.h"
+
+using drone::simulator::environment::WeatherModel;
+using drone::simulator::environment::WeatherTape;
+
+namespace {
+drone::simulator::config::WeatherConfig makeConfig() {
+    drone::simulator::config::WeatherConfig config;
+    config.enabled = true;
+    config.steady_accel_enu_ms2 = drone::Vector3(0.5, -0.2, 0.0);
+    config.gust_amplitude_enu_ms2 = drone::Vector3(0.3, 0.2, 0.1);
+    config.gust_frequency_hz = 0.25;
+    config.turbulence_std_enu_ms2 = drone::Vector3(0.05, 0.04, 0.03);
+    config.random_seed = 7;
+    return config;
+}
+}  // namespace
+
+TEST_CASE("WeatherTape playback matches the live model tick for tick", "[WeatherTape]") {
+    const std::filesystem::path tape_dir = std::filesystem::temp_directory_path() / "virtDrone_weather_tape_test";
+    std::filesystem::remove_all(tape_dir);
+
+    const auto config = makeConfig();
+    const double dt_s = 0.01;
+    const auto tape = WeatherTape::loadOrGenerate(config, dt_s, 2.0, tape_dir.string());
+    REQUIRE(tape);
+    REQUIRE(tape->size() == 201);
+    REQUIRE(tape->key() == WeatherTape::computeKey(config, dt_s, 2.0));
+
+    WeatherModel live;
+    live.setConfig(config);
+    WeatherModel playback;
+    playback.setConfig(config);
+    playback.setTape(tape);
+
+    for (int i = 0; i <= 200; ++i) {
+        const double t = i * dt_s;
+        const auto expected = live.sample(t);
+        const auto actual = playback.sample(t);
+        REQUIRE(actual.total_accel_enu_ms2.x == expected.total_accel_enu_ms2.x);
+        REQUIRE(actual.total_accel_enu_ms2.y == expected.total_accel_enu_ms2.y);
+        REQUIRE(actual.turbulence_accel_enu_ms2.z == expected.turbulence_accel_enu_ms2.z);
+    }
+
+    // a second request for the same key reuses the mapping
+    const auto again = WeatherTape::loadOrGenerate(config, dt_s, 2.0, tape_dir.string());
+    REQUIRE(again.get() == tape.get());
+
+    std::filesystem::remove_all(tape_dir);
+}
+
+TEST_CASE("WeatherTape key changes with seed and dt", "[WeatherTape]") {
+    auto config = makeConfig();
+    const auto base_key = WeatherTape::computeKey(config, 0.01, 10.0);
+    REQUIRE(WeatherTape::computeKey(config, 0.02, 10.0) != base_key);
+    config.random_seed = 8;
+    REQUIRE(WeatherTape::computeKey(config, 0.01, 10.0) != base_key);
+}
+
+TEST_CASE("WeatherTape rejects files that are not tapes", "[WeatherTape]") {
+    REQUIRE_FALSE(WeatherTape::open("/nonexistent/virtDrone_weather.tape"));
+}
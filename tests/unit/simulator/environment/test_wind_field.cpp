@@ -0,0 +1,140 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include "simulator/environment/weather_model.h"
+#include "simulator/environment/wind_field.h"
+
+using Catch::Approx;
+using drone::simulator::environment::WindField;
+using drone::simulator::environment::WindFieldSampler;
+using drone::simulator::environment::WindGridSpec;
+
+namespace {
+// Linear in space and time, so trilinear + time interpolation reproduces it exactly
+drone::Vector3 linearWind(double x, double y, double z, double t) {
+    return drone::Vector3(1.0 + 0.1 * x + 0.5 * t, -0.2 * y, 0.05 * z + 0.01 * x);
+}
+
+WindGridSpec makeSpec() {
+    WindGridSpec spec;
+    spec.nx = 11;  // spans two 8-node tiles along x
+    spec.ny = 5;
+    spec.nz = 4;
+    spec.nt = 2;
+    spec.origin_enu_m = drone::Vector3(-50.0, -20.0, 0.0);
+    spec.spacing_m = drone::Vector3(10.0, 10.0, 5.0);
+    spec.t0_s = 0.0;
+    spec.slice_dt_s = 4.0;
+    return spec;
+}
+
+std::filesystem::path writeField(const WindGridSpec& spec, const char* name) {
+    std::vector<drone::Vector3> nodes;
+    for (std::uint32_t t = 0; t < spec.nt; ++t) {
+        for (std::uint32_t k = 0; k < spec.nz; ++k) {
+            for (std::uint32_t j = 0; j < spec.ny; ++j) {
+                for (std::uint32_t i = 0; i < spec.nx; ++i) {
+                    nodes.push_back(linearWind(spec.origin_enu_m.x + i * spec.spacing_m.x,
+                                               spec.origin_enu_m.y + j * spec.spacing_m.y,
+                                               spec.origin_enu_m.z + k * spec.spacing_m.z,
+                                               spec.t0_s + t * spec.slice_dt_s));
+                }
+            }
+        }
+    }
+    const std::filesystem::path file = std::filesystem::temp_directory_path() / name;
+    REQUIRE(WindField::write(file.string(), spec, nodes));
+    return file;
+}
+}  // namespace
+
+TEST_CASE("WindField round-trips node values through the tiled layout", "[WindField]") {
+    const WindGridSpec spec = makeSpec();
+    const auto file = writeField(spec, "virtDrone_wind_nodes.bin");
+    const auto field = WindField::open(file.string());
+    REQUIRE(field);
+
+    const drone::Vector3 node = field->node(1, 9, 3, 2);
+    const drone::Vector3 expected = linearWind(40.0, 10.0, 10.0, 4.0);
+    REQUIRE(node.x == Approx(expected.x));
+    REQUIRE(node.y == Approx(expected.y));
+    REQUIRE(node.z == Approx(expected.z));
+    std::filesystem::remove(file);
+}
+
+TEST_CASE("WindFieldSampler interpolates in space and time and caches the cell", "[WindField]") {
+    const WindGridSpec spec = makeSpec();
+    const auto file = writeField(spec, "virtDrone_wind_sample.bin");
+    WindFieldSampler sampler(WindField::open(file.string()));
+    REQUIRE(sampler.hasField());
+
+    const drone::Vector3 position(23.7, 4.2, 7.1);
+    const drone::Vector3 wind = sampler.sample(position, 1.5);
+    const drone::Vector3 expected = linearWind(position.x, position.y, position.z, 1.5);
+    REQUIRE(wind.x == Approx(expected.x).margin(1e-5));
+    REQUIRE(wind.y == Approx(expected.y).margin(1e-5));
+    REQUIRE(wind.z == Approx(expected.z).margin(1e-5));
+    REQUIRE(sampler.cacheMisses() == 1);
+
+    sampler.sample(drone::Vector3(24.5, 5.0, 7.5), 2.0);
+    REQUIRE(sampler.cacheHits() == 1);
+
+    // outside the grid: clamped to the edge node
+    const drone::Vector3 clamped = sampler.sample(drone::Vector3(500.0, -100.0, 0.0), 10.0);
+    const drone::Vector3 edge = linearWind(50.0, -20.0, 0.0, 4.0);
+    REQUIRE(clamped.x == Approx(edge.x).margin(1e-5));
+    REQUIRE(clamped.y == Approx(edge.y).margin(1e-5));
+    std::filesystem::remove(file);
+}
+
+TEST_CASE("WeatherModel reports wind velocity at the vehicle position", "[WindField]") {
+    const WindGridSpec spec = makeSpec();
+    const auto file = writeField(spec, "virtDrone_wind_weather.bin");
+
+    drone::simulator::config::WeatherConfig config;
+    config.enabled = true;
+    drone::simulator::environment::WeatherModel model;
+    model.setConfig(config);
+    model.setWindField(WindField::open(file.string()));
+
+    const auto sample = model.sample(0.0, drone::Vector3(0.0, 0.0, 0.0));
+    REQUIRE(sample.wind_velocity_enu_mps.x == Approx(1.0).margin(1e-6));
+    REQUIRE(sample.total_accel_enu_ms2.x == Approx(0.0).margin(1e-12));
+    std::filesystem::remove(file);
+}
+
+TEST_CASE("WindField rejects grids without a positive finite spacing", "[WindField]") {
+    WindGridSpec spec = makeSpec();
+    spec.spacing_m.y = 0.0;
+    std::vector<drone::Vector3> nodes(static_cast<std::size_t>(spec.nx) * spec.ny * spec.nz * spec.nt);
+    const auto file = std::filesystem::temp_directory_path() / "virtDrone_wind_bad_spacing.bin";
+    REQUIRE_FALSE(WindField::write(file.string(), spec, nodes));
+
+    // a valid file whose header spacing is overwritten afterwards
+    const auto valid = writeField(makeSpec(), "virtDrone_wind_bad_spacing.bin");
+    std::vector<char> bytes;
+    {
+        std::ifstream in(valid, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    const double spacing[3] = {10.0, 10.0, 5.0};
+    const auto found = std::search(bytes.begin(), bytes.end(), reinterpret_cast<const char*>(spacing),
+                                   reinterpret_cast<const char*>(spacing) + sizeof(spacing));
+    REQUIRE(found != bytes.end());
+    for (const double bad : {0.0, -10.0, std::numeric_limits<double>::quiet_NaN()}) {
+        std::memcpy(&*found, &bad, sizeof(bad));
+        std::ofstream out(valid, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        out.close();
+        REQUIRE_FALSE(WindField::open(valid.string()));
+    }
+    std::filesystem::remove(valid);
+}
@@ -0,0 +1,94 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#include "simulator/config/battery_config.h"
+#include "simulator/physics/cell_ocv_table.h"
+
+using Catch::Approx;
+using drone::simulator::physics::CellChemistry;
+using drone::simulator::physics::CellOcvTable;
+
+namespace {
+// Reference piecewise LiPo curve the table replaces
+double lipoSegmentVoltageV(double soc_percent) {
+    if (soc_percent <= 30.0) {
+        return 3.2 + soc_percent * (0.3 / 30.0);
+    }
+    if (soc_percent <= 85.0) {
+        return 3.5 + (soc_percent - 30.0) * (0.4 / 55.0);
+    }
+    return 3.9 + (soc_percent - 85.0) * (0.3 / 15.0);
+}
+}  // namespace
+
+TEST_CASE("CellOcvTable LiPo profile matches the piecewise curve", "[CellOcvTable]") {
+    constexpr CellOcvTable table = CellOcvTable::lipo();
+    static_assert(table.voltageV(0.0) == 3.2, "table is evaluated at compile time");
+
+    for (double soc = 0.0; soc <= 100.0; soc += 0.7) {
+        REQUIRE(table.voltageV(soc) == Approx(lipoSegmentVoltageV(soc)).margin(1e-12));
+    }
+    REQUIRE(table.voltageV(-5.0) == Approx(3.2));
+    REQUIRE(table.voltageV(120.0) == Approx(4.2));
+}
+
+TEST_CASE("CellOcvTable integral is exact for the linear pieces", "[CellOcvTable]") {
+    const CellOcvTable table = CellOcvTable::lipo();
+
+    // 0-30%: mean 3.35 V
+    REQUIRE(table.integrate(0.0, 30.0) == Approx(30.0 * 3.35));
+    REQUIRE(table.integrate(30.0, 0.0) == Approx(-30.0 * 3.35));
+
+    // Off-grid bounds inside one cell use the trapezoid of the interpolated ends
+    const double expected = 0.5 * (table.voltageV(41.3) + table.voltageV(43.9)) * (43.9 - 41.3);
+    REQUIRE(table.integrate(41.3, 43.9) == Approx(expected));
+}
+
+TEST_CASE("CellOcvTable chemistry profiles are monotonic with expected limits", "[CellOcvTable]") {
+    const CellOcvTable li_ion = CellOcvTable::forChemistry(CellChemistry::LiIon);
+    const CellOcvTable li_hv = CellOcvTable::forChemistry(CellChemistry::LiHV);
+
+    REQUIRE(li_ion.voltageV(100.0) == Approx(4.2));
+    REQUIRE(li_hv.voltageV(100.0) == Approx(4.35));
+    for (std::size_t i = 1; i < CellOcvTable::kSamples; ++i) {
+        REQUIRE(li_ion.samples()[i] > li_ion.samples()[i - 1]);
+        REQUIRE(li_hv.samples()[i] > li_hv.samples()[i - 1]);
+    }
+}
+
+TEST_CASE("BatteryConfig loads chemistry and custom OCV table", "[BatteryConfig]") {
+    const std::filesystem::path temp_file = std::filesystem::temp_directory_path() / "virtDrone_battery_test.yaml";
+
+    {
+        std::ofstream out(temp_file);
+        out << "battery:\n";
+        out << "  chemistry: lihv\n";
+    }
+    drone::simulator::config::BatteryConfig config;
+    REQUIRE(config.loadFromFile(temp_file.string()));
+    REQUIRE(config.chemistry == CellChemistry::LiHV);
+    REQUIRE(config.ocvTable().voltageV(100.0) == Approx(4.35));
+
+    {
+        std::ofstream out(temp_file);
+        out << "battery:\n";
+        out << "  ocv_table_v: [3.0, 3.1, 3.2, 3.3, 3.4, 3.5, 3.6, 3.7, 3.8, 3.9, 4.0,\n";
+        out << "                4.1, 4.2, 4.3, 4.4, 4.5, 4.6, 4.7, 4.8, 4.9, 5.0]\n";
+    }
+    drone::simulator::config::BatteryConfig custom;
+    REQUIRE(custom.loadFromFile(temp_file.string()));
+    REQUIRE(custom.ocvTable().voltageV(52.5) == Approx(4.05));
+
+    {
+        std::ofstream out(temp_file);
+        out << "battery:\n";
+        out << "  chemistry: nimh\n";
+    }
+    drone::simulator::config::BatteryConfig rejected;
+    REQUIRE_FALSE(rejected.loadFromFile(temp_file.string()));
+
+    std::filesystem::remove(temp_file);
+}
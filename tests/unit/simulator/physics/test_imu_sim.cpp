@@ -0,0 +1,127 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "simulator/physics/force_dynamics.h"
+#include "simulator/physics/imu_sim.h"
+
+using drone::runtime::ImuSample;
+using drone::simulator::physics::ImuSim;
+using drone::simulator::physics::ImuSpecs;
+using drone::simulator::physics::ImuTruth;
+
+namespace {
+
+ImuSpecs noiselessSpecs(double rate_hz) {
+    ImuSpecs specs;
+    specs.sample_rate_hz = rate_hz;
+    specs.accel_noise_std_ms2 = 0.0;
+    specs.gyro_noise_std_rps = 0.0;
+    specs.fifo_capacity = 4096;
+    return specs;
+}
+
+}  // namespace
+
+TEST_CASE("ImuSim emits samples at its own rate independent of the step", "[ImuSim]") {
+    ImuSim imu(noiselessSpecs(8000.0));
+    const ImuTruth hover{drone::Vector3(0.0, 0.0, 9.81), drone::Vector3()};
+
+    for (int step = 0; step < 10; ++step) {
+        imu.advance(0.01, hover, hover);
+    }
+    REQUIRE(imu.available() == 800);
+
+    std::vector<ImuSample> batch(1000);
+    const std::size_t count = imu.read(batch.data(), batch.size());
+    REQUIRE(count == 800);
+    REQUIRE(imu.available() == 0);
+    REQUIRE(batch[0].timestamp_s == Catch::Approx(1.0 / 8000.0));
+    REQUIRE(batch[799].timestamp_s == Catch::Approx(0.1));
+    REQUIRE(batch[10].specific_force_body_ms2.z == Catch::Approx(9.81));
+}
+
+TEST_CASE("ImuSim interpolates truth across the step and adds bias", "[ImuSim]") {
+    ImuSpecs specs = noiselessSpecs(1000.0);
+    specs.accel_bias_ms2 = drone::Vector3(0.1, 0.0, 0.0);
+    specs.gyro_bias_rps = drone::Vector3(0.0, 0.0, -0.01);
+    ImuSim imu(specs);
+
+    const ImuTruth start{drone::Vector3(0.0, 0.0, 0.0), drone::Vector3(0.0, 0.0, 0.0)};
+    const ImuTruth end{drone::Vector3(1.0, 0.0, 0.0), drone::Vector3(0.0, 0.0, 1.0)};
+    imu.advance(0.01, start, end);
+
+    std::vector<ImuSample> batch(16);
+    REQUIRE(imu.read(batch.data(), batch.size()) == 10);
+    REQUIRE(batch[4].specific_force_body_ms2.x == Catch::Approx(0.5 + 0.1));
+    REQUIRE(batch[9].specific_force_body_ms2.x == Catch::Approx(1.0 + 0.1));
+    REQUIRE(batch[4].angular_rate_body_rps.z == Catch::Approx(0.5 - 0.01));
+}
+
+TEST_CASE("ImuSim quantizes and saturates readings", "[ImuSim]") {
+    ImuSpecs specs = noiselessSpecs(1000.0);
+    specs.accel_lsb_ms2 = 0.5;
+    specs.accel_range_ms2 = 20.0;
+    specs.gyro_lsb_rps = 0.1;
+    ImuSim imu(specs);
+
+    const ImuTruth truth{drone::Vector3(1.3, 50.0, -9.81), drone::Vector3(0.26, 0.0, 0.0)};
+    imu.advance(0.001, truth, truth);
+
+    ImuSample sample;
+    REQUIRE(imu.read(&sample, 1) == 1);
+    REQUIRE(sample.specific_force_body_ms2.x == Catch::Approx(1.5));
+    REQUIRE(sample.specific_force_body_ms2.y == Catch::Approx(20.0));
+    REQUIRE(sample.specific_force_body_ms2.z == Catch::Approx(-10.0));
+    REQUIRE(sample.angular_rate_body_rps.x == Catch::Approx(0.3));
+}
+
+TEST_CASE("ImuSim FIFO drops oldest samples on overflow", "[ImuSim]") {
+    ImuSpecs specs = noiselessSpecs(1000.0);
+    specs.fifo_capacity = 8;
+    ImuSim imu(specs);
+    const ImuTruth truth{};
+
+    imu.advance(0.012, truth, truth);
+    REQUIRE(imu.available() == 8);
+    REQUIRE(imu.overflowCount() == 4);
+
+    std::vector<ImuSample> batch(8);
+    REQUIRE(imu.read(batch.data(), batch.size()) == 8);
+    REQUIRE(batch.front().timestamp_s == Catch::Approx(0.005));
+    REQUIRE(batch.back().timestamp_s == Catch::Approx(0.012));
+}
+
+TEST_CASE("ImuSim white noise matches configured density", "[ImuSim]") {
+    ImuSpecs specs;
+    specs.sample_rate_hz = 2000.0;
+    specs.fifo_capacity = 40000;
+    specs.accel_noise_std_ms2 = 0.05;
+    specs.gyro_noise_std_rps = 0.01;
+    ImuSim imu(specs);
+    const ImuTruth truth{};
+    imu.advance(10.0, truth, truth);
+
+    std::vector<ImuSample> batch(imu.available());
+    imu.read(batch.data(), batch.size());
+    double accel_sq = 0.0;
+    double gyro_sq = 0.0;
+    for (const auto& sample : batch) {
+        accel_sq += sample.specific_force_body_ms2.y * sample.specific_force_body_ms2.y;
+        gyro_sq += sample.angular_rate_body_rps.x * sample.angular_rate_body_rps.x;
+    }
+    REQUIRE(std::sqrt(accel_sq / batch.size()) == Catch::Approx(0.05).epsilon(0.05));
+    REQUIRE(std::sqrt(gyro_sq / batch.size()) == Catch::Approx(0.01).epsilon(0.05));
+}
+
+TEST_CASE("rotateEnuToBody inverts rotateBodyToEnu", "[ForceDynamics]") {
+    const drone::AttitudeYPR attitude(0.7, -0.2, 0.3);
+    const drone::Vector3 body(1.0, -2.0, 3.0);
+    const drone::Vector3 back = drone::simulator::physics::rotateEnuToBody(
+        drone::simulator::physics::rotateBodyToEnu(body, attitude), attitude);
+    REQUIRE(back.x == Catch::Approx(body.x));
+    REQUIRE(back.y == Catch::Approx(body.y));
+    REQUIRE(back.z == Catch::Approx(body.z));
+}
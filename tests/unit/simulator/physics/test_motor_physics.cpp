@@ -1,8 +1,10 @@
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
 #include "simulator/physics/motor_physics.h"
 #include "simulator/physics/battery_sim.h"
 // #include "simulator/physics/physics.h"
 #include "drone/model/components/elect_motor.h"
+#include <cmath>
 #include <memory>
 
 using namespace drone::model::components;
@@ -82,4 +84,28 @@ TEST_CASE("MotorPhysics updates state correctly with battery simulation", "[Moto
     REQUIRE(motor.getSpeedRPM() == 5000.0);
     REQUIRE(motor.getCurrentA() > 0.0);
     REQUIRE(motor.getTemperatureC() >= 25.0); // Temperature should not decrease
-}
\ No newline at end of file
+}
+
+// Thermal update is exact, so one large step equals many small ones
+TEST_CASE("MotorPhysics thermal update is step-size independent", "[MotorPhysics]") {
+    ElecMotorSpecs thermal_specs = specs;
+    thermal_specs.thermal_time_constant_s = 5.0;
+    ElecMotor motor_big_step("BigStep", io_spec, thermal_specs);
+    ElecMotor motor_small_steps("SmallSteps", io_spec, thermal_specs);
+    motor_big_step.setLossesW(20.0);
+    motor_small_steps.setLossesW(20.0);
+
+    MotorPhysics::advanceTemperature(motor_big_step, 10.0);
+    for (int i = 0; i < 1000; ++i) {
+        MotorPhysics::advanceTemperature(motor_small_steps, 0.01);
+    }
+
+    const double target_temp = 25.0 + 20.0 * thermal_specs.thermal_resistance;
+    const double expected = target_temp + (25.0 - target_temp) * std::exp(-10.0 / 5.0);
+    REQUIRE(motor_big_step.getTemperatureC() == Catch::Approx(expected).margin(1e-9));
+    REQUIRE(motor_small_steps.getTemperatureC() == Catch::Approx(expected).margin(1e-9));
+
+    // Never overshoots the steady-state temperature, however long the step
+    MotorPhysics::advanceTemperature(motor_big_step, 1.0e6);
+    REQUIRE(motor_big_step.getTemperatureC() == Catch::Approx(target_temp).margin(1e-9));
+}
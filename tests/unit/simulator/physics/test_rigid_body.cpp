@@ -0,0 +1,98 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "simulator/physics/force_dynamics.h"
+#include "simulator/physics/rigid_body.h"
+
+using drone::simulator::physics::Matrix3;
+using drone::simulator::physics::Quaternion;
+using drone::simulator::physics::RigidBody;
+using drone::simulator::physics::RigidBodyParams;
+
+TEST_CASE("Quaternion and matrix match the Euler body-to-ENU rotation", "[RigidBody]") {
+    const drone::AttitudeYPR attitude(0.9, -0.3, 0.4);
+    const drone::Vector3 body(0.5, -1.0, 2.0);
+    const drone::Vector3 expected = drone::simulator::physics::rotateBodyToEnu(body, attitude);
+
+    const drone::Vector3 from_quaternion = Matrix3::fromQuaternion(Quaternion::fromAttitude(attitude)) * body;
+    const drone::Vector3 from_matrix = Matrix3::fromAttitude(attitude) * body;
+    REQUIRE(from_quaternion.x == Catch::Approx(expected.x));
+    REQUIRE(from_quaternion.y == Catch::Approx(expected.y));
+    REQUIRE(from_quaternion.z == Catch::Approx(expected.z));
+    REQUIRE(from_matrix.x == Catch::Approx(expected.x));
+
+    const drone::AttitudeYPR back = Matrix3::fromAttitude(attitude).toAttitude();
+    REQUIRE(back.yaw_rad == Catch::Approx(0.9));
+    REQUIRE(back.pitch_rad == Catch::Approx(-0.3));
+    REQUIRE(back.roll_rad == Catch::Approx(0.4));
+}
+
+TEST_CASE("RigidBody integrates a constant body rate without drift", "[RigidBody]") {
+    RigidBody body;
+    body.setAttitude(Quaternion::fromAttitude(drone::AttitudeYPR(0.0, 0.0, 0.2)));
+    body.setAngularRateBodyRps(drone::Vector3(0.0, 0.0, 1.0));
+
+    // no torque on a symmetric body keeps the body rate constant
+    for (int i = 0; i < 1000; ++i) {
+        body.step(0.001, 1.0, drone::Vector3(), drone::Vector3());
+    }
+
+    const Quaternion& q = body.getAttitude();
+    REQUIRE(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z == Catch::Approx(1.0).margin(1e-12));
+    // rotation about body z after rolling: compare with the exact composite rotation
+    const Matrix3 expected = Matrix3::fromQuaternion(Quaternion{std::cos(0.1), std::sin(0.1), 0.0, 0.0});
+    const Matrix3 spin = Matrix3::fromQuaternion(Quaternion{std::cos(0.5), 0.0, 0.0, std::sin(0.5)});
+    const drone::Vector3 probe(1.0, 0.0, 0.0);
+    const drone::Vector3 exact = expected * (spin * probe);
+    const drone::Vector3 actual = body.getBodyToEnu() * probe;
+    REQUIRE(actual.x == Catch::Approx(exact.x).margin(1e-9));
+    REQUIRE(actual.y == Catch::Approx(exact.y).margin(1e-9));
+    REQUIRE(actual.z == Catch::Approx(exact.z).margin(1e-9));
+}
+
+TEST_CASE("RigidBody conserves angular momentum magnitude without torque", "[RigidBody]") {
+    RigidBodyParams params;
+    params.inertia_kgm2 = Matrix3::diagonal(drone::Vector3(0.01, 0.02, 0.03));
+    RigidBody body(params);
+    body.setAngularRateBodyRps(drone::Vector3(0.1, 3.0, 0.1));
+
+    auto momentum = [&]() {
+        const drone::Vector3 h = params.inertia_kgm2 * body.getAngularRateBodyRps();
+        return std::sqrt(h.x * h.x + h.y * h.y + h.z * h.z);
+    };
+    const double initial = momentum();
+    for (int i = 0; i < 2000; ++i) {
+        body.step(0.0005, 1.0, drone::Vector3(), drone::Vector3());
+    }
+    REQUIRE(momentum() == Catch::Approx(initial).epsilon(0.02));
+}
+
+TEST_CASE("RigidBody X-frame torque follows the mixer sign convention", "[RigidBody]") {
+    const RigidBody body;
+    const std::vector<double> no_torque(4, 0.0);
+
+    // FL and RL stronger: left side up, positive roll
+    const drone::Vector3 roll = body.quadXTorqueBodyNm({5.0, 4.0, 4.0, 5.0}, no_torque);
+    REQUIRE(roll.x > 0.0);
+    REQUIRE(roll.y == Catch::Approx(0.0).margin(1e-12));
+
+    // rear stronger: nose down, positive pitch
+    const drone::Vector3 pitch = body.quadXTorqueBodyNm({4.0, 4.0, 5.0, 5.0}, no_torque);
+    REQUIRE(pitch.y > 0.0);
+
+    const drone::Vector3 yaw = body.quadXTorqueBodyNm({4.0, 4.0, 4.0, 4.0}, {0.2, 0.1, 0.2, 0.1});
+    REQUIRE(yaw.z == Catch::Approx(0.2));
+    REQUIRE(yaw.x == Catch::Approx(0.0).margin(1e-12));
+}
+
+TEST_CASE("RigidBody translation follows applied ENU force", "[RigidBody]") {
+    RigidBody body;
+    for (int i = 0; i < 100; ++i) {
+        body.step(0.01, 2.0, drone::Vector3(0.0, 0.0, -19.62), drone::Vector3());
+    }
+    REQUIRE(body.getVelocityEnuMps().z == Catch::Approx(-9.81));
+    REQUIRE(body.getPositionEnuM().z == Catch::Approx(-0.5 * 9.81 * 1.01).epsilon(1e-6));
+}
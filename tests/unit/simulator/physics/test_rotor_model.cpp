@@ -0,0 +1,99 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "simulator/physics/rotor_model.h"
+#include "simulator/physics/thrust_model.h"
+
+using Catch::Approx;
+using namespace drone::model::components;
+using namespace drone::model::sensors;
+using namespace drone::simulator::physics;
+
+namespace {
+std::vector<ElecMotor> makeMotors() {
+    const AnalogIOSpec io_spec(AnalogIOSpec::IODirection::OUTPUT, AnalogIOSpec::CurrentRange::ZERO_TO_10V, 0, 10000);
+    ElecMotorSpecs small_prop(15000.0, 14.8, 20.0, 0.9, 0.4, 0.12);
+    small_prop.blade_diameter_m = 0.25;
+    ElecMotorSpecs large_prop = small_prop;
+    large_prop.blade_diameter_m = 0.3;
+    large_prop.blade_shape_coeff = 1.2;
+    std::vector<ElecMotor> motors;
+    motors.emplace_back("M1", io_spec, small_prop);
+    motors.emplace_back("M2", io_spec, large_prop);
+    return motors;
+}
+}  // namespace
+
+TEST_CASE("RotorModel folded coefficients match ThrustModel", "[RotorModel]") {
+    std::vector<ElecMotor> motors = makeMotors();
+    const ThrustModelParams params{1.5e-5, 1.5e-6, 0.0, 0.0};
+    const RotorModel model(params, motors);
+    REQUIRE(model.rotorCount() == 2);
+
+    motors[0].setSpeedRPM(6000.0);
+    motors[1].setSpeedRPM(-4500.0);
+    const double rpm[2] = {motors[0].getSpeedRPM(), motors[1].getSpeedRPM()};
+    const double inflow[2] = {0.0, 0.0};
+    double thrust[2] = {};
+    double torque[2] = {};
+    model.evaluate(rpm, inflow, thrust, torque);
+
+    for (std::size_t i = 0; i < motors.size(); ++i) {
+        REQUIRE(thrust[i] == Approx(ThrustModel::computeThrustN(&motors[i], params)));
+        REQUIRE(torque[i] == Approx(ThrustModel::computeTorqueNm(&motors[i], params)));
+    }
+}
+
+TEST_CASE("RotorCurveTable imports test-stand CSV and interpolates RPM and inflow", "[RotorModel]") {
+    const std::filesystem::path temp_file = std::filesystem::temp_directory_path() / "virtDrone_rotor_curve_test.csv";
+    {
+        // thrust = rpm/1000 - inflow, torque = thrust / 10; rows deliberately unsorted
+        std::ofstream out(temp_file);
+        out << "rpm, inflow_mps, thrust_n, torque_nm\n";
+        out << "4000, 0, 4.0, 0.40\n";
+        out << "0, 0, 0.0, 0.00\n";
+        out << "2000, 0, 2.0, 0.20\n";
+        out << "0, 2, -2.0, -0.20\n";
+        out << "2000, 2, 0.0, 0.00\n";
+        out << "4000, 2, 2.0, 0.20\n";
+    }
+
+    RotorCurveTable table;
+    const bool loaded = RotorCurveTable::loadCsv(temp_file.string(), table, 41);
+    std::filesystem::remove(temp_file);
+    REQUIRE(loaded);
+    REQUIRE(table.rpm_count == 41);
+    REQUIRE(table.inflow_count == 2);
+
+    std::vector<ElecMotor> motors = makeMotors();
+    RotorModel model(ThrustModelParams{1.5e-5, 1.5e-6, 0.0, 0.0}, motors);
+    model.setCurveTable(table);
+    REQUIRE(model.hasCurveTable());
+
+    const double rpm[2] = {3050.0, 9000.0};
+    const double inflow[2] = {0.5, -1.0};
+    double thrust[2] = {};
+    double torque[2] = {};
+    model.evaluate(rpm, inflow, thrust, torque);
+
+    REQUIRE(thrust[0] == Approx(3.05 - 0.5));
+    REQUIRE(torque[0] == Approx(0.305 - 0.05));
+    // clamped to the measured envelope: 4000 RPM, 0 m/s inflow
+    REQUIRE(thrust[1] == Approx(4.0));
+}
+
+TEST_CASE("RotorCurveTable rejects CSV without required columns", "[RotorModel]") {
+    const std::filesystem::path temp_file = std::filesystem::temp_directory_path() / "virtDrone_rotor_curve_bad.csv";
+    {
+        std::ofstream out(temp_file);
+        out << "rpm,thrust_n\n";
+        out << "1000,1.0\n";
+    }
+    RotorCurveTable table;
+    REQUIRE_FALSE(RotorCurveTable::loadCsv(temp_file.string(), table));
+    std::filesystem::remove(temp_file);
+}
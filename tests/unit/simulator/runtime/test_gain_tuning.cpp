@@ -0,0 +1,251 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+
+#include <yaml-cpp/yaml.h>
+
+#include "drone/mission/mission_image.h"
+#include "drone/mission/mission_program.h"
+#include "simulator/quadrosimulator.h"
+#include "simulator/runtime/gain_tuning.h"
+
+using namespace drone::mission;
+using namespace drone::simulator::runtime;
+using drone::config::AltitudeControllerConfig;
+using drone::config::AttitudeControllerConfig;
+
+namespace {
+
+constexpr double kNoAbort = std::numeric_limits<double>::infinity();
+
+// Climb to 10 m, hold, land
+std::shared_ptr<const MissionImage> hoverMission() {
+    Mission mission;
+    auto hover = std::make_unique<HoverAction>();
+    hover->target_altitude_m = 10.0;
+    MissionStep hover_step;
+    hover_step.step_id = 1;
+    hover_step.action = std::move(hover);
+    hover_step.advance_mode = AdvanceMode::TIME_BASED;
+    hover_step.duration_s = 15.0;
+    hover_step.timeout_s = 20.0;
+    mission.steps.push_back(std::move(hover_step));
+
+    MissionStep land_step;
+    land_step.step_id = 2;
+    land_step.action = std::make_unique<LandAction>();
+    land_step.advance_mode = AdvanceMode::COMPLETION_BASED;
+    land_step.timeout_s = 60.0;
+    mission.steps.push_back(std::move(land_step));
+    return MissionImage::fromMission(mission);
+}
+
+// config/missions/hover_and_move.yaml: climb to 10 m, leg to (20, 10) at 50 m, back down and land
+std::shared_ptr<const MissionImage> hoverAndMoveMission() {
+    Mission mission;
+    auto takeoff = std::make_unique<HoverAction>();
+    takeoff->target_altitude_m = 10.0;
+    MissionStep takeoff_step;
+    takeoff_step.step_id = 1;
+    takeoff_step.action = std::move(takeoff);
+    takeoff_step.advance_mode = AdvanceMode::COMPLETION_BASED;
+    takeoff_step.timeout_s = 20.0;
+    takeoff_step.completion_criteria.condition_type = CompletionConditionType::ALTITUDE_AND_VELOCITY;
+    takeoff_step.completion_criteria.target_altitude_m = 10.0;
+    takeoff_step.completion_criteria.altitude_tolerance_m = 3.0;
+    takeoff_step.completion_criteria.max_velocity_mps = 0.3;
+    takeoff_step.completion_criteria.hold_duration_s = 1.0;
+    mission.steps.push_back(std::move(takeoff_step));
+
+    auto leg = std::make_unique<GoToPositionAction>();
+    leg->target_position_enu_m = {20.0, 10.0, 0.0};
+    leg->target_altitude_m = 50.0;
+    leg->max_tilt_rad = 0.35;
+    leg->max_velocity_mps = 4.0;
+    MissionStep leg_step;
+    leg_step.step_id = 3;
+    leg_step.action = std::move(leg);
+    leg_step.advance_mode = AdvanceMode::COMPLETION_BASED;
+    leg_step.timeout_s = 60.0;
+    leg_step.completion_criteria.condition_type = CompletionConditionType::POSITION_REACHED;
+    leg_step.completion_criteria.target_position_enu_m = {20.0, 10.0, 0.0};
+    leg_step.completion_criteria.position_tolerance_m = 1.5;
+    leg_step.completion_criteria.target_altitude_m = 50.0;
+    leg_step.completion_criteria.altitude_tolerance_m = 0.75;
+    leg_step.completion_criteria.hold_duration_s = 1.0;
+
+    for (int step_id : {2, 4}) {
+        auto hover = std::make_unique<HoverAction>();
+        hover->target_altitude_m = 10.0;
+        MissionStep hover_step;
+        hover_step.step_id = step_id;
+        hover_step.action = std::move(hover);
+        hover_step.advance_mode = AdvanceMode::TIME_BASED;
+        hover_step.duration_s = 3.0;
+        hover_step.timeout_s = 5.0;
+        mission.steps.push_back(std::move(hover_step));
+        if (step_id == 2) {
+            mission.steps.push_back(std::move(leg_step));
+        }
+    }
+
+    auto land = std::make_unique<LandAction>();
+    land->descent_rate_mps = 1.5;
+    MissionStep land_step;
+    land_step.step_id = 5;
+    land_step.action = std::move(land);
+    land_step.advance_mode = AdvanceMode::COMPLETION_BASED;
+    land_step.timeout_s = 30.0;
+    land_step.completion_criteria.condition_type = CompletionConditionType::LANDED;
+    land_step.completion_criteria.altitude_tolerance_m = 0.15;
+    mission.steps.push_back(std::move(land_step));
+    return MissionImage::fromMission(mission);
+}
+
+// Controller of config/altitude_controller.yaml; the struct defaults are outside the tuning ranges
+AltitudeControllerConfig shippedAltitudeConfig() {
+    AltitudeControllerConfig config;
+    config.altitude_param_p = 0.75;
+    config.max_altitude_delta_mps = 2.2;
+    config.control_param_p = 125.0;
+    config.control_param_i = 0.35;
+    config.control_param_d = 67.0;
+    config.enable_d_component = true;
+    config.activation_error_band_m = 10.0;
+    config.neutral_rpm = 10200.0;
+    config.position_hold_max_tilt_rad = 0.3;
+    config.position_hold_roll_gain_rad_per_m = 0.021;
+    config.position_hold_roll_damping_rad_per_mps = 0.077;
+    return config;
+}
+
+TuningPlant surrogatePlant() {
+    TuningPlant plant;
+    plant.surrogate =
+        std::make_shared<const SurrogateModel>(drone::simulator::QuadroSimulationFactory(0, 0.01)->linearizeHover());
+    return plant;
+}
+
+TuningScenario hoverScenario() {
+    TuningScenario scenario;
+    scenario.name = "hover";
+    scenario.mission = hoverMission();
+    return scenario;
+}
+
+}  // namespace
+
+TEST_CASE("Gain normalization round-trips on linear and log axes", "[GainTuning]") {
+    const auto gains = tunableGains(kAltitudeGains | kPositionGains | kAttitudeGains);
+    REQUIRE(gains.size() > 0);
+    REQUIRE(tunableGains(kAltitudeGains).size() + tunableGains(kPositionGains).size() +
+                tunableGains(kAttitudeGains).size() ==
+            gains.size());
+
+    AltitudeControllerConfig alt_config = shippedAltitudeConfig();
+    AttitudeControllerConfig att_config;
+    const auto unit_point = normalizeGains(gains, alt_config, att_config);
+    REQUIRE(unit_point.size() == gains.size());
+    for (double value : unit_point) {
+        REQUIRE(value >= 0.0);
+        REQUIRE(value <= 1.0);
+    }
+
+    AltitudeControllerConfig applied_alt;
+    AttitudeControllerConfig applied_att;
+    applyNormalizedGains(gains, unit_point, applied_alt, applied_att);
+    for (const auto& gain : gains) {
+        REQUIRE(gain.access(applied_alt, applied_att) == Catch::Approx(gain.access(alt_config, att_config)));
+    }
+
+    // the middle of a log axis is the geometric mean of its range
+    applyNormalizedGains(gains, std::vector<double>(gains.size(), 0.5), applied_alt, applied_att);
+    for (const auto& gain : gains) {
+        const double expected = gain.log_scale ? std::sqrt(gain.min_value * gain.max_value)
+                                               : 0.5 * (gain.min_value + gain.max_value);
+        REQUIRE(gain.access(applied_alt, applied_att) == Catch::Approx(expected));
+    }
+}
+
+TEST_CASE("Surrogate flight of a hover mission completes and is scored", "[GainTuning]") {
+    const TuningPlant plant = surrogatePlant();
+    const TuningCost cost = evaluateFlight(plant, shippedAltitudeConfig(), AttitudeControllerConfig(),
+                                           hoverScenario(), TuningFlightOptions(), TuningCostWeights(), kNoAbort);
+    REQUIRE(cost.failures == 0);
+    REQUIRE_FALSE(cost.aborted);
+    REQUIRE(cost.flown_s > 15.0);
+    REQUIRE(cost.ise_m2s > 0.0);
+    REQUIRE(cost.energy_hover_s > 0.0);
+    REQUIRE(std::isfinite(cost.total));
+
+    const TuningCostWeights weights;
+    REQUIRE(cost.total == Catch::Approx(weights.ise * cost.ise_m2s + weights.overshoot * cost.overshoot_m +
+                                        weights.settling * cost.settling_s + weights.energy * cost.energy_hover_s));
+}
+
+TEST_CASE("Shipped gains fly the hover_and_move example within its step timeouts", "[GainTuning]") {
+    TuningScenario scenario;
+    scenario.name = "hover_and_move";
+    scenario.mission = hoverAndMoveMission();
+    for (std::uint32_t seed : {1u, 2u}) {
+        scenario.weather_seed = seed;
+        const TuningCost cost = evaluateFlight(TuningPlant(), shippedAltitudeConfig(), AttitudeControllerConfig(),
+                                               scenario, TuningFlightOptions(), TuningCostWeights(), kNoAbort);
+        REQUIRE(cost.failures == 0);
+        REQUIRE_FALSE(cost.aborted);
+    }
+}
+
+TEST_CASE("Flights stop once the running cost passes the abort bound", "[GainTuning]") {
+    const TuningPlant plant = surrogatePlant();
+    const TuningScenario scenario = hoverScenario();
+    const TuningCost full = evaluateFlight(plant, shippedAltitudeConfig(), AttitudeControllerConfig(), scenario,
+                                           TuningFlightOptions(), TuningCostWeights(), kNoAbort);
+    const double bound = 0.1 * full.total;
+    const TuningCost cut = evaluateFlight(plant, shippedAltitudeConfig(), AttitudeControllerConfig(), scenario,
+                                          TuningFlightOptions(), TuningCostWeights(), bound);
+    REQUIRE(cut.aborted);
+    REQUIRE(cut.total > bound);
+    REQUIRE(cut.flown_s < full.flown_s);
+
+    // the running total of earlier scenarios counts against the bound
+    const TuningCost summed = evaluateScenarios(plant, shippedAltitudeConfig(), AttitudeControllerConfig(),
+                                                {scenario, scenario}, TuningFlightOptions(), TuningCostWeights(),
+                                                1.5 * full.total);
+    REQUIRE(summed.aborted);
+    REQUIRE(summed.total > 1.5 * full.total);
+}
+
+TEST_CASE("Tuned gains are written over a copy of the source config", "[GainTuning]") {
+    const auto dir = std::filesystem::temp_directory_path();
+    const auto source = (dir / "gain_tuning_source.yaml").string();
+    const auto tuned = (dir / "gain_tuning_tuned.yaml").string();
+    {
+        YAML::Emitter out;
+        out << YAML::BeginMap << YAML::Key << "altitude_controller" << YAML::Value << YAML::BeginMap;
+        out << YAML::Key << "target_altitude_m" << YAML::Value << 7.5;
+        out << YAML::Key << "control_param_p" << YAML::Value << 40.0;
+        out << YAML::EndMap << YAML::EndMap;
+        std::ofstream(source) << out.c_str() << "\n";
+    }
+
+    const auto gains = tunableGains(kAltitudeGains);
+    AltitudeControllerConfig alt_config;
+    AttitudeControllerConfig att_config;
+    alt_config.control_param_p = 123.456;
+    REQUIRE(writeTunedGains(gains, alt_config, att_config, "altitude_controller", source, tuned, "tuned for a test"));
+
+    AltitudeControllerConfig reloaded;
+    REQUIRE(reloaded.loadFromFile(tuned));
+    REQUIRE(reloaded.target_altitude_m == Catch::Approx(7.5));
+    REQUIRE(reloaded.control_param_p == Catch::Approx(123.456));
+    REQUIRE(reloaded.control_param_d == Catch::Approx(alt_config.control_param_d));
+
+    std::filesystem::remove(source);
+    std::filesystem::remove(tuned);
+}
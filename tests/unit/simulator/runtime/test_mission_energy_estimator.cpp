@@ -0,0 +1,189 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "drone/mission/mission_image.h"
+#include "drone/mission/mission_program.h"
+#include "simulator/runtime/mission_energy_estimator.h"
+
+using namespace drone::mission;
+using drone::simulator::runtime::MissionEnergyEstimator;
+using drone::simulator::runtime::MissionEnergyOutcome;
+using drone::simulator::runtime::MissionEnergyVehicle;
+
+namespace {
+
+MissionEnergyVehicle testVehicle() {
+    MissionEnergyVehicle vehicle;
+    vehicle.mass_kg = 2.0;
+    vehicle.thrust_per_rpm2_n = 5e-8;
+    return vehicle;
+}
+
+MissionStep hoverStep(int step_id, double altitude_m, double duration_s) {
+    auto hover = std::make_unique<HoverAction>();
+    hover->target_altitude_m = altitude_m;
+    MissionStep step;
+    step.step_id = step_id;
+    step.action = std::move(hover);
+    step.advance_mode = AdvanceMode::TIME_BASED;
+    step.duration_s = duration_s;
+    step.timeout_s = duration_s + 1.0;
+    return step;
+}
+
+MissionStep landStep(int step_id) {
+    MissionStep step;
+    step.step_id = step_id;
+    step.action = std::make_unique<LandAction>();
+    step.advance_mode = AdvanceMode::COMPLETION_BASED;
+    step.timeout_s = 120.0;
+    return step;
+}
+
+// Pack current of the test vehicle at hover, from the rotor and motor laws by hand
+double handHoverCurrentA() {
+    const double rpm = std::sqrt(2.0 * 9.81 / 4.0 / 5e-8);
+    return 4.0 * rpm / 15000.0 * 20.0 / 0.9;
+}
+
+}  // namespace
+
+TEST_CASE("MissionEnergyEstimator maps thrust to pack current and cruise speed", "[MissionEnergyEstimator]") {
+    const MissionEnergyEstimator estimator(testVehicle());
+    REQUIRE(estimator.hoverCurrentA() == Catch::Approx(handHoverCurrentA()));
+    REQUIRE(estimator.packCurrentA(0.0) == 0.0);
+    REQUIRE(estimator.packCurrentA(1000.0) == Catch::Approx(80.0));  // every motor at its current limit
+    REQUIRE(estimator.cruiseSpeedMps(0.3) == Catch::Approx(2.0 * 9.81 * std::tan(0.3) / 1.2));
+}
+
+TEST_CASE("MissionEnergyEstimator discharges a timed hover at hover current", "[MissionEnergyEstimator]") {
+    Mission mission;
+    mission.initial_conditions.altitude_m = 10.0;
+    mission.steps.push_back(hoverStep(1, 10.0, 60.0));
+
+    const MissionEnergyEstimator estimator(testVehicle());
+    const auto estimate = estimator.estimate(*MissionImage::fromMission(mission));
+    REQUIRE(estimate.outcome == MissionEnergyOutcome::COMPLETED);
+    REQUIRE(estimate.feasible());
+    REQUIRE(estimate.steps.size() == 1);
+    REQUIRE(estimate.duration_s == Catch::Approx(60.0));
+    REQUIRE(estimate.average_current_a == Catch::Approx(handHoverCurrentA()));
+
+    const double soc_drop_percent = handHoverCurrentA() * 60.0 / 3.6 / 1500.0 * 100.0;
+    REQUIRE(estimate.final_soc_percent == Catch::Approx(100.0 - soc_drop_percent));
+    // a 4S pack between 3.5 and 4.2 V per cell
+    const double charge_ah = handHoverCurrentA() * 60.0 / 3600.0;
+    REQUIRE(estimate.energy_wh > 4.0 * 3.5 * charge_ah);
+    REQUIRE(estimate.energy_wh < 4.0 * 4.2 * charge_ah);
+}
+
+TEST_CASE("MissionEnergyEstimator follows the program and triggers on the predicted SOC", "[MissionEnergyEstimator]") {
+    Mission mission;
+    mission.initial_conditions.altitude_m = 10.0;
+    mission.steps.push_back(hoverStep(1, 10.0, 10.0));
+    mission.steps.push_back(landStep(2));
+    REQUIRE(compileMissionProgram(
+        "loop:\n"
+        "if battery_soc_percent < 70 goto home\n"
+        "run 1\n"
+        "goto loop\n"
+        "home:\n"
+        "run 2\n",
+        {1, 2}, mission.program));
+
+    const MissionEnergyEstimator estimator(testVehicle());
+    const auto laps = estimator.estimate(*MissionImage::fromMission(mission));
+    REQUIRE(laps.outcome == MissionEnergyOutcome::COMPLETED);
+    REQUIRE(laps.steps.size() >= 3);
+    REQUIRE(laps.steps.back().step_id == 2);
+    const auto& last_lap = laps.steps[laps.steps.size() - 2];
+    REQUIRE(last_lap.step_id == 1);
+    REQUIRE(last_lap.end_soc_percent < 70.0);
+    REQUIRE(laps.steps[laps.steps.size() - 3].end_soc_percent >= 70.0);
+    REQUIRE(laps.steps.back().duration_s ==
+            Catch::Approx(10.0 / drone::simulator::runtime::MissionEnergyTiming().descent_rate_mps));
+    REQUIRE(laps.final_soc_percent < last_lap.end_soc_percent);
+
+    // a battery trigger leaves the program for the land step
+    mission.program.clear();
+    REQUIRE(compileMissionProgram("loop:\nrun 1\ngoto loop\n", {1, 2}, mission.program));
+    MissionTrigger low_battery;
+    low_battery.threshold = 80.0;
+    low_battery.action = MissionTriggerAction::GOTO_STEP;
+    low_battery.step_id = 2;
+    mission.triggers.push_back(low_battery);
+    const auto triggered = estimator.estimate(*MissionImage::fromMission(mission));
+    REQUIRE(triggered.outcome == MissionEnergyOutcome::COMPLETED);
+    REQUIRE(triggered.steps.back().step_id == 2);
+    REQUIRE(triggered.steps[triggered.steps.size() - 2].end_soc_percent < 80.0);
+
+    mission.triggers.back().action = MissionTriggerAction::ABORT;
+    REQUIRE(estimator.estimate(*MissionImage::fromMission(mission)).outcome == MissionEnergyOutcome::ABORTED);
+}
+
+TEST_CASE("MissionEnergyEstimator rejects missions that reach the reserve", "[MissionEnergyEstimator]") {
+    Mission mission;
+    mission.initial_conditions.altitude_m = 10.0;
+    mission.steps.push_back(hoverStep(1, 10.0, 600.0));
+    mission.steps.push_back(landStep(2));
+
+    const MissionEnergyEstimator estimator(testVehicle());
+    const auto empty = estimator.estimate(*MissionImage::fromMission(mission));
+    REQUIRE(empty.outcome == MissionEnergyOutcome::BATTERY_EMPTY);
+    REQUIRE_FALSE(empty.feasible());
+    REQUIRE_FALSE(empty.reserve_while_landing);
+    REQUIRE(empty.reserve_step_index == 0);
+    REQUIRE(empty.steps.size() == 1);  // nothing is flown after the pack is empty
+    REQUIRE(empty.final_soc_percent == 0.0);
+    REQUIRE(empty.reserve_time_s == Catch::Approx(100.0 / (handHoverCurrentA() / 3.6 / 1500.0 * 100.0)));
+
+    drone::simulator::runtime::MissionEnergyTiming timing;
+    timing.reserve_soc_percent = 30.0;
+    timing.descent_rate_mps = 1.2;  // a slow landing that crosses the reserve
+    mission.steps[0].duration_s = 60.0;
+    mission.steps[0].timeout_s = 61.0;
+    const auto short_hover = MissionEnergyEstimator(testVehicle()).estimate(*MissionImage::fromMission(mission));
+    REQUIRE(short_hover.feasible());
+    const auto reserved = MissionEnergyEstimator(testVehicle(), timing).estimate(*MissionImage::fromMission(mission));
+    REQUIRE(reserved.outcome == MissionEnergyOutcome::BATTERY_EMPTY);
+    REQUIRE(reserved.steps.size() == 2);
+    REQUIRE(reserved.reserve_while_landing);
+    REQUIRE(reserved.final_soc_percent > 0.0);
+
+    // a step that cannot complete before its timeout aborts the mission
+    mission.steps[1].timeout_s = 1.0;
+    const auto timed_out = estimator.estimate(*MissionImage::fromMission(mission));
+    REQUIRE(timed_out.outcome == MissionEnergyOutcome::ABORTED);
+    REQUIRE(timed_out.steps.back().timed_out);
+    REQUIRE(timed_out.steps.back().duration_s == Catch::Approx(1.0));
+}
+
+TEST_CASE("MissionEnergyEstimator checks the vehicle and idles at the reserve", "[MissionEnergyEstimator]") {
+    Mission mission;
+    mission.steps.push_back(landStep(1));
+
+    MissionEnergyVehicle no_pack = testVehicle();
+    no_pack.parallel_cells = 0;
+    const MissionEnergyEstimator invalid(no_pack);
+    REQUIRE_FALSE(invalid.valid());
+    REQUIRE(invalid.vehicleProblem() != nullptr);
+    const auto skipped = invalid.estimate(*MissionImage::fromMission(mission));
+    REQUIRE(skipped.outcome == MissionEnergyOutcome::INVALID_VEHICLE);
+    REQUIRE_FALSE(skipped.feasible());
+    REQUIRE(skipped.steps.empty());
+    REQUIRE(MissionEnergyEstimator(testVehicle()).valid());
+
+    // a vehicle waiting on the ground draws no current; starting under the reserve hits it at once
+    mission.steps.insert(mission.steps.begin(), hoverStep(1, 0.0, 5.0));
+    mission.steps.back().step_id = 2;
+    mission.initial_conditions.battery_soc_percent = 20.0;
+    drone::simulator::runtime::MissionEnergyTiming timing;
+    timing.reserve_soc_percent = 30.0;
+    const auto idle = MissionEnergyEstimator(testVehicle(), timing).estimate(*MissionImage::fromMission(mission));
+    REQUIRE(idle.reserve_time_s == 0.0);
+    REQUIRE(std::isfinite(idle.final_soc_percent));
+}
@@ -0,0 +1,114 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "drone/runtime/real_drone.h"
+#include "simulator/config/sensor_noise_config.h"
+#include "simulator/random/noise_block.h"
+#include "simulator/runtime/noisy_sensor_source.h"
+
+namespace {
+
+class ConstantSensorSource final : public drone::runtime::SensorSource {
+public:
+    explicit ConstantSensorSource(const drone::runtime::SensorFrame& frame)
+        : frame_(frame) {}
+
+    drone::runtime::SensorFrame readSensors() const override {
+        return frame_;
+    }
+
+private:
+    drone::runtime::SensorFrame frame_;
+};
+
+double stdOf(const std::vector<double>& values) {
+    double mean = 0.0;
+    for (const double v : values) {
+        mean += v;
+    }
+    mean /= static_cast<double>(values.size());
+    double variance = 0.0;
+    for (const double v : values) {
+        variance += (v - mean) * (v - mean);
+    }
+    return std::sqrt(variance / static_cast<double>(values.size()));
+}
+
+}  // namespace
+
+TEST_CASE("NoiseBlock scales each channel by its sigma across block refills", "[NoiseBlock]") {
+    drone::simulator::random::NoiseBlock noise({0.0, 1.0, 5.0}, 9, 100);
+    REQUIRE(noise.channelCount() == 3);
+
+    std::vector<double> second;
+    std::vector<double> third;
+    for (int tick = 0; tick < 20000; ++tick) {
+        const double* row = noise.next();
+        REQUIRE(row[0] == 0.0);
+        second.push_back(row[1]);
+        third.push_back(row[2]);
+    }
+
+    REQUIRE(stdOf(second) == Catch::Approx(1.0).epsilon(0.05));
+    REQUIRE(stdOf(third) == Catch::Approx(5.0).epsilon(0.05));
+}
+
+TEST_CASE("NoisySensorSource uses per-channel sigma and seed from config", "[NoisySensorSource]") {
+    drone::runtime::SensorFrame base_frame;
+    base_frame.altitude_m = 50.0;
+    base_frame.battery_voltage_v = 15.0;
+    base_frame.motor_temperature_c = 40.0;
+    ConstantSensorSource perfect_source(base_frame);
+
+    drone::simulator::config::SensorNoiseConfig config;
+    config.altitude_std_m = 0.0;
+    config.battery_voltage_std_v = 0.5;
+    config.motor_temperature_std_c = 2.0;
+    config.random_seed = 1234;
+    config.block_size = 16;
+
+    drone::simulator::runtime::NoisySensorSource first(perfect_source, config);
+    drone::simulator::runtime::NoisySensorSource replay(perfect_source, config);
+
+    std::vector<double> voltage;
+    std::vector<double> temperature;
+    for (int i = 0; i < 10000; ++i) {
+        const auto sample = first.readSensors();
+        const auto again = replay.readSensors();
+        REQUIRE(sample.altitude_m == base_frame.altitude_m);
+        REQUIRE(sample.battery_voltage_v == again.battery_voltage_v);
+        voltage.push_back(sample.battery_voltage_v);
+        temperature.push_back(sample.motor_temperature_c);
+    }
+
+    REQUIRE(stdOf(voltage) == Catch::Approx(0.5).epsilon(0.05));
+    REQUIRE(stdOf(temperature) == Catch::Approx(2.0).epsilon(0.05));
+}
+
+TEST_CASE("SensorNoiseConfig loads per-channel sigma from YAML", "[SensorNoiseConfig]") {
+    const auto path = std::filesystem::temp_directory_path() / "virtd_sensor_noise_test.yaml";
+    {
+        std::ofstream out(path);
+        out << "sensor_noise:\n"
+               "  gps_north_std_m: 0.7\n"
+               "  gps_velocity_down_std_mps: 0.05\n"
+               "  random_seed: 77\n"
+               "  block_size: 64\n";
+    }
+
+    drone::simulator::config::SensorNoiseConfig config;
+    REQUIRE(config.loadFromFile(path.string()));
+    REQUIRE(config.gps_north_std_m == Catch::Approx(0.7));
+    REQUIRE(config.gps_east_std_m == Catch::Approx(1.5));
+    REQUIRE(config.gps_velocity_down_std_mps == Catch::Approx(0.05));
+    REQUIRE(config.random_seed == 77);
+    REQUIRE(config.block_size == 64);
+
+    std::filesystem::remove(path);
+    REQUIRE_FALSE(config.loadFromFile(path.string()));
+}
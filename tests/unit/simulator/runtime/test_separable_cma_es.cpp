@@ -0,0 +1,116 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "simulator/runtime/separable_cma_es.h"
+
+using drone::simulator::runtime::minimizeSeparableCmaEs;
+using drone::simulator::runtime::SeparableCmaEsGeneration;
+using drone::simulator::runtime::SeparableCmaEsOptions;
+
+namespace {
+
+// Badly scaled quadratic with its minimum inside the box
+double shiftedQuadratic(const std::vector<double>& point) {
+    double cost = 0.0;
+    for (std::size_t i = 0; i < point.size(); ++i) {
+        const double offset = point[i] - (0.2 + 0.1 * static_cast<double>(i));
+        cost += (1.0 + 10.0 * static_cast<double>(i)) * offset * offset;
+    }
+    return cost;
+}
+
+}  // namespace
+
+TEST_CASE("Separable CMA-ES converges on a scaled quadratic", "[SeparableCmaEs]") {
+    SeparableCmaEsOptions options;
+    options.generations = 150;
+    options.threads = 1;
+    std::size_t generations_seen = 0;
+    const auto result = minimizeSeparableCmaEs(
+        std::vector<double>(4, 0.8),
+        [](const std::vector<double>& point, double, bool*) { return shiftedQuadratic(point); },
+        options,
+        [&](const SeparableCmaEsGeneration& generation) {
+            ++generations_seen;
+            REQUIRE(generation.best_cost <= generation.generation_best_cost);
+        });
+
+    REQUIRE(result.start_cost == Catch::Approx(shiftedQuadratic(std::vector<double>(4, 0.8))));
+    REQUIRE(result.best_cost < 1e-6);
+    REQUIRE(result.generations == generations_seen);
+    for (std::size_t i = 0; i < 4; ++i) {
+        REQUIRE(result.best_point[i] == Catch::Approx(0.2 + 0.1 * static_cast<double>(i)).margin(1e-3));
+    }
+}
+
+TEST_CASE("Separable CMA-ES stays in the unit box", "[SeparableCmaEs]") {
+    SeparableCmaEsOptions options;
+    options.generations = 60;
+    options.threads = 1;
+    const auto result = minimizeSeparableCmaEs(
+        std::vector<double>(3, 0.5),
+        [](const std::vector<double>& point, double, bool*) {
+            for (double value : point) {
+                REQUIRE(value >= 0.0);
+                REQUIRE(value <= 1.0);
+            }
+            return -point[0] + point[1] + point[2];  // optimum on the corner (1, 0, 0)
+        },
+        options);
+    REQUIRE(result.best_point[0] == Catch::Approx(1.0).margin(1e-3));
+    REQUIRE(result.best_point[1] == Catch::Approx(0.0).margin(1e-3));
+    REQUIRE(result.best_point[2] == Catch::Approx(0.0).margin(1e-3));
+}
+
+TEST_CASE("Separable CMA-ES result does not depend on the thread count", "[SeparableCmaEs]") {
+    const auto cost = [](const std::vector<double>& point, double abort_above, bool* aborted) {
+        const double value = shiftedQuadratic(point);
+        *aborted = value > abort_above;
+        return value;
+    };
+    SeparableCmaEsOptions options;
+    options.generations = 20;
+    options.threads = 1;
+    const auto serial = minimizeSeparableCmaEs(std::vector<double>(5, 0.6), cost, options);
+    options.threads = 4;
+    const auto parallel = minimizeSeparableCmaEs(std::vector<double>(5, 0.6), cost, options);
+
+    REQUIRE(serial.best_cost == parallel.best_cost);
+    REQUIRE(serial.best_point == parallel.best_point);
+    REQUIRE(serial.evaluations == parallel.evaluations);
+    REQUIRE(serial.aborted_evaluations == parallel.aborted_evaluations);
+}
+
+TEST_CASE("Separable CMA-ES passes the abort bound and counts cut-off candidates", "[SeparableCmaEs]") {
+    std::atomic<std::size_t> bounded_calls{0};
+    const auto cost = [&](const std::vector<double>& point, double abort_above, bool* aborted) {
+        const double value = shiftedQuadratic(point);
+        if (abort_above < 1e300) {
+            ++bounded_calls;
+        }
+        if (value > abort_above) {
+            *aborted = true;
+            return abort_above * 1.01;  // partial cost, above the bound
+        }
+        return value;
+    };
+    SeparableCmaEsOptions options;
+    options.generations = 10;
+    options.threads = 2;
+    options.initial_step = 0.5;
+    options.abort_ratio = 1.5;
+    const auto cut = minimizeSeparableCmaEs(std::vector<double>(3, 0.9), cost, options);
+    REQUIRE(bounded_calls.load() > 0);
+    REQUIRE(cut.aborted_evaluations > 0);
+    REQUIRE(cut.best_cost < cut.start_cost);
+
+    bounded_calls = 0;
+    options.abort_ratio = 0.0;
+    const auto uncut = minimizeSeparableCmaEs(std::vector<double>(3, 0.9), cost, options);
+    REQUIRE(bounded_calls.load() == 0);
+    REQUIRE(uncut.aborted_evaluations == 0);
+}
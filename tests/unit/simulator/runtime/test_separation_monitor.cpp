@@ -0,0 +1,90 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "simulator/runtime/separation_monitor.h"
+
+using drone::simulator::runtime::SeparationConfig;
+using drone::simulator::runtime::SeparationEventType;
+using drone::simulator::runtime::SeparationMonitor;
+
+TEST_CASE("SeparationMonitor reports near misses and collisions once per encounter", "[SeparationMonitor]") {
+    std::vector<drone::Vector3> positions{drone::Vector3(0.0, 0.0, 10.0), drone::Vector3(20.0, 0.0, 10.0)};
+    SeparationConfig config;
+    config.collision_distance_m = 1.0;
+    config.near_miss_distance_m = 5.0;
+    SeparationMonitor monitor(config);
+    monitor.addVehicle(&positions[0]);
+    monitor.addVehicle(&positions[1]);
+
+    REQUIRE(monitor.update().empty());
+
+    positions[1].x = 4.0;
+    const auto near = monitor.update();
+    REQUIRE(near.size() == 1);
+    REQUIRE(near[0].type == SeparationEventType::NEAR_MISS);
+    REQUIRE(near[0].vehicle_a == 0);
+    REQUIRE(near[0].vehicle_b == 1);
+    REQUIRE(near[0].distance_m == Catch::Approx(4.0));
+
+    positions[1].x = 3.0;
+    REQUIRE(monitor.update().empty());  // still the same encounter
+
+    positions[1].x = 0.5;
+    const auto collision = monitor.update();
+    REQUIRE(collision.size() == 1);
+    REQUIRE(collision[0].type == SeparationEventType::COLLISION);
+
+    positions[1].x = 3.0;
+    REQUIRE(monitor.update().empty());  // no downgrade event inside the near-miss band
+
+    positions[1].x = 30.0;
+    REQUIRE(monitor.update().empty());
+    positions[1].x = 4.5;
+    REQUIRE(monitor.update().size() == 1);  // a new encounter after separating
+}
+
+TEST_CASE("SeparationMonitor finds exactly the brute-force pairs in a dense swarm", "[SeparationMonitor]") {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> xy(-150.0, 150.0);
+    std::uniform_real_distribution<double> z(-5.0, 60.0);  // negative cells exercise floor()
+    std::vector<drone::Vector3> positions(2000);
+    for (auto& position : positions) {
+        position = drone::Vector3(xy(rng), xy(rng), z(rng));
+    }
+
+    SeparationConfig config;
+    config.collision_distance_m = 0.5;
+    config.near_miss_distance_m = 3.0;
+    SeparationMonitor monitor(config);
+    for (const auto& position : positions) {
+        monitor.addVehicle(&position);
+    }
+
+    std::set<std::pair<std::uint32_t, std::uint32_t>> expected;
+    for (std::uint32_t i = 0; i < positions.size(); ++i) {
+        for (std::uint32_t j = i + 1; j < positions.size(); ++j) {
+            const double dx = positions[i].x - positions[j].x;
+            const double dy = positions[i].y - positions[j].y;
+            const double dz = positions[i].z - positions[j].z;
+            if (dx * dx + dy * dy + dz * dz <= 9.0) {
+                expected.insert({i, j});
+            }
+        }
+    }
+
+    std::set<std::pair<std::uint32_t, std::uint32_t>> reported;
+    for (const auto& event : monitor.update()) {
+        REQUIRE(event.vehicle_a < event.vehicle_b);
+        REQUIRE(reported.insert({event.vehicle_a, event.vehicle_b}).second);
+    }
+    REQUIRE_FALSE(expected.empty());
+    REQUIRE(reported == expected);
+
+    const std::uint64_t brute_force_pairs = positions.size() * (positions.size() - 1) / 2;
+    REQUIRE(monitor.lastPairsTested() < brute_force_pairs / 50);
+}
@@ -0,0 +1,161 @@
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <filesystem>
+
+#include "simulator/config/surrogate_model_config.h"
+#include "simulator/quadrosimulator.h"
+#include "simulator/runtime/surrogate_vehicle.h"
+
+using drone::simulator::runtime::kSurrogateInputCount;
+using drone::simulator::runtime::kSurrogateStateCount;
+using drone::simulator::runtime::SurrogateModel;
+using drone::simulator::runtime::SurrogateVehicle;
+
+namespace {
+
+constexpr double kDtS = 0.01;
+constexpr std::size_t kPitchInput = drone::runtime::kMotorCount;
+constexpr std::size_t kRollInput = drone::runtime::kMotorCount + 1;
+
+double a(const SurrogateModel& model, std::size_t row, std::size_t column) {
+    return model.a[row * kSurrogateStateCount + column];
+}
+
+double b(const SurrogateModel& model, std::size_t row, std::size_t column) {
+    return model.b[row * kSurrogateInputCount + column];
+}
+
+const SurrogateModel& hoverModel() {
+    static const SurrogateModel model = drone::simulator::QuadroSimulationFactory(0, kDtS)->linearizeHover();
+    return model;
+}
+
+drone::runtime::ActuatorFrame hoverFrame(const SurrogateModel& model) {
+    drone::runtime::ActuatorFrame frame;
+    frame.desired_motor_rpm = model.hover_rpm;
+    return frame;
+}
+
+}  // namespace
+
+TEST_CASE("Hover linearization has the point-mass structure", "[surrogate]") {
+    const SurrogateModel& model = hoverModel();
+    REQUIRE(model.hover_rpm > 0.0);
+    REQUIRE(model.hover_rpm < model.motor_max_speed_rpm);
+    REQUIRE(model.hover_thrust_accel_mps2 == Catch::Approx(9.81).margin(1e-3));
+
+    // isotropic drag on all three axes
+    REQUIRE(a(model, 0, 0) < 0.0);
+    REQUIRE(a(model, 1, 1) == Catch::Approx(a(model, 0, 0)).epsilon(1e-3));
+    REQUIRE(a(model, 2, 2) <= a(model, 0, 0) + 1e-6);
+
+    // every rotor lifts equally and does not push sideways at level attitude
+    for (std::size_t rotor = 0; rotor < drone::runtime::kMotorCount; ++rotor) {
+        REQUIRE(a(model, 2, 3 + rotor) > 0.0);
+        REQUIRE(a(model, 2, 3 + rotor) == Catch::Approx(a(model, 2, 3)).epsilon(1e-6));
+        REQUIRE(std::abs(a(model, 0, 3 + rotor)) < 1e-9);
+        REQUIRE(std::abs(a(model, 1, 3 + rotor)) < 1e-9);
+
+        // first-order motor lag
+        REQUIRE(a(model, 3 + rotor, 3 + rotor) == Catch::Approx(-1.0 / model.motor_time_constant_s));
+        REQUIRE(b(model, 3 + rotor, rotor) == Catch::Approx(1.0 / model.motor_time_constant_s));
+    }
+
+    // tilt turns hover thrust sideways: pitch along x, roll along y, nothing vertical to first order
+    REQUIRE(std::abs(b(model, 0, kPitchInput)) == Catch::Approx(model.hover_thrust_accel_mps2).epsilon(1e-3));
+    REQUIRE(std::abs(b(model, 1, kRollInput)) == Catch::Approx(model.hover_thrust_accel_mps2).epsilon(1e-3));
+    REQUIRE(std::abs(b(model, 0, kRollInput)) < 1e-6);
+    REQUIRE(std::abs(b(model, 1, kPitchInput)) < 1e-6);
+    REQUIRE(std::abs(b(model, 2, kPitchInput)) < 1e-3);
+}
+
+TEST_CASE("Surrogate holds hover at the trim", "[surrogate]") {
+    SurrogateVehicle vehicle(hoverModel(), kDtS);
+    vehicle.reset(drone::Vector3(3.0, -2.0, 10.0));
+    for (int i = 0; i < 1000; ++i) {
+        vehicle.applyActuators(hoverFrame(hoverModel()));
+        vehicle.step();
+    }
+    REQUIRE(vehicle.getPositionEnu().x == Catch::Approx(3.0).margin(1e-9));
+    REQUIRE(vehicle.getPositionEnu().y == Catch::Approx(-2.0).margin(1e-9));
+    REQUIRE(vehicle.getPositionEnu().z == Catch::Approx(10.0).margin(1e-6));
+    REQUIRE(vehicle.getRotorRpm(0) == Catch::Approx(hoverModel().hover_rpm));
+}
+
+TEST_CASE("Surrogate stays on the ground with rotors stopped", "[surrogate]") {
+    SurrogateVehicle vehicle(hoverModel(), kDtS);
+    vehicle.reset(drone::Vector3(1.0, 1.0, 0.0));
+    REQUIRE(vehicle.getRotorRpm(0) == 0.0);
+    for (int i = 0; i < 100; ++i) {
+        vehicle.applyActuators(drone::runtime::ActuatorFrame{});
+        vehicle.step();
+    }
+    REQUIRE(vehicle.getPositionEnu().z == 0.0);
+    REQUIRE(vehicle.getPositionEnu().x == 1.0);
+    REQUIRE(vehicle.readSensors().gps_velocity_down_mps == 0.0);
+}
+
+TEST_CASE("Surrogate rotor speed follows the reference with the fitted lag", "[surrogate]") {
+    const SurrogateModel& model = hoverModel();
+    SurrogateVehicle vehicle(model, kDtS);
+    vehicle.reset(drone::Vector3(0.0, 0.0, 50.0));
+    drone::runtime::ActuatorFrame frame = hoverFrame(model);
+    frame.desired_motor_rpm = model.hover_rpm + 500.0;
+    const int steps = static_cast<int>(std::ceil(5.0 * model.motor_time_constant_s / kDtS));
+    for (int i = 0; i < steps; ++i) {
+        vehicle.applyActuators(frame);
+        vehicle.step();
+    }
+    REQUIRE(vehicle.getRotorRpm(2) == Catch::Approx(model.hover_rpm + 500.0).margin(5.0));
+    REQUIRE(vehicle.getVelocityEnu().z > 0.0);
+}
+
+TEST_CASE("Surrogate response turns with yaw", "[surrogate]") {
+    const SurrogateModel& model = hoverModel();
+    SurrogateVehicle level(model, kDtS);
+    SurrogateVehicle turned(model, kDtS);
+    level.reset(drone::Vector3(0.0, 0.0, 20.0));
+    turned.reset(drone::Vector3(0.0, 0.0, 20.0));
+    drone::runtime::ActuatorFrame frame = hoverFrame(model);
+    frame.desired_pitch_rad = 0.1;
+    drone::runtime::ActuatorFrame turned_frame = frame;
+    turned_frame.desired_yaw_rad = M_PI / 2.0;
+    for (int i = 0; i < 200; ++i) {
+        level.applyActuators(frame);
+        level.step();
+        turned.applyActuators(turned_frame);
+        turned.step();
+    }
+    // a quarter turn maps (x, y) to (-y, x)
+    REQUIRE(std::abs(level.getVelocityEnu().x) > 0.1);
+    REQUIRE(turned.getVelocityEnu().x == Catch::Approx(-level.getVelocityEnu().y).margin(1e-9));
+    REQUIRE(turned.getVelocityEnu().y == Catch::Approx(level.getVelocityEnu().x).margin(1e-9));
+    REQUIRE(turned.getPositionEnu().z == Catch::Approx(level.getPositionEnu().z).margin(1e-9));
+    // tilt costs vertical thrust
+    REQUIRE(level.getPositionEnu().z < 20.0);
+}
+
+TEST_CASE("Surrogate model round-trips through YAML", "[surrogate]") {
+    const auto path = std::filesystem::temp_directory_path() / "virtDrone_test_surrogate.yaml";
+    drone::simulator::config::SurrogateModelConfig written;
+    written.model = hoverModel();
+    REQUIRE(written.saveToFile(path.string()));
+
+    drone::simulator::config::SurrogateModelConfig read;
+    REQUIRE(read.loadFromFile(path.string()));
+    REQUIRE(read.model.hover_rpm == Catch::Approx(written.model.hover_rpm));
+    REQUIRE(read.model.hover_thrust_accel_mps2 == Catch::Approx(written.model.hover_thrust_accel_mps2));
+    REQUIRE(read.model.motor_time_constant_s == Catch::Approx(written.model.motor_time_constant_s));
+    for (std::size_t i = 0; i < written.model.a.size(); ++i) {
+        REQUIRE(read.model.a[i] == Catch::Approx(written.model.a[i]));
+    }
+    for (std::size_t i = 0; i < written.model.b.size(); ++i) {
+        REQUIRE(read.model.b[i] == Catch::Approx(written.model.b[i]));
+    }
+    std::filesystem::remove(path);
+
+    drone::simulator::config::SurrogateModelConfig missing;
+    REQUIRE_FALSE(missing.loadFromFile(path.string()));
+}
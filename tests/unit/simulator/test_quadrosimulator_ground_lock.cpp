@@ -1,6 +1,9 @@
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <filesystem>
+#include <vector>
+
 #include "simulator/quadrosimulator.h"
 
 namespace {
@@ -123,3 +126,40 @@ TEST_CASE("QuaroSimulation can move after liftoff while weather is enabled", "[Q
     REQUIRE(sensors.altitude_m > 0.5);
     REQUIRE(sensors.gps_velocity_east_mps > 0.1);
 }
+
+TEST_CASE("QuaroSimulation rests on terrain and reports height above it", "[QuaroSimulation][GroundLock][TerrainMap]") {
+    const auto dir = (std::filesystem::temp_directory_path() / "virtd_ground_lock_terrain").string();
+    drone::simulator::environment::TerrainGridSpec spec;
+    spec.tile_cells = 4;
+    spec.origin_x_m = -8.0;
+    spec.origin_y_m = -8.0;
+    spec.spacing_m = 4.0;
+    const std::vector<float> flat_mesa(25, 12.0f);
+    REQUIRE(drone::simulator::environment::TerrainMap::write(dir, spec, flat_mesa));
+
+    auto sim = makeSimulation();
+    sim->setTerrainMap(drone::simulator::environment::TerrainMap::open(dir));
+    sim->start();
+    for (int i = 0; i < 50; ++i) {
+        sim->step(0.01);
+    }
+
+    const auto grounded = sim->readSensors();
+    REQUIRE(grounded.position_enu_z_m == Catch::Approx(12.0));
+    REQUIRE(grounded.altitude_agl_m == Catch::Approx(0.0).margin(1e-9));
+
+    drone::runtime::ActuatorFrame actuators;
+    actuators.desired_motor_rpm = 16000.0;
+    actuators.common_motor_rpm = 16000.0;
+    actuators.desired_motor_rpm_each = {16000.0, 16000.0, 16000.0, 16000.0};
+    for (int i = 0; i < 2500 && sim->readSensors().altitude_agl_m < 1.0; ++i) {
+        sim->applyActuators(actuators);
+        sim->step(0.01);
+    }
+    const auto airborne = sim->readSensors();
+    sim->stop();
+
+    REQUIRE(airborne.altitude_agl_m >= 1.0);
+    REQUIRE(airborne.altitude_agl_m == Catch::Approx(airborne.position_enu_z_m - 12.0));
+    std::filesystem::remove_all(dir);
+}
@@ -0,0 +1,109 @@
+import argparse
+import bisect
+import csv
+import re
+from pathlib import Path
+from typing import Dict, List, Tuple
+
+
+FIELD_PATTERN = re.compile(r"(\w+)=(\S+)")
+
+
+def load_events(events_log: str) -> List[Tuple[float, str, Dict[str, str]]]:
+    rows = []
+    for raw_line in Path(events_log).read_text(encoding="utf-8", errors="replace").splitlines():
+        parts = raw_line.strip().split(",", 2)
+        if len(parts) != 3:
+            continue
+        _, sim_elapsed, message = parts
+        try:
+            sim_elapsed_s = float(sim_elapsed)
+        except ValueError:
+            continue
+        kind, _, fields = message.partition(" ")
+        rows.append((sim_elapsed_s, kind, dict(FIELD_PATTERN.findall(fields))))
+    return rows
+
+
+def load_soc(telemetry_csv: str) -> Tuple[List[float], List[float]]:
+    with open(telemetry_csv, newline="", encoding="utf-8") as handle:
+        samples = sorted(
+            (float(row["sim_elapsed_s"]), float(row["battery_soc_percent"])) for row in csv.DictReader(handle)
+        )
+    return [time_s for time_s, _ in samples], [soc for _, soc in samples]
+
+
+def soc_at(times: List[float], soc: List[float], time_s: float) -> float:
+    index = min(max(bisect.bisect_left(times, time_s), 0), len(times) - 1)
+    return soc[index]
+
+
+def predicted_steps(events) -> List[Dict[str, float]]:
+    return [
+        {
+            "step_id": int(fields["step_id"]),
+            "start_s": float(fields["start_s"]),
+            "duration_s": float(fields["duration_s"]),
+            "end_soc_percent": float(fields["end_soc_percent"]),
+        }
+        for _, kind, fields in events
+        if kind == "MISSION_ESTIMATE_STEP"
+    ]
+
+
+def simulated_steps(events, times: List[float], soc: List[float]) -> List[Dict[str, float]]:
+    starts = [(time_s, int(fields["step_id"])) for time_s, kind, fields in events if kind == "MISSION_STEP"]
+    end_s = next((time_s for time_s, kind, _ in events if kind == "MISSION_TERMINATED"), times[-1])
+    rows = []
+    for index, (start_s, step_id) in enumerate(starts):
+        stop_s = starts[index + 1][0] if index + 1 < len(starts) else end_s
+        rows.append(
+            {
+                "step_id": step_id,
+                "start_s": start_s,
+                "duration_s": stop_s - start_s,
+                "end_soc_percent": soc_at(times, soc, stop_s),
+            }
+        )
+    return rows
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(
+        description="Compare the pre-flight mission energy estimate (MISSION_ESTIMATE_STEP) with the simulated run"
+    )
+    parser.add_argument("--telemetry", default="docs/tutorials/simulation_telemetry.csv", help="Path to telemetry CSV")
+    parser.add_argument("--events", default="docs/tutorials/simulation_events.log", help="Path to simulation events log")
+    args = parser.parse_args()
+
+    events = load_events(args.events)
+    times, soc = load_soc(args.telemetry)
+    predicted = predicted_steps(events)
+    simulated = simulated_steps(events, times, soc)
+    if not predicted or not simulated:
+        raise SystemExit("No MISSION_ESTIMATE_STEP or MISSION_STEP events in the log")
+
+    # entries are matched in execution order; a program may run the same step_id more than once
+    print(f"{'step_id':>7} {'start_s':>15} {'duration_s':>15} {'end_soc_percent':>17}")
+    print(f"{'':>7} {'pred / sim':>15} {'pred / sim':>15} {'pred / sim':>17}")
+    duration_errors = []
+    soc_errors = []
+    for estimate, actual in zip(predicted, simulated):
+        print(
+            f"{estimate['step_id']:>7} {estimate['start_s']:>7.1f}/{actual['start_s']:<7.1f} "
+            f"{estimate['duration_s']:>7.1f}/{actual['duration_s']:<7.1f} "
+            f"{estimate['end_soc_percent']:>8.1f}/{actual['end_soc_percent']:<8.1f}"
+        )
+        duration_errors.append(abs(estimate["duration_s"] - actual["duration_s"]))
+        soc_errors.append(abs(estimate["end_soc_percent"] - actual["end_soc_percent"]))
+
+    print(
+        f"\nmean |duration error| {sum(duration_errors) / len(duration_errors):.2f} s, "
+        f"mean |SOC error| {sum(soc_errors) / len(soc_errors):.2f} %"
+    )
+    if len(predicted) != len(simulated):
+        print(f"predicted {len(predicted)} step entries, simulated {len(simulated)}")
+
+
+if __name__ == "__main__":
+    main()